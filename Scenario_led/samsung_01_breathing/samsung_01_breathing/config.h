@@ -13,4 +13,20 @@
 // NeoPixel 타입 설정
 #define PIXEL_TYPE (NEO_GRB + NEO_KHZ800)
 
+// 전류 제한 (power_strip.cpp)
+// 예산을 넘는 프레임만 밝기를 낮추고 이후 프레임마다 POWER_RELEASE_STEP씩 회복
+#ifndef POWER_LIMIT_MA
+#define POWER_LIMIT_MA 2500       // LED 전체 전류 예산 (mA), 0이면 제한 안 함
+#endif
+#define LED_CHANNEL_MA 20         // 채널 하나 최대 전류 (전송 값 255 기준)
+#define LED_IDLE_MA 1             // LED 하나 대기 전류
+#define POWER_RELEASE_STEP 2      // 프레임당 밝기 회복량
+
+// 팔레트 프레임버퍼 (palette_strip.cpp)
+// 켜면 픽셀당 1바이트 팔레트 번호만 저장 (AVR에서 3바이트 버퍼 대신, 512개 기준 약 1KB SRAM 절약)
+// 전체가 한 색이라 밝기 변화는 팔레트 항목 하나만 바꿈
+// #define PALETTE_MODE
+#define PALETTE_SIZE 16           // 팔레트 항목 수 (16 또는 256)
+#define BREATH_COLOR_INDEX 1      // 숨쉬기 색 팔레트 번호 (0번은 끈 상태)
+
 #endif
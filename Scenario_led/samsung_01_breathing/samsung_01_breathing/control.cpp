@@ -3,7 +3,11 @@
 #include "control.h"
 
 //================= NeoPixel 객체 =================
-Adafruit_NeoPixel strip(LED_COUNT, LED_PIN, PIXEL_TYPE);
+#ifdef PALETTE_MODE
+PaletteStrip strip(LED_COUNT, LED_PIN, PIXEL_TYPE);
+#else
+PowerStrip strip(LED_COUNT, LED_PIN, PIXEL_TYPE);
+#endif
 
 //================= 초기화 함수 =================
 void initNeoPixel() {
@@ -16,9 +20,15 @@ void initNeoPixel() {
 
 // 모든 LED 켜기 (512개 전체)
 void turnOnAllLED(int red, int green, int blue) {
-  for(int i = 0; i < LED_COUNT; i++) {
-    strip.setPixelColor(i, strip.Color(red, green, blue));
+#ifdef PALETTE_MODE
+  // 팔레트 항목 하나만 바꿈 (인덱스 버퍼는 켜기 시작할 때 한 번만 채움, 개수 확인은 O(1))
+  strip.setPaletteColor(BREATH_COLOR_INDEX, red, green, blue);
+  if(strip.indexCount(BREATH_COLOR_INDEX) != strip.numPixels()) {
+    strip.fillIndex(BREATH_COLOR_INDEX);
   }
+#else
+  strip.fill(strip.Color(red, green, blue));
+#endif
   strip.show();
 }
 
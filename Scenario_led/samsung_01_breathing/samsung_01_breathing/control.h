@@ -5,6 +5,11 @@
 
 #include <Adafruit_NeoPixel.h>
 #include "config.h"
+#include "power_strip.h"
+
+#ifdef PALETTE_MODE
+#include "palette_strip.h"
+#endif
 
 // 초기화 함수
 void initNeoPixel();
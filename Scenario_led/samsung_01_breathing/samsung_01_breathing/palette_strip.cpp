@@ -0,0 +1,250 @@
+// palette_strip.cpp - 팔레트 인덱스 프레임버퍼 스트립 구현
+
+#include "palette_strip.h"
+
+// 팔레트 크기는 2의 거듭제곱 (인덱스를 마스크로 자름)
+#if (PALETTE_SIZE != 16) && (PALETTE_SIZE != 256)
+#error "PALETTE_SIZE는 16 또는 256"
+#endif
+
+//================= 생성 =================
+PaletteStrip::PaletteStrip(uint16_t n, int16_t pin, neoPixelType type)
+  : numLEDs(n), brightness(0), indices((uint8_t*)malloc(n))
+#if defined(__AVR__)
+  , port(portOutputRegister(digitalPinToPort(pin))), pinMask(digitalPinToBitMask(pin)),
+    endTimeUs(0), limitScale(256), limitedFrameCount(0)
+#else
+  , output(n, pin, type)
+#endif
+{
+  (void)type;
+  if(indices) memset(indices, 0, n);
+  else numLEDs = 0;
+  memset(palette, 0, sizeof(palette));
+  memset(paletteCounts, 0, sizeof(paletteCounts));
+  paletteCounts[0] = numLEDs;
+#if defined(__AVR__)
+  pinMode(pin, OUTPUT);
+  digitalWrite(pin, LOW);
+#endif
+}
+
+PaletteStrip::~PaletteStrip() {
+  free(indices);
+}
+
+void PaletteStrip::begin() {
+#if !defined(__AVR__)
+  output.begin();
+#endif
+}
+
+//================= 팔레트 =================
+void PaletteStrip::setPaletteColor(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
+  uint8_t* p = palette[index & (PALETTE_SIZE - 1)];
+  p[0] = r;
+  p[1] = g;
+  p[2] = b;
+}
+
+void PaletteStrip::setPaletteColor(uint8_t index, uint32_t c) {
+  setPaletteColor(index, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+}
+
+uint32_t PaletteStrip::getPaletteColor(uint8_t index) const {
+  const uint8_t* p = palette[index & (PALETTE_SIZE - 1)];
+  return ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+}
+
+//================= 픽셀 인덱스 =================
+void PaletteStrip::setPixelIndex(uint16_t n, uint8_t index) {
+  if(n >= numLEDs) return;
+  index &= PALETTE_SIZE - 1;
+  paletteCounts[indices[n]]--;
+  paletteCounts[index]++;
+  indices[n] = index;
+}
+
+uint8_t PaletteStrip::getPixelIndex(uint16_t n) const {
+  return n < numLEDs ? indices[n] : 0;
+}
+
+// 전체를 채우면 개수 표를 새로 쓰고, 일부면 덮이는 픽셀의 이전 번호만 뺌
+void PaletteStrip::fillIndex(uint8_t index, uint16_t first, uint16_t count) {
+  if(first >= numLEDs) return;
+  uint16_t end = (count == 0 || first + count > numLEDs) ? numLEDs : first + count;
+  index &= PALETTE_SIZE - 1;
+  if(first == 0 && end == numLEDs) {
+    memset(paletteCounts, 0, sizeof(paletteCounts));
+  } else {
+    for(uint16_t i = first; i < end; i++) paletteCounts[indices[i]]--;
+  }
+  paletteCounts[index] += end - first;
+  memset(indices + first, index, end - first);
+}
+
+void PaletteStrip::clear() {
+  fillIndex(0);
+}
+
+uint16_t PaletteStrip::indexCount(uint8_t index) const {
+  return paletteCounts[index & (PALETTE_SIZE - 1)];
+}
+
+//================= 밝기 =================
+// 팔레트 색은 그대로 두고 출력할 때만 스케일 (버퍼 재스케일 없음)
+void PaletteStrip::setBrightness(uint8_t b) {
+  brightness = b + 1;
+#if !defined(__AVR__)
+  output.setBrightness(b);
+#endif
+}
+
+//================= 전류 추정 =================
+// 밝기 적용 전 R+G+B 합계 = 항목별 (픽셀 수 × 색 합), 픽셀을 읽지 않음
+uint32_t PaletteStrip::paletteChannelSum() const {
+  uint32_t sum = 0;
+  for(uint16_t k = 0; k < PALETTE_SIZE; k++) {
+    if(!paletteCounts[k]) continue;
+    const uint8_t* p = palette[k];
+    sum += (uint32_t)paletteCounts[k] * ((uint16_t)p[0] + p[1] + p[2]);
+  }
+  return sum;
+}
+
+#if defined(__AVR__)
+
+//================= 전류 추정 / 제한 (AVR) =================
+uint32_t PaletteStrip::estimatedMilliamps() const {
+  uint32_t sum = paletteChannelSum();
+  if(brightness) sum = (sum * brightness) >> 8;
+  return (uint32_t)numLEDs * LED_IDLE_MA + sum * LED_CHANNEL_MA / 255;
+}
+
+uint32_t PaletteStrip::limitedFrames() const {
+  return limitedFrameCount;
+}
+
+// 이번 프레임 출력 배율 (밝기 + 1, 0 = 스케일 없음)
+// 버퍼를 다시 스케일할 필요가 없으므로 기본 밝기 × 제한 배율을 출력할 때만 곱함
+// 제한 배율은 PowerStrip과 같이 예산 초과면 즉시 낮추고, 여유가 생기면 프레임마다 POWER_RELEASE_STEP씩 회복
+uint8_t PaletteStrip::limitBrightness() {
+#if POWER_LIMIT_MA > 0
+  uint32_t idle = (uint32_t)numLEDs * LED_IDLE_MA;
+  if(POWER_LIMIT_MA <= idle) return brightness;
+  uint32_t budget = (uint32_t)(POWER_LIMIT_MA - idle) * 255 / LED_CHANNEL_MA;   // 허용 전송 값 합계
+  uint16_t base = brightness ? brightness : 256;
+  uint32_t baseSum = (paletteChannelSum() * base) >> 8;   // 제한 없이 보낼 때 합계
+  uint32_t allowed = baseSum > budget ? budget * 256 / baseSum : 256;
+  if(allowed < 1) allowed = 1;
+
+  if(allowed < limitScale) {
+    limitScale = (uint16_t)allowed;
+    limitedFrameCount++;
+  } else if(limitScale < 256) {
+    uint16_t next = limitScale + POWER_RELEASE_STEP;
+    limitScale = next < allowed ? next : (uint16_t)allowed;
+  }
+  if(limitScale >= 256) return brightness;
+
+  uint16_t scale = (uint16_t)(((uint32_t)base * limitScale) >> 8);
+  return scale > 1 ? (uint8_t)scale : 1;
+#else
+  return brightness;
+#endif
+}
+
+//================= 전송 (AVR) =================
+// WS2812 비트 타이밍: 하이 폭만 정확하면 되고 로우 구간은 수 us까지 늘어나도 됨
+// 그래서 하이 펄스만 어셈블리로 고정하고, 팔레트 조회/스케일은 픽셀 사이 로우 구간에서 계산
+#define WS_T1H_NS  800
+#define WS_T0H_NS  350
+#define WS_TL_NS   600
+#define WS_LATCH_US 300
+#define NS_TO_CYCLES(ns) ((uint32_t)(ns) * (F_CPU / 1000000UL) / 1000)
+
+static inline void sendByte(volatile uint8_t* port, uint8_t hi, uint8_t lo, uint8_t value) {
+  for(uint8_t bit = 0; bit < 8; bit++) {
+    if(value & 0x80) {
+      asm volatile(
+        "st %a[port], %[hi] \n\t"
+        ".rept %[onCycles] \n\t"
+        "nop \n\t"
+        ".endr \n\t"
+        "st %a[port], %[lo] \n\t"
+        ".rept %[offCycles] \n\t"
+        "nop \n\t"
+        ".endr \n\t"
+        ::
+        [port] "e" (port), [hi] "r" (hi), [lo] "r" (lo),
+        [onCycles] "I" (NS_TO_CYCLES(WS_T1H_NS) - 2),
+        [offCycles] "I" (NS_TO_CYCLES(WS_TL_NS) - 2)
+      );
+    } else {
+      asm volatile(
+        "st %a[port], %[hi] \n\t"
+        ".rept %[onCycles] \n\t"
+        "nop \n\t"
+        ".endr \n\t"
+        "st %a[port], %[lo] \n\t"
+        ".rept %[offCycles] \n\t"
+        "nop \n\t"
+        ".endr \n\t"
+        ::
+        [port] "e" (port), [hi] "r" (hi), [lo] "r" (lo),
+        [onCycles] "I" (NS_TO_CYCLES(WS_T0H_NS) - 2),
+        [offCycles] "I" (NS_TO_CYCLES(WS_TL_NS) - 2)
+      );
+    }
+    value <<= 1;
+  }
+}
+
+void PaletteStrip::show() {
+  if(!numLEDs) return;
+  uint8_t scale = limitBrightness();
+
+  // 이전 전송 래치 대기
+  while((micros() - endTimeUs) < WS_LATCH_US);
+
+  noInterrupts();
+  uint8_t hi = *port | pinMask;
+  uint8_t lo = *port & ~pinMask;
+  for(uint16_t i = 0; i < numLEDs; i++) {
+    const uint8_t* p = palette[indices[i]];
+    uint8_t r = p[0], g = p[1], b = p[2];
+    if(scale) {
+      r = (r * scale) >> 8;
+      g = (g * scale) >> 8;
+      b = (b * scale) >> 8;
+    }
+    sendByte(port, hi, lo, g);
+    sendByte(port, hi, lo, r);
+    sendByte(port, hi, lo, b);
+  }
+  interrupts();
+
+  endTimeUs = micros();
+}
+
+#else
+
+//================= 출력 (호스트 등) =================
+// 팔레트 색을 PowerStrip 버퍼로 확장 (밝기 스케일과 전류 제한은 PowerStrip이 처리)
+uint32_t PaletteStrip::estimatedMilliamps() const {
+  return output.estimatedMilliamps();
+}
+
+uint32_t PaletteStrip::limitedFrames() const {
+  return output.limitedFrames();
+}
+
+void PaletteStrip::show() {
+  for(uint16_t i = 0; i < numLEDs; i++) {
+    const uint8_t* p = palette[indices[i]];
+    output.setPixelColor(i, p[0], p[1], p[2]);
+  }
+  output.show();
+}
+
+#endif
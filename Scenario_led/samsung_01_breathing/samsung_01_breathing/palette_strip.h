@@ -0,0 +1,72 @@
+// palette_strip.h - 팔레트 인덱스 프레임버퍼 스트립 (픽셀당 1바이트)
+// 픽셀에는 팔레트 번호만 저장하고, 색은 PALETTE_SIZE개 팔레트에만 둠
+// 전체 페이드 등 팔레트 애니메이션은 팔레트 항목만 바꾸면 되므로 O(팔레트)
+// 팔레트 항목별 픽셀 수를 유지해 전류 추정(R+G+B 합계)도 O(팔레트)
+// AVR: show() 중 팔레트 → GRB를 바로 확장해 전송 (3바이트 버퍼 없음, 512개 기준 약 1KB 절약)
+// 그 외(호스트 포함): show()에서 PowerStrip 버퍼로 확장 후 라이브러리로 전송
+
+#ifndef PALETTE_STRIP_H
+#define PALETTE_STRIP_H
+
+#include <Adafruit_NeoPixel.h>
+#include "config.h"
+
+#if !defined(__AVR__)
+#include "power_strip.h"
+#endif
+
+class PaletteStrip {
+ public:
+  PaletteStrip(uint16_t n, int16_t pin, neoPixelType type);   // GRB 순서만 지원
+  ~PaletteStrip();
+
+  void begin();
+
+  // ===== 팔레트 (밝기 적용 전 색) =====
+  void setPaletteColor(uint8_t index, uint8_t r, uint8_t g, uint8_t b);
+  void setPaletteColor(uint8_t index, uint32_t c);
+  uint32_t getPaletteColor(uint8_t index) const;
+
+  // ===== 픽셀 인덱스 =====
+  void setPixelIndex(uint16_t n, uint8_t index);
+  uint8_t getPixelIndex(uint16_t n) const;
+  void fillIndex(uint8_t index, uint16_t first = 0, uint16_t count = 0);
+  void clear();                    // 전체 픽셀을 0번 팔레트로
+  uint16_t indexCount(uint8_t index) const;   // 이 번호를 가리키는 픽셀 수 (O(1))
+
+  // ===== 밝기 / 출력 =====
+  void setBrightness(uint8_t b);
+  uint8_t getBrightness() const { return brightness - 1; }
+  void show();
+
+  // ===== 상태 =====
+  uint16_t numPixels() const { return numLEDs; }
+  uint32_t estimatedMilliamps() const;
+  uint32_t limitedFrames() const;
+
+ private:
+  PaletteStrip(const PaletteStrip&);
+  PaletteStrip& operator=(const PaletteStrip&);
+
+  uint16_t numLEDs;
+  uint8_t brightness;              // 라이브러리와 같이 밝기 + 1 저장 (0 = 스케일 없음)
+  uint8_t* indices;                // 픽셀당 팔레트 번호
+  uint8_t palette[PALETTE_SIZE][3];   // R, G, B
+  uint16_t paletteCounts[PALETTE_SIZE];   // 항목별 픽셀 수 (setPixelIndex/fillIndex/clear에서 갱신)
+
+  uint32_t paletteChannelSum() const;
+
+#if defined(__AVR__)
+  uint8_t limitBrightness();
+  uint16_t limitScale;             // 전류 제한 배율 (기본 밝기에 곱함, 256 = 제한 없음)
+
+  volatile uint8_t* port;
+  uint8_t pinMask;
+  unsigned long endTimeUs;         // 마지막 전송 끝 시각 (래치 대기용)
+  uint32_t limitedFrameCount;
+#else
+  PowerStrip output;
+#endif
+};
+
+#endif
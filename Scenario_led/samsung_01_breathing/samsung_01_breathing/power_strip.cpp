@@ -0,0 +1,202 @@
+// power_strip.cpp - 전류 추정/제한 스트립 구현
+
+#include "power_strip.h"
+
+// 프로파일러가 켜진 스케치(PROFILE_MODE)에서만 show() 시간 측정
+#ifdef PROFILE_MODE
+#include "profiler.h"
+#define SHOW_PROFILE_BEGIN()  profileBegin(PROF_SHOW)
+#define SHOW_PROFILE_END()    profileEnd(PROF_SHOW)
+#else
+#define SHOW_PROFILE_BEGIN()
+#define SHOW_PROFILE_END()
+#endif
+
+unsigned long PowerStrip::stalledUs = 0;
+
+//================= 생성 =================
+PowerStrip::PowerStrip(uint16_t n, int16_t pin, neoPixelType type)
+  : Adafruit_NeoPixel(n, pin, type), channelSum(0), outputScale(256), limitedFrameCount(0)
+#if defined(__AVR__)
+  , savedPixels(0)
+#else
+  , savedPixels((uint8_t*)malloc((size_t)n * 3))
+#endif
+{
+}
+
+PowerStrip::~PowerStrip() {
+  free(savedPixels);
+}
+
+//================= 픽셀 쓰기 =================
+// 이전 전송 값을 빼고 새 전송 값을 더함 (픽셀당 덧셈 몇 번)
+void PowerStrip::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+  if(n >= numPixels()) return;
+  uint8_t* p = getPixels() + n * 3;
+  channelSum -= (uint16_t)p[0] + p[1] + p[2];
+  Adafruit_NeoPixel::setPixelColor(n, r, g, b);
+  channelSum += (uint16_t)p[0] + p[1] + p[2];
+}
+
+void PowerStrip::setPixelColor(uint16_t n, uint32_t c) {
+  setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+}
+
+// 라이브러리 fill로 한 번에 쓰고 (호스트 렌더 데몬은 합성 커널) 합계는 구간만 바꿈
+void PowerStrip::fill(uint32_t c, uint16_t first, uint16_t count) {
+  uint16_t end = (count == 0 || first + count > numPixels()) ? numPixels() : first + count;
+  if(first >= end) return;
+  const uint8_t* p = getPixels();
+  uint32_t before = 0;
+  for(uint16_t i = first * 3; i < end * 3; i++) {
+    before += p[i];
+  }
+  Adafruit_NeoPixel::fill(c, first, count);
+  uint16_t pixel = (uint16_t)p[first * 3] + p[first * 3 + 1] + p[first * 3 + 2];
+  channelSum = channelSum - before + (uint32_t)pixel * (end - first);
+}
+
+void PowerStrip::setWireByte(uint16_t offset, uint8_t value) {
+  if(offset >= numPixels() * 3) return;
+  uint8_t* p = getPixels() + offset;
+  channelSum += value;
+  channelSum -= *p;
+  *p = value;
+}
+
+void PowerStrip::clear() {
+  Adafruit_NeoPixel::clear();
+  channelSum = 0;
+}
+
+#ifdef NEO_OVERLAY_COLOR
+void PowerStrip::overlayColor(uint8_t r, uint8_t g, uint8_t b, float alpha) {
+  Adafruit_NeoPixel::overlayColor(r, g, b, alpha);
+  recountChannels();
+}
+#endif
+
+//================= 밝기 =================
+// 라이브러리가 버퍼 전체를 다시 스케일하므로 합계도 같이 다시 계산
+// (스케치가 기본 밝기를 바꿀 때만 실행, 전류 제한은 이 경로를 쓰지 않음)
+void PowerStrip::setBrightness(uint8_t b) {
+  if(b == getBrightness()) return;
+  Adafruit_NeoPixel::setBrightness(b);
+  recountChannels();
+}
+
+void PowerStrip::recountChannels() {
+  const uint8_t* p = getPixels();
+  uint32_t sum = 0;
+  for(uint16_t i = 0; i < numPixels() * 3; i++) {
+    sum += p[i];
+  }
+  channelSum = sum;
+}
+
+//================= 전류 추정 =================
+uint32_t PowerStrip::estimatedMilliamps() const {
+  uint32_t sum = (channelSum * outputScale) >> 8;
+  return (uint32_t)numPixels() * LED_IDLE_MA + sum * LED_CHANNEL_MA / 255;
+}
+
+//================= 전류 제한 =================
+// 출력 값 = (저장된 값 × 배율) >> 8, 바이트마다 내림이므로 합계 × 배율 / 256 이하
+// 예산 초과: 예산에 맞는 배율로 즉시 낮춤
+// 예산 여유: 프레임마다 POWER_RELEASE_STEP씩 올리되 예산에 맞는 배율을 넘지 않음
+void PowerStrip::limitPower() {
+#if POWER_LIMIT_MA > 0
+  uint32_t idle = (uint32_t)numPixels() * LED_IDLE_MA;
+  if(POWER_LIMIT_MA <= idle) return;
+  uint32_t budget = (uint32_t)(POWER_LIMIT_MA - idle) * 255 / LED_CHANNEL_MA;   // 허용 전송 값 합계
+  uint32_t allowed = channelSum > budget ? budget * 256 / channelSum : 256;
+  if(allowed < 1) allowed = 1;
+
+  if(allowed < outputScale) {
+    outputScale = (uint16_t)allowed;
+    limitedFrameCount++;
+  } else if(outputScale < 256) {
+    uint16_t next = outputScale + POWER_RELEASE_STEP;
+    outputScale = next < allowed ? next : (uint16_t)allowed;
+  }
+#endif
+}
+
+void PowerStrip::show() {
+  limitPower();
+  SHOW_PROFILE_BEGIN();
+  transmit(false);
+  SHOW_PROFILE_END();
+}
+
+// 제한 없는 프레임은 버퍼 그대로 전송
+// 제한된 프레임은 버퍼를 스케일해 라이브러리 show()로 보낸 뒤 되돌림 (전송 시작 후엔 그리기 버퍼를 써도 됨)
+// 보관한 복사본이 있으면 그대로 복사, 없으면(AVR) 역스케일: 같은 출력 값이 되는 원래 값 중 가장 작은 값
+// (배율 128 이상이면 원래 값과 최대 1 차이, 0은 0 그대로)
+void PowerStrip::transmit(bool async) {
+  uint8_t* p = getPixels();
+  uint16_t bytes = numPixels() * 3;
+  uint16_t scale = outputScale;
+  bool scaled = scale < 256;
+  if(scaled) {
+    if(savedPixels) memcpy(savedPixels, p, bytes);
+    for(uint16_t i = 0; i < bytes; i++) {
+      p[i] = (uint8_t)((p[i] * scale) >> 8);
+    }
+  }
+#ifdef NEO_ASYNC_SHOW
+  if(async) Adafruit_NeoPixel::beginShow();
+  else blockingShow();
+#else
+  (void)async;
+  blockingShow();
+#endif
+  if(!scaled) return;
+  if(savedPixels) {
+    memcpy(p, savedPixels, bytes);
+    return;
+  }
+  uint32_t sum = 0;
+  for(uint16_t i = 0; i < bytes; i++) {
+    p[i] = (uint8_t)(((uint16_t)p[i] * 256 + scale - 1) / scale);
+    sum += p[i];
+  }
+  channelSum = sum;
+}
+
+//================= 시간 기준 =================
+unsigned long PowerStrip::nowUs() {
+  return micros() + stalledUs;
+}
+
+uint32_t PowerStrip::wireTimeUs() const {
+  return (uint32_t)numPixels() * STRIP_WIRE_US_PER_PIXEL + STRIP_LATCH_US;
+}
+
+// 라이브러리 블로킹 전송 + micros()가 놓친 만큼 시간 기준에 더함
+void PowerStrip::blockingShow() {
+  unsigned long start = micros();
+  Adafruit_NeoPixel::show();
+  uint32_t counted = micros() - start;
+  uint32_t wire = wireTimeUs();
+  if(counted < wire) stalledUs += wire - counted;
+}
+
+//================= 비동기 출력 =================
+// NEO_ASYNC_SHOW: 라이브러리가 beginShow()/isBusy()를 제공 (호스트 시뮬레이션 등)
+// 프로파일러의 show 시간에는 이전 전송 대기만 들어감
+void PowerStrip::beginShow() {
+  limitPower();
+  SHOW_PROFILE_BEGIN();
+  transmit(true);
+  SHOW_PROFILE_END();
+}
+
+bool PowerStrip::isBusy() const {
+#ifdef NEO_ASYNC_SHOW
+  return Adafruit_NeoPixel::isBusy();
+#else
+  return false;   // 블로킹 전송은 반환 시점에 이미 끝남
+#endif
+}
@@ -13,4 +13,24 @@
 // NeoPixel 타입 설정
 #define PIXEL_TYPE (NEO_GRB + NEO_KHZ800)
 
+// 전류 제한 (power_strip.cpp)
+// 예산을 넘는 프레임만 밝기를 낮추고 이후 프레임마다 POWER_RELEASE_STEP씩 회복
+#ifndef POWER_LIMIT_MA
+#define POWER_LIMIT_MA 2500       // LED 전체 전류 예산 (mA), 0이면 제한 안 함
+#endif
+#define LED_CHANNEL_MA 20         // 채널 하나 최대 전류 (전송 값 255 기준)
+#define LED_IDLE_MA 1             // LED 하나 대기 전류
+#define POWER_RELEASE_STEP 2      // 프레임당 밝기 회복량
+
+// 반응 트리거 입력 (trigger_input.cpp)
+// 시퀀스 중 트리거가 오면 다음 프레임 경계에서 중단하고 지금 화면에서 반응 색으로 블렌드
+#define TRIGGER_BAUDRATE 115200
+#define TRIGGER_SYNC '!'              // 메시지 시작 바이트
+#define TRIGGER_BLEND_MS 200          // 지금 화면 → 반응 색 전환 시간
+#define TRIGGER_HOLD_MS 800           // 놀람 반응 유지 시간
+#define TRIGGER_RELEASE_MS 600        // 놀람 후 30%로 돌아가는 시간
+#define TRIGGER_TARGET_FRAMES 2       // 지연 목표 (전송 프레임 수)
+#define TRIGGER_HIST_BUCKETS 16       // 지연 히스토그램 칸 수 (마지막 칸 = 그 이상)
+#define TRIGGER_HIST_BUCKET_US 4000   // 칸 폭 (us)
+
 #endif
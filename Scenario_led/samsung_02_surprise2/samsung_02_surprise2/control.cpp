@@ -1,10 +1,12 @@
 // control.cpp - LED 제어 함수 구현 (트래킹 모션 추가)
 
 #include "control.h"
+#include "wipe_engine.h"
+#include "trigger_input.h"
 #include <math.h>
 
 //================= NeoPixel 객체 =================
-Adafruit_NeoPixel strip(LED_COUNT, LED_PIN, PIXEL_TYPE);
+PowerStrip strip(LED_COUNT, LED_PIN, PIXEL_TYPE);
 
 //================= 초기화 함수 =================
 void initNeoPixel() {
@@ -27,9 +29,7 @@ int getPixelIndex(int x, int y) {
 
 // 모든 LED 켜기 (512개 전체)
 void turnOnAllLED(int red, int green, int blue) {
-  for(int i = 0; i < LED_COUNT; i++) {
-    strip.setPixelColor(i, strip.Color(red, green, blue));
-  }
+  strip.fill(strip.Color(red, green, blue));
   strip.show();
 }
 
@@ -39,6 +39,16 @@ void turnOffAllLED() {
   strip.show();
 }
 
+//================= 프레임 경계 대기 =================
+// delay() 대신 사용: 1ms마다 트리거를 확인하고, 트리거가 대기 중이면 바로 false
+bool frameWait(unsigned long ms) {
+  for(unsigned long i = 0; i < ms; i++) {
+    if(triggerPoll()) return false;
+    delay(1);
+  }
+  return !triggerPoll();
+}
+
 //================= 페이드 효과 함수 (단순 선형) =================
 
 // 2.7초 동안 선형으로 색상 변경
@@ -64,7 +74,8 @@ void linearFade(int fromR, int fromG, int fromB,
 }
 
 //================= 짧은 선형 페이드 함수 (0.2초용) =================
-void linearFadeShort(int fromR, int fromG, int fromB,
+// 트리거가 들어오면 다음 프레임 경계에서 중단하고 false
+bool linearFadeShort(int fromR, int fromG, int fromB,
                      int toR, int toG, int toB, int durationMs) {
   int steps = durationMs / 10;  // 10ms 단위
   
@@ -76,10 +87,11 @@ void linearFadeShort(int fromR, int fromG, int fromB,
     
     turnOnAllLED(currentR, currentG, currentB);
     
-    if(i < steps) {
-      delay(10);
+    if(i < steps && !frameWait(10)) {
+      return false;
     }
   }
+  return true;
 }
 
 //================= 27초 시퀀스 =================
@@ -104,121 +116,33 @@ void sequence27sec() {
 }
 
 //================= 개별 픽셀 페이드 함수 =================
+// 와이프 엔진 사용: show()를 픽셀마다 부르지 않고 프레임마다 필요한 만큼 공개
 void individualPixelFade(int red, int green, int blue, 
                          bool fadeIn, int durationMs) {
-  int pixelDelay = durationMs / LED_COUNT;
-  if(pixelDelay < 1) pixelDelay = 1;
-  
+  WipeStyle style = { 1, 0 };
   if(fadeIn) {
     strip.clear();
-    strip.show();
-    
-    for(int i = 0; i < LED_COUNT; i++) {
-      strip.setPixelColor(i, strip.Color(red, green, blue));
-      strip.show();
-      delay(pixelDelay);
-    }
-  } else {
-    for(int i = LED_COUNT - 1; i >= 0; i--) {
-      strip.setPixelColor(i, 0);
-      strip.show();
-      delay(pixelDelay);
-    }
   }
+  runWipe(strip, red, green, blue, fadeIn, durationMs, style);
 }
 
 //================= 웨이브 페이드 함수 =================
+// 20픽셀 블록 단위로 경계 이동
 void waveFade(int red, int green, int blue, 
               bool fadeIn, int durationMs) {
-  int waveSize = 20;
-  int steps = LED_COUNT / waveSize;
-  int stepDelay = durationMs / steps;
-  
+  WipeStyle style = { 20, 0 };
   if(fadeIn) {
     strip.clear();
-    for(int step = 0; step < steps; step++) {
-      int startIdx = step * waveSize;
-      int endIdx = min(startIdx + waveSize, LED_COUNT);
-      
-      for(int i = startIdx; i < endIdx; i++) {
-        strip.setPixelColor(i, strip.Color(red, green, blue));
-      }
-      strip.show();
-      delay(stepDelay);
-    }
-    for(int i = 0; i < LED_COUNT; i++) {
-      strip.setPixelColor(i, strip.Color(red, green, blue));
-    }
-    strip.show();
-  } else {
-    for(int step = 0; step < steps; step++) {
-      int startIdx = LED_COUNT - ((step + 1) * waveSize);
-      int endIdx = LED_COUNT - (step * waveSize);
-      
-      for(int i = max(startIdx, 0); i < endIdx; i++) {
-        strip.setPixelColor(i, 0);
-      }
-      strip.show();
-      delay(stepDelay);
-    }
-    strip.clear();
-    strip.show();
   }
+  runWipe(strip, red, green, blue, fadeIn, durationMs, style);
 }
 
 //================= 그라데이션 페이드 함수 =================
+// 경계 앞뒤 10픽셀 부드러운 가장자리, 이미 켜진 픽셀은 다시 쓰지 않음
 void gradientFade(int red, int green, int blue, 
                   bool fadeIn, int durationMs) {
-  int steps = 100;
-  int stepDelay = durationMs / steps;
-  
-  if(fadeIn) {
-    for(int step = 0; step <= steps; step++) {
-      float progress = (float)step / steps;
-      int activePixels = (int)(LED_COUNT * progress);
-      
-      for(int i = 0; i < activePixels; i++) {
-        strip.setPixelColor(i, strip.Color(red, green, blue));
-      }
-      
-      int fadeZone = 10;
-      for(int i = 0; i < fadeZone && (activePixels + i) < LED_COUNT; i++) {
-        float fadeFactor = 1.0 - ((float)i / fadeZone);
-        int fadedR = (int)(red * fadeFactor);
-        int fadedG = (int)(green * fadeFactor);
-        int fadedB = (int)(blue * fadeFactor);
-        strip.setPixelColor(activePixels + i, strip.Color(fadedR, fadedG, fadedB));
-      }
-      
-      strip.show();
-      delay(stepDelay);
-    }
-  } else {
-    for(int step = 0; step <= steps; step++) {
-      float progress = (float)step / steps;
-      int remainingPixels = (int)(LED_COUNT * (1.0 - progress));
-      
-      strip.clear();
-      for(int i = 0; i < remainingPixels; i++) {
-        strip.setPixelColor(i, strip.Color(red, green, blue));
-      }
-      
-      int fadeZone = 10;
-      for(int i = 0; i < fadeZone && (remainingPixels - fadeZone + i) >= 0; i++) {
-        float fadeFactor = (float)i / fadeZone;
-        int fadedR = (int)(red * fadeFactor);
-        int fadedG = (int)(green * fadeFactor);
-        int fadedB = (int)(blue * fadeFactor);
-        int pixelIdx = remainingPixels - fadeZone + i;
-        if(pixelIdx >= 0) {
-          strip.setPixelColor(pixelIdx, strip.Color(fadedR, fadedG, fadedB));
-        }
-      }
-      
-      strip.show();
-      delay(stepDelay);
-    }
-  }
+  WipeStyle style = { 1, 10 };
+  runWipe(strip, red, green, blue, fadeIn, durationMs, style);
 }
 
 //================= 새로운 20초 시퀀스 (OFF에서 시작) =================
@@ -368,11 +292,12 @@ void drawTrackingColumn(float position, int red, int green, int blue, float grad
     }
   }
   
-  strip.show();
+  // 전송 시작만 하고 반환 (이어지는 delay 동안 전송, 프레임 간격 = max(delay, 전송 시간))
+  strip.beginShow();
 }
 
 //================= 트래킹 모션 시퀀스 =================
-void trackingMotion() {
+bool trackingMotion() {
   // 색상 정의 - 30% 밝기 사용
   int color30_R = 110, color30_G = 90, color30_B = 60;  // 30% 컬러
   
@@ -388,12 +313,12 @@ void trackingMotion() {
     float currentPos = startPos1 + (endPos1 - startPos1) * easedT;
     drawTrackingColumn(currentPos, color30_R, color30_G, color30_B, 0.8);  // 그라데이션 폭 줄임
     
-    delay(20);  // 20ms * 100 = 2000ms (2초)
+    if(!frameWait(20)) return false;  // 20ms * 100 = 2000ms (2초)
   }
   
   // === Phase 2: 왼쪽(0)에서 1초 대기 ===
   drawTrackingColumn(0.0, color30_R, color30_G, color30_B, 0.8);
-  delay(1000);
+  if(!frameWait(1000)) return false;
   
   // === Phase 3: 왼쪽(0)에서 중간(8)으로 이동 (1.5초) ===
   int steps2 = 75;  // 75 스텝
@@ -407,12 +332,12 @@ void trackingMotion() {
     float currentPos = startPos2 + (endPos2 - startPos2) * easedT;
     drawTrackingColumn(currentPos, color30_R, color30_G, color30_B, 0.8);
     
-    delay(20);  // 20ms * 75 = 1500ms (1.5초)
+    if(!frameWait(20)) return false;  // 20ms * 75 = 1500ms (1.5초)
   }
   
   // === Phase 4: 최종 위치에서 1초 유지 ===
   drawTrackingColumn(8.0, color30_R, color30_G, color30_B, 0.8);
-  delay(1000);
+  if(!frameWait(1000)) return false;
   
   // === Phase 5: 페이드 아웃 (0.5초) ===
   int fadeSteps = 25;
@@ -423,16 +348,18 @@ void trackingMotion() {
     int fadeB = (int)(color30_B * brightness);
     
     drawTrackingColumn(8.0, fadeR, fadeG, fadeB, 0.8);
-    delay(20);  // 20ms * 25 = 500ms
+    if(!frameWait(20)) return false;  // 20ms * 25 = 500ms
   }
   
   // 완전히 OFF
   strip.clear();
   strip.show();
+  return true;
 }
 
 //================= 통합 시퀀스 (17초까지 30% + 트래킹) =================
-void sequenceWithTracking() {
+// 트리거로 중단되면 false (화면은 중단 시점 그대로 두고 반응이 이어받음)
+bool sequenceWithTracking() {
   // 색상 정의
   int color30_R = 110, color30_G = 110, color30_B = 60;   // 30% 컬러
   int color70_R = 140, color70_G = 140, color70_B = 60;   // 70% 컬러
@@ -440,61 +367,127 @@ void sequenceWithTracking() {
   
   // === 0초: 30% 시작 ===
   turnOnAllLED(color30_R, color30_G, color30_B);
-  delay(1800);  // 1.8초 유지
+  if(!frameWait(1800)) return false;  // 1.8초 유지
   
   // === 1.8초-2초: 30% → 70% 전환 (0.2초) ===
-  linearFadeShort(color30_R, color30_G, color30_B,
-                  color70_R, color70_G, color70_B, 200);
+  if(!linearFadeShort(color30_R, color30_G, color30_B,
+                      color70_R, color70_G, color70_B, 200)) return false;
   
   // === 2초-3.8초: 70% 유지 ===
   turnOnAllLED(color70_R, color70_G, color70_B);
-  delay(1800);
+  if(!frameWait(1800)) return false;
   
   // === 3.8초-4초: 70% → 30% 전환 (0.2초) ===
-  linearFadeShort(color70_R, color70_G, color70_B,
-                  color30_R, color30_G, color30_B, 200);
+  if(!linearFadeShort(color70_R, color70_G, color70_B,
+                      color30_R, color30_G, color30_B, 200)) return false;
   
   // === 4초-5.8초: 30% 유지 ===
   turnOnAllLED(color30_R, color30_G, color30_B);
-  delay(1800);
+  if(!frameWait(1800)) return false;
   
   // === 5.8초-6초: 30% → 70% 전환 (0.2초) ===
-  linearFadeShort(color30_R, color30_G, color30_B,
-                  color70_R, color70_G, color70_B, 200);
+  if(!linearFadeShort(color30_R, color30_G, color30_B,
+                      color70_R, color70_G, color70_B, 200)) return false;
   
   // === 6초-7.8초: 70% 유지 ===
   turnOnAllLED(color70_R, color70_G, color70_B);
-  delay(1800);
+  if(!frameWait(1800)) return false;
   
   // === 7.8초-8초: 70% → 30% 전환 (0.2초) ===
-  linearFadeShort(color70_R, color70_G, color70_B,
-                  color30_R, color30_G, color30_B, 200);
+  if(!linearFadeShort(color70_R, color70_G, color70_B,
+                      color30_R, color30_G, color30_B, 200)) return false;
   
   // === 8초-9.8초: 30% 유지 ===
   turnOnAllLED(color30_R, color30_G, color30_B);
-  delay(1800);
+  if(!frameWait(1800)) return false;
   
   // === 9.8초-10초: 30% → 70% 전환 (0.2초) ===
-  linearFadeShort(color30_R, color30_G, color30_B,
-                  color70_R, color70_G, color70_B, 200);
+  if(!linearFadeShort(color30_R, color30_G, color30_B,
+                      color70_R, color70_G, color70_B, 200)) return false;
   
   // === 10초: 70% → 100% 즉시 전환 ===
   turnOnAllLED(color100_R, color100_G, color100_B);
   
   // === 10초-12초: 100% 유지 (2초) ===
-  delay(2000);
+  if(!frameWait(2000)) return false;
   
   // === 12초-12.2초: 100% → 30% 전환 (0.2초) ===
-  linearFadeShort(color100_R, color100_G, color100_B,
-                  color30_R, color30_G, color30_B, 200);
+  if(!linearFadeShort(color100_R, color100_G, color100_B,
+                      color30_R, color30_G, color30_B, 200)) return false;
   
   // === 12.2초-17초: 30% 유지 (4.8초) ===
   turnOnAllLED(color30_R, color30_G, color30_B);
-  delay(4800);
+  if(!frameWait(4800)) return false;
   
   // === 17초부터: 트래킹 모션 시작 ===
-  Serial.println("17초: 트래킹 모션 시작");
-  trackingMotion();  // 약 6초 소요 (2초 이동 + 1초 대기 + 1.5초 이동 + 1초 유지 + 0.5초 페이드아웃)
+  if(!trackingMotion()) return false;  // 약 6초 소요 (2초 이동 + 1초 대기 + 1.5초 이동 + 1초 유지 + 0.5초 페이드아웃)
   
   // === 총 23초에 완료 ===
+  return true;
+}
+
+//================= 트리거 반응 =================
+// 버퍼의 전송 값에서 원래 채널 값 복원 (올림 역스케일이라 다시 써도 전송 값이 그대로)
+// getPixelColor()는 내림이라 읽고 쓰기를 반복하면 프레임마다 어두워짐
+static int exactChannel(uint8_t wire) {
+  uint16_t scale = (uint16_t)strip.getBrightness() + 1;
+  int value = ((uint16_t)wire * 256 + scale - 1) / scale;
+  return value > 255 ? 255 : value;
+}
+
+// 지금 화면에서 목표 색으로 블렌드 (이전 효과를 흐리며 넘어감)
+// 원본 복사 없이 남은 단계 수로 나눠 제자리 보간, 마지막 프레임은 정확히 목표 색
+// 남은 거리의 3/(남은 단계 + 2)씩 이동 (처음이 빠른 감속 곡선, 첫 프레임부터 변화가 보임)
+// 첫 프레임은 대기 없이 바로 전송 (트리거 지연 기록), 도중에 새 트리거가 오면 false
+static bool blendToColor(int red, int green, int blue, int durationMs) {
+  uint32_t wireUs = strip.wireTimeUs();
+  uint16_t frames = (uint32_t)durationMs * 1000 / wireUs;
+  if(frames < 1) frames = 1;
+  uint32_t slotUs = (uint32_t)durationMs * 1000 / frames;
+
+  for(uint16_t k = 0; k < frames; k++) {
+    unsigned long renderStart = micros();
+    int remaining = frames - k;
+    const uint8_t* wire = strip.getPixels();
+    for(int i = 0; i < LED_COUNT; i++) {
+      int g = exactChannel(wire[i * 3 + 0]);   // GRB 순서
+      int r = exactChannel(wire[i * 3 + 1]);
+      int b = exactChannel(wire[i * 3 + 2]);
+      r += (red - r) * 3 / (remaining + 2);
+      g += (green - g) * 3 / (remaining + 2);
+      b += (blue - b) * 3 / (remaining + 2);
+      strip.setPixelColor(i, strip.Color(r, g, b));
+    }
+    uint32_t spentUs = micros() - renderStart;
+
+    triggerPhoton(wireUs);
+    strip.show();
+    spentUs += wireUs;
+    if(k + 1 < frames && spentUs < slotUs && !frameWait((slotUs - spentUs) / 1000)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// 대기 중인 트리거 하나 처리 (반응 중 새 트리거가 오면 바로 반환, 호출한 쪽이 이어서 처리)
+void playReaction() {
+  int color30_R = 110, color30_G = 110, color30_B = 60;    // 30% 컬러
+  int color100_R = 180, color100_G = 180, color100_B = 70; // 100% 컬러
+
+  switch(triggerTake()) {
+    case TRIGGER_SURPRISE:
+      if(!blendToColor(color100_R, color100_G, color100_B, TRIGGER_BLEND_MS)) return;
+      if(!frameWait(TRIGGER_HOLD_MS)) return;
+      blendToColor(color30_R, color30_G, color30_B, TRIGGER_RELEASE_MS);
+      break;
+
+    case TRIGGER_CALM:
+      blendToColor(color30_R, color30_G, color30_B, TRIGGER_BLEND_MS);
+      break;
+
+    case TRIGGER_OFF:
+      blendToColor(0, 0, 0, TRIGGER_BLEND_MS);
+      break;
+  }
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include <Adafruit_NeoPixel.h>
 #include "config.h"
+#include "power_strip.h"
 
 // 초기화 함수
 void initNeoPixel();
@@ -17,8 +18,11 @@ void turnOffAllLED();
 void linearFade(int fromR, int fromG, int fromB, 
                 int toR, int toG, int toB);
 
-// 짧은 선형 페이드 함수 (0.2초용)
-void linearFadeShort(int fromR, int fromG, int fromB,
+// 프레임 경계 대기 (트리거가 오면 false)
+bool frameWait(unsigned long ms);
+
+// 짧은 선형 페이드 함수 (0.2초용, 트리거로 중단되면 false)
+bool linearFadeShort(int fromR, int fromG, int fromB,
                      int toR, int toG, int toB, int durationMs);
 
 // 개별 픽셀 페이드 함수
@@ -56,10 +60,16 @@ float easeOutCubic(float t);
 // 트래킹 컬럼 그리기
 void drawTrackingColumn(float position, int red, int green, int blue, float gradientWidth);
 
-// 트래킹 모션 시퀀스
-void trackingMotion();
+// 트래킹 모션 시퀀스 (트리거로 중단되면 false)
+bool trackingMotion();
+
+// 통합 시퀀스 (17초까지 30% + 트래킹, 트리거로 중단되면 false)
+bool sequenceWithTracking();
+
+// 대기 중인 트리거 반응 실행 (trigger_input.h)
+void playReaction();
 
-// 통합 시퀀스 (17초까지 30% + 트래킹)
-void sequenceWithTracking();
+// ===== 전역 변수 선언 (extern) =====
+extern PowerStrip strip;
 
 #endif
\ No newline at end of file
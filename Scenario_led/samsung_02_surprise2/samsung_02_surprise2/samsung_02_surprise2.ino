@@ -1,9 +1,11 @@
 // samsung_03_surprise.ino - 트래킹 모션 포함 메인 실행 파일
 
 #include "control.h"
+#include "trigger_input.h"
 
 void setup() {
   initNeoPixel();  // NeoPixel 초기화
+  triggerBegin();  // 반응 트리거 시리얼 입력
 }
 
 void loop() {
@@ -13,12 +15,19 @@ void loop() {
     unsigned long start = millis();
     
     // 통합 시퀀스 실행 (17초까지 30% 유지 + 트래킹 모션)
+    // 트리거가 오면 다음 프레임 경계에서 중단되고 아래 반응으로 넘어감
     sequenceWithTracking();
     
     unsigned long elapsed = millis() - start;
     
     done = true;
   }
+
+  // 트리거 반응 (반응 중 새 트리거가 오면 그 반응으로 바로 넘어감)
+  while (triggerPoll()) {
+    playReaction();
+  }
+  delay(1);
 }
 
 /*
@@ -62,6 +71,12 @@ void loop() {
 - 가우시안 분포를 이용한 부드러운 그라데이션 효과
 - 30% 밝기로 트래킹 모션 실행
 
+=== 반응 트리거 (시리얼 115200, "!" + 코드) ===
+!s: 놀람 - 지금 화면에서 100%로 0.2초 블렌드, 0.8초 유지, 0.6초에 30%로 복귀
+!c: 30%로 0.2초 블렌드
+!o: 0.2초에 끄기
+!?: 트리거 → 첫 프레임 도착 지연 히스토그램 출력 (목표 2프레임 이내)
+
 === 색상 정의 ===
 30% 컬러: RGB(110, 110, 60)
 70% 컬러: RGB(140, 140, 60)
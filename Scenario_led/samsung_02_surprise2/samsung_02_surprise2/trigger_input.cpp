@@ -0,0 +1,100 @@
+// trigger_input.cpp - 반응 트리거 입력 구현
+
+#include "trigger_input.h"
+#include "control.h"
+
+// ================= 트리거 상태 =================
+static bool syncSeen = false;
+static uint8_t pendingCode = TRIGGER_NONE;
+static unsigned long pendingUs = 0;      // 마지막 트리거 수신 시각 (PowerStrip::nowUs() 기준)
+static unsigned long measureUs = 0;      // 측정 중인 트리거 수신 시각
+static bool measuring = false;
+
+// ================= 지연 히스토그램 =================
+static uint16_t latencyCounts[TRIGGER_HIST_BUCKETS];   // 마지막 칸 = 그 이상
+static uint16_t latencyTotal = 0;
+static uint16_t droppedTriggers = 0;    // 처리 전에 새 트리거로 덮인 수
+static unsigned long latencyMaxUs = 0;
+
+// ================= 입력 =================
+
+void triggerBegin() {
+  Serial.begin(TRIGGER_BAUDRATE);
+}
+
+// 대기 트리거가 여러 개면 마지막 것만 남김 (가장 최근 반응이 우선)
+bool triggerPoll() {
+  while(Serial.available() > 0) {
+    int c = Serial.read();
+    if(c == TRIGGER_SYNC) {
+      syncSeen = true;
+      continue;
+    }
+    if(!syncSeen) continue;
+    syncSeen = false;
+
+    if(c == TRIGGER_REPORT) {
+      triggerReport();
+    } else if(c == TRIGGER_SURPRISE || c == TRIGGER_CALM || c == TRIGGER_OFF) {
+      if(pendingCode != TRIGGER_NONE) droppedTriggers++;
+      pendingCode = (uint8_t)c;
+      pendingUs = PowerStrip::nowUs();
+    }
+  }
+  return pendingCode != TRIGGER_NONE;
+}
+
+uint8_t triggerTake() {
+  uint8_t code = pendingCode;
+  if(code != TRIGGER_NONE) {
+    pendingCode = TRIGGER_NONE;
+    measureUs = pendingUs;
+    measuring = true;
+  }
+  return code;
+}
+
+// ================= 지연 측정 =================
+
+// 도착 시각 = show 시작 + 계산한 전송 시간, 시각은 PowerStrip::nowUs() 기준이라
+// 트리거를 읽은 뒤 반응 프레임까지 지나간 블로킹 show()의 전송 시간도 들어감 (AVR은 그동안 micros()가 멈춤)
+void triggerPhoton(uint32_t wireUs) {
+  if(!measuring) return;
+  measuring = false;
+
+  unsigned long latencyUs = PowerStrip::nowUs() - measureUs + wireUs;
+  uint16_t bucket = latencyUs / TRIGGER_HIST_BUCKET_US;
+  if(bucket >= TRIGGER_HIST_BUCKETS) bucket = TRIGGER_HIST_BUCKETS - 1;
+  if(latencyCounts[bucket] < 0xFFFF) latencyCounts[bucket]++;
+  if(latencyTotal < 0xFFFF) latencyTotal++;
+  if(latencyUs > latencyMaxUs) latencyMaxUs = latencyUs;
+}
+
+// 목표(TRIGGER_TARGET_FRAMES 프레임) 안에 든 개수 (목표를 넘지 않는 칸까지만 셈)와 칸별 개수
+void triggerReport() {
+  uint32_t targetUs = strip.wireTimeUs() * TRIGGER_TARGET_FRAMES;
+  uint16_t withinTarget = 0;
+  for(uint8_t i = 0; i < TRIGGER_HIST_BUCKETS; i++) {
+    if((uint32_t)(i + 1) * TRIGGER_HIST_BUCKET_US <= targetUs) withinTarget += latencyCounts[i];
+  }
+
+  Serial.print("trigger latency n=");
+  Serial.print((unsigned int)latencyTotal);
+  Serial.print(" dropped=");
+  Serial.print((unsigned int)droppedTriggers);
+  Serial.print(" max_us=");
+  Serial.print(latencyMaxUs);
+  Serial.print(" target_us=");
+  Serial.print((unsigned long)targetUs);
+  Serial.print(" within=");
+  Serial.println((unsigned int)withinTarget);
+
+  for(uint8_t i = 0; i < TRIGGER_HIST_BUCKETS; i++) {
+    if(latencyCounts[i] == 0) continue;
+    Serial.print("  <");
+    if(i == TRIGGER_HIST_BUCKETS - 1) Serial.print("inf");
+    else Serial.print((unsigned long)(i + 1) * TRIGGER_HIST_BUCKET_US);
+    Serial.print(" us: ");
+    Serial.println((unsigned int)latencyCounts[i]);
+  }
+}
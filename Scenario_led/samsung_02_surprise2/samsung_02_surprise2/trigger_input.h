@@ -0,0 +1,30 @@
+// trigger_input.h - 반응 트리거 입력 (시리얼 2바이트 메시지)
+// 메시지: TRIGGER_SYNC + 코드 1바이트 (예: "!s" 놀람), 모르는 바이트는 건너뜀
+// 시퀀스는 프레임 경계(frameWait)마다 확인해서 트리거가 있으면 중단하고 반응으로 넘어감
+// 트리거 수신부터 반응 첫 프레임이 LED에 도착(전송 끝)할 때까지 지연을 히스토그램으로 기록
+// 시작은 triggerPoll()이 바이트를 읽은 시각: show() 중 도착한 바이트는 전송이 끝나야 읽히므로
+// 그 대기(최대 한 프레임 전송 시간)는 기기 히스토그램에서 빠짐 (AVR은 전송 중 도착 시각을 알 수 없음)
+
+#ifndef TRIGGER_INPUT_H
+#define TRIGGER_INPUT_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ===== 트리거 코드 =====
+#define TRIGGER_NONE      0
+#define TRIGGER_SURPRISE  's'   // 100%로 번쩍 후 30%로 복귀
+#define TRIGGER_CALM      'c'   // 30%로 전환
+#define TRIGGER_OFF       'o'   // 끄기
+#define TRIGGER_REPORT    '?'   // 지연 히스토그램 출력 (반응 없음)
+
+// ===== 입력 =====
+void triggerBegin();
+bool triggerPoll();                  // 시리얼 메시지 읽기, 처리 안 된 트리거가 있으면 true
+uint8_t triggerTake();               // 대기 트리거 꺼냄 (지연 측정 시작), 없으면 TRIGGER_NONE
+
+// ===== 지연 측정 =====
+void triggerPhoton(uint32_t wireUs); // 반응 프레임 show() 직전 호출 (측정 중인 첫 프레임만 기록)
+void triggerReport();                // 지연 히스토그램 시리얼 출력
+
+#endif
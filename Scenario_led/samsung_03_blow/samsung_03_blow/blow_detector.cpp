@@ -0,0 +1,208 @@
+// blow_detector.cpp - 마이크 입김 감지 구현
+
+#include "blow_detector.h"
+
+#if BLOW_FFT_SIZE != 128
+#error "blow_detector 표는 128점 기준"
+#endif
+
+// ================= PROGMEM 표 =================
+// sin(2πk/128) Q15, k = 0 ~ 32 (4분의 1 주기, 나머지는 대칭)
+static const int16_t quarterSine[BLOW_FFT_SIZE / 4 + 1] PROGMEM = {
+  0, 1608, 3212, 4808, 6393, 7962, 9512, 11039, 12539, 14010, 15446,
+  16846, 18204, 19519, 20787, 22005, 23170, 24279, 25329, 26319, 27245, 28105,
+  28898, 29621, 30273, 30852, 31356, 31785, 32137, 32412, 32609, 32728, 32767,
+};
+
+// 한 창(Hann) 0.5(1 - cos(2πn/128)) Q15, n = 0 ~ 64 (뒤 절반은 대칭)
+static const int16_t hannWindow[BLOW_FFT_SIZE / 2 + 1] PROGMEM = {
+  0, 20, 79, 177, 315, 491, 705, 958, 1247, 1573, 1935,
+  2331, 2761, 3224, 3719, 4244, 4799, 5381, 5990, 6624, 7281, 7961,
+  8660, 9379, 10114, 10864, 11628, 12403, 13187, 13980, 14778, 15580, 16383,
+  17187, 17989, 18787, 19580, 20364, 21139, 21903, 22653, 23388, 24107, 24806,
+  25486, 26143, 26777, 27386, 27968, 28523, 29048, 29543, 30006, 30436, 30832,
+  31194, 31520, 31809, 32062, 32276, 32452, 32590, 32688, 32747, 32767,
+};
+
+// ================= 상태 =================
+static int16_t sampleRe[BLOW_FFT_SIZE];   // 모을 때는 ADC 값, 분석 때는 FFT 실수부
+static int16_t sampleIm[BLOW_FFT_SIZE];
+static uint8_t sampleCount = 0;
+static unsigned long nextSampleUs = 0;
+
+static uint32_t floorEnergy = 0;          // 0 = 아직 첫 창 전
+static uint8_t loudWindows = 0;           // 조건을 만족한 연속 창 수
+static bool fired = false;                // 이번 입김을 이미 알림 (조건이 풀릴 때까지)
+static unsigned long quietUntilMs = 0;    // 불응 시간 끝
+
+static BlowWindow lastWindow;
+
+// 분석 시간 통계
+static uint16_t windowCount = 0;
+static uint32_t analysisSumUs = 0;
+static unsigned long analysisMaxUs = 0;
+
+// ================= 고정소수점 FFT =================
+
+static int16_t sineQ15(uint8_t k) {       // sin(2πk/N), k < N/2
+  return (int16_t)pgm_read_word(&quarterSine[k <= BLOW_FFT_SIZE / 4 ? k : BLOW_FFT_SIZE / 2 - k]);
+}
+
+static int16_t cosineQ15(uint8_t k) {     // cos(2πk/N), k < N/2
+  if(k <= BLOW_FFT_SIZE / 4) return sineQ15(BLOW_FFT_SIZE / 4 - k);
+  return -sineQ15(k - BLOW_FFT_SIZE / 4);
+}
+
+// 비트 역순 재배치 후 시간 솎음(DIT) 나비 연산, 단계마다 1/2 스케일
+void blowFft(int16_t* re, int16_t* im) {
+  for(uint8_t i = 1, j = 0; i < BLOW_FFT_SIZE; i++) {
+    uint8_t bit = BLOW_FFT_SIZE >> 1;
+    for(; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if(i < j) {
+      int16_t t = re[i]; re[i] = re[j]; re[j] = t;
+      t = im[i]; im[i] = im[j]; im[j] = t;
+    }
+  }
+
+  for(uint16_t size = 2; size <= BLOW_FFT_SIZE; size <<= 1) {
+    uint8_t half = size >> 1;
+    uint8_t step = BLOW_FFT_SIZE / size;
+    for(uint8_t k = 0; k < half; k++) {
+      int16_t wr = cosineQ15(k * step);
+      int16_t wi = -sineQ15(k * step);     // W = e^(-j2πk/size)
+      for(uint8_t i = k; i < BLOW_FFT_SIZE; i += size) {
+        uint8_t j = i + half;
+        int32_t tr = ((int32_t)re[j] * wr - (int32_t)im[j] * wi) >> 15;
+        int32_t ti = ((int32_t)re[j] * wi + (int32_t)im[j] * wr) >> 15;
+        int32_t ar = re[i];
+        int32_t ai = im[i];
+        re[i] = (int16_t)((ar + tr) >> 1);
+        im[i] = (int16_t)((ai + ti) >> 1);
+        re[j] = (int16_t)((ar - tr) >> 1);
+        im[j] = (int16_t)((ai - ti) >> 1);
+      }
+    }
+  }
+}
+
+// ================= 창 분석 =================
+
+// 평균(DC) 제거 → ±16384 스케일 → 한 창 → FFT → 대역 에너지
+static bool analyzeWindow() {
+  unsigned long startUs = micros();
+
+  int32_t sum = 0;
+  for(uint8_t i = 0; i < BLOW_FFT_SIZE; i++) sum += sampleRe[i];
+  int16_t mean = (int16_t)(sum >> BLOW_FFT_BITS);
+  for(uint8_t i = 0; i < BLOW_FFT_SIZE; i++) {
+    int16_t v = constrain(sampleRe[i] - mean, -511, 511) << 5;   // 10비트 ADC → ±16352
+    int16_t w = (int16_t)pgm_read_word(&hannWindow[i <= BLOW_FFT_SIZE / 2 ? i : BLOW_FFT_SIZE - i]);
+    sampleRe[i] = (int16_t)(((int32_t)v * w) >> 15);
+    sampleIm[i] = 0;
+  }
+  blowFft(sampleRe, sampleIm);
+
+  uint32_t band = 0;
+  uint32_t total = 0;
+  for(uint8_t b = 1; b < BLOW_FFT_SIZE / 2; b++) {
+    uint32_t e = ((uint32_t)((int32_t)sampleRe[b] * sampleRe[b]) + (uint32_t)((int32_t)sampleIm[b] * sampleIm[b])) >> 2;
+    total += e;
+    if(b >= BLOW_BAND_LOW && b <= BLOW_BAND_HIGH) band += e;
+  }
+
+  // 조건: 바닥의 BLOW_RATIO배, 절대 하한, 대역 비율 (곱셈 넘침 없도록 나눗셈으로 비교)
+  if(floorEnergy == 0) floorEnergy = band > BLOW_FLOOR_MIN ? band : BLOW_FLOOR_MIN;
+  bool loud = band / BLOW_RATIO > floorEnergy && band > BLOW_MIN_ENERGY &&
+              band >= total / 100 * BLOW_BAND_SHARE;
+  bool quiet = (long)(millis() - quietUntilMs) < 0;
+
+  if(loud) {
+    if(loudWindows < 255) loudWindows++;
+  } else {
+    loudWindows = 0;
+    fired = false;
+    // 잡음 바닥: 올라갈 때는 느리게, 내려갈 때는 빠르게 (불응 시간의 입김 꼬리는 제외)
+    if(!quiet) {
+      if(band > floorEnergy) floorEnergy += (band - floorEnergy) >> BLOW_FLOOR_RISE_SHIFT;
+      else floorEnergy -= (floorEnergy - band) >> BLOW_FLOOR_SHIFT;
+      if(floorEnergy < BLOW_FLOOR_MIN) floorEnergy = BLOW_FLOOR_MIN;
+    }
+  }
+
+  bool onset = loud && !fired && !quiet && loudWindows >= BLOW_ONSET_WINDOWS;
+  if(onset) fired = true;
+
+  unsigned long us = micros() - startUs;
+  lastWindow.bandEnergy = band;
+  lastWindow.totalEnergy = total;
+  lastWindow.floorEnergy = floorEnergy;
+  lastWindow.loud = loud;
+  lastWindow.analysisUs = us;
+  if(windowCount < 65535) {
+    windowCount++;
+    analysisSumUs += us;
+  }
+  if(us > analysisMaxUs) analysisMaxUs = us;
+  return onset;
+}
+
+// ================= 감지 =================
+
+void blowBegin() {
+  sampleCount = 0;
+  floorEnergy = 0;
+  loudWindows = 0;
+  fired = false;
+  quietUntilMs = millis();
+  windowCount = 0;
+  analysisSumUs = 0;
+  analysisMaxUs = 0;
+  nextSampleUs = micros();
+}
+
+bool blowPoll() {
+  unsigned long now = micros();
+  if((long)(now - nextSampleUs) < 0) return false;
+
+  // 샘플 간격보다 크게 밀렸으면 (LED 출력 등) 창을 처음부터 다시
+  if((long)(now - nextSampleUs) > (long)BLOW_SAMPLE_US) sampleCount = 0;
+  nextSampleUs = (sampleCount == 0 ? now : nextSampleUs) + BLOW_SAMPLE_US;
+
+  sampleRe[sampleCount++] = analogRead(BLOW_MIC_PIN);
+  if(sampleCount < BLOW_FFT_SIZE) return false;
+
+  sampleCount = 0;
+  bool onset = analyzeWindow();
+  nextSampleUs = micros();
+  return onset;
+}
+
+void blowResume() {
+  sampleCount = 0;
+  loudWindows = 0;
+  quietUntilMs = millis() + BLOW_REFRACTORY_MS;
+  nextSampleUs = micros();
+}
+
+const BlowWindow& blowLastWindow() {
+  return lastWindow;
+}
+
+// 사이클 = us × (F_CPU / 1MHz), micros() 해상도(AVR 4us) 안에서
+void blowReport() {
+  unsigned long meanUs = windowCount ? analysisSumUs / windowCount : 0;
+  unsigned long cyclesPerUs = F_CPU / 1000000UL;
+  Serial.print("blow windows=");
+  Serial.print((unsigned int)windowCount);
+  Serial.print(" window_us=");
+  Serial.print((unsigned long)BLOW_FFT_SIZE * BLOW_SAMPLE_US);
+  Serial.print(" analysis_mean_us=");
+  Serial.print(meanUs);
+  Serial.print(" cycles=");
+  Serial.print(meanUs * cyclesPerUs);
+  Serial.print(" max_us=");
+  Serial.print(analysisMaxUs);
+  Serial.print(" cycles=");
+  Serial.println(analysisMaxUs * cyclesPerUs);
+}
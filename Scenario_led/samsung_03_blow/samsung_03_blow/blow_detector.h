@@ -0,0 +1,36 @@
+// blow_detector.h - 마이크 입김 감지 (고정소수점 radix-2 FFT + 대역 에너지)
+// BLOW_SAMPLE_US 간격으로 BLOW_FFT_SIZE개를 모은 창마다 FFT 후 저역 대역 에너지를 잡음 바닥과 비교
+// 입김은 저역에 몰린 광대역 잡음: 대역 에너지가 바닥의 BLOW_RATIO배 이상이고 전체의 BLOW_BAND_SHARE% 이상인
+// 창이 BLOW_ONSET_WINDOWS개 이어지면 한 번 감지 (float 없음, 회전 인자/창 함수는 PROGMEM 표)
+// 분석 중에는 샘플링을 멈추고 끝나면 새 창을 시작 (창 사이 틈은 감지에 영향 없음)
+
+#ifndef BLOW_DETECTOR_H
+#define BLOW_DETECTOR_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#define BLOW_FFT_BITS  7
+#define BLOW_FFT_SIZE  (1 << BLOW_FFT_BITS)   // 회전 인자/창 표가 128점 기준
+
+// ===== 감지 =====
+void blowBegin();            // 잡음 바닥/통계 초기화, 샘플링 시작
+bool blowPoll();             // 샘플 시각이면 한 샘플, 창이 차면 분석, 입김 시작 창이면 true
+void blowResume();           // 반응(펄스) 뒤 다시 듣기: 모으던 창 버리고 불응 시간 시작
+void blowReport();           // 창 분석 시간 (us, CPU 사이클) 시리얼 출력
+
+// ===== 검증/추적용 =====
+// FFT: re/im 각 BLOW_FFT_SIZE개, 제자리 변환, 단계마다 1/2 스케일 (결과 = DFT / N)
+// 입력 크기는 ±16384 이내 (넘치지 않는 범위)
+void blowFft(int16_t* re, int16_t* im);
+
+struct BlowWindow {
+  uint32_t bandEnergy;       // BLOW_BAND_LOW ~ BLOW_BAND_HIGH 빈 에너지 합
+  uint32_t totalEnergy;      // 1 ~ N/2-1 빈 에너지 합
+  uint32_t floorEnergy;      // 분석 당시 잡음 바닥
+  bool loud;                 // 입김 조건을 만족한 창
+  unsigned long analysisUs;
+};
+const BlowWindow& blowLastWindow();
+
+#endif
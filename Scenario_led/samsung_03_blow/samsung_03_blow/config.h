@@ -13,4 +13,30 @@
 // NeoPixel 타입 설정
 #define PIXEL_TYPE (NEO_GRB + NEO_KHZ800)
 
+// 전류 제한 (power_strip.cpp)
+// 예산을 넘는 프레임만 밝기를 낮추고 이후 프레임마다 POWER_RELEASE_STEP씩 회복
+#ifndef POWER_LIMIT_MA
+#define POWER_LIMIT_MA 2500       // LED 전체 전류 예산 (mA), 0이면 제한 안 함
+#endif
+#define LED_CHANNEL_MA 20         // 채널 하나 최대 전류 (전송 값 255 기준)
+#define LED_IDLE_MA 1             // LED 하나 대기 전류
+#define POWER_RELEASE_STEP 2      // 프레임당 밝기 회복량
+
+// 입김 감지 모드 (blow_detector.cpp)
+// 켜면 고정 시퀀스 대신 30%로 켜 두고 마이크로 입김을 감지할 때마다 30% → 100% → 30% 펄스
+// #define BLOW_DETECT_MODE
+#define BLOW_MIC_PIN        A0
+#define BLOW_SAMPLE_US      250       // 샘플 간격 (4 kHz, 128점 창 = 32 ms, 빈 간격 31.25 Hz)
+#define BLOW_BAND_LOW       2         // 입김 대역 시작 빈 (62 Hz)
+#define BLOW_BAND_HIGH      16        // 입김 대역 끝 빈 (500 Hz, 말소리 첫 포먼트 아래)
+#define BLOW_RATIO          8         // 대역 에너지 / 잡음 바닥 하한
+#define BLOW_BAND_SHARE     40        // 전체 에너지 중 대역 비율 하한 (%)
+#define BLOW_MIN_ENERGY     20000     // 대역 에너지 절대 하한 (조용한 방에서 작은 소리 무시)
+#define BLOW_FLOOR_MIN      200       // 잡음 바닥 하한
+#define BLOW_FLOOR_SHIFT    4         // 잡음 바닥이 내려갈 때 추종 속도 (창마다 1/16)
+#define BLOW_FLOOR_RISE_SHIFT 7       // 올라갈 때 추종 속도 (1/128, 말소리 등 짧은 소리에 덜 끌려감)
+#define BLOW_ONSET_WINDOWS  2         // 연속 창 수 (64 ms)
+#define BLOW_REFRACTORY_MS  400       // 펄스 뒤 다시 감지하지 않는 시간
+#define BLOW_PULSE_HOLD_MS  500       // 100% 유지 시간 (sequence20sec_v2 첫 입김과 같음)
+
 #endif
@@ -1,9 +1,10 @@
 // control.cpp - LED 제어 함수 구현
 
 #include "control.h"
+#include "wipe_engine.h"
 
 //================= NeoPixel 객체 =================
-Adafruit_NeoPixel strip(LED_COUNT, LED_PIN, PIXEL_TYPE);
+PowerStrip strip(LED_COUNT, LED_PIN, PIXEL_TYPE);
 
 //================= 초기화 함수 =================
 void initNeoPixel() {
@@ -16,9 +17,7 @@ void initNeoPixel() {
 
 // 모든 LED 켜기 (512개 전체)
 void turnOnAllLED(int red, int green, int blue) {
-  for(int i = 0; i < LED_COUNT; i++) {
-    strip.setPixelColor(i, strip.Color(red, green, blue));
-  }
+  strip.fill(strip.Color(red, green, blue));
   strip.show();
 }
 
@@ -93,121 +92,33 @@ void sequence27sec() {
 }
 
 //================= 개별 픽셀 페이드 함수 =================
+// 와이프 엔진 사용: show()를 픽셀마다 부르지 않고 프레임마다 필요한 만큼 공개
 void individualPixelFade(int red, int green, int blue, 
                          bool fadeIn, int durationMs) {
-  int pixelDelay = durationMs / LED_COUNT;
-  if(pixelDelay < 1) pixelDelay = 1;
-  
+  WipeStyle style = { 1, 0 };
   if(fadeIn) {
     strip.clear();
-    strip.show();
-    
-    for(int i = 0; i < LED_COUNT; i++) {
-      strip.setPixelColor(i, strip.Color(red, green, blue));
-      strip.show();
-      delay(pixelDelay);
-    }
-  } else {
-    for(int i = LED_COUNT - 1; i >= 0; i--) {
-      strip.setPixelColor(i, 0);
-      strip.show();
-      delay(pixelDelay);
-    }
   }
+  runWipe(strip, red, green, blue, fadeIn, durationMs, style);
 }
 
 //================= 웨이브 페이드 함수 =================
+// 20픽셀 블록 단위로 경계 이동
 void waveFade(int red, int green, int blue, 
               bool fadeIn, int durationMs) {
-  int waveSize = 20;
-  int steps = LED_COUNT / waveSize;
-  int stepDelay = durationMs / steps;
-  
+  WipeStyle style = { 20, 0 };
   if(fadeIn) {
     strip.clear();
-    for(int step = 0; step < steps; step++) {
-      int startIdx = step * waveSize;
-      int endIdx = min(startIdx + waveSize, LED_COUNT);
-      
-      for(int i = startIdx; i < endIdx; i++) {
-        strip.setPixelColor(i, strip.Color(red, green, blue));
-      }
-      strip.show();
-      delay(stepDelay);
-    }
-    for(int i = 0; i < LED_COUNT; i++) {
-      strip.setPixelColor(i, strip.Color(red, green, blue));
-    }
-    strip.show();
-  } else {
-    for(int step = 0; step < steps; step++) {
-      int startIdx = LED_COUNT - ((step + 1) * waveSize);
-      int endIdx = LED_COUNT - (step * waveSize);
-      
-      for(int i = max(startIdx, 0); i < endIdx; i++) {
-        strip.setPixelColor(i, 0);
-      }
-      strip.show();
-      delay(stepDelay);
-    }
-    strip.clear();
-    strip.show();
   }
+  runWipe(strip, red, green, blue, fadeIn, durationMs, style);
 }
 
 //================= 그라데이션 페이드 함수 =================
+// 경계 앞뒤 10픽셀 부드러운 가장자리, 이미 켜진 픽셀은 다시 쓰지 않음
 void gradientFade(int red, int green, int blue, 
                   bool fadeIn, int durationMs) {
-  int steps = 100;
-  int stepDelay = durationMs / steps;
-  
-  if(fadeIn) {
-    for(int step = 0; step <= steps; step++) {
-      float progress = (float)step / steps;
-      int activePixels = (int)(LED_COUNT * progress);
-      
-      for(int i = 0; i < activePixels; i++) {
-        strip.setPixelColor(i, strip.Color(red, green, blue));
-      }
-      
-      int fadeZone = 10;
-      for(int i = 0; i < fadeZone && (activePixels + i) < LED_COUNT; i++) {
-        float fadeFactor = 1.0 - ((float)i / fadeZone);
-        int fadedR = (int)(red * fadeFactor);
-        int fadedG = (int)(green * fadeFactor);
-        int fadedB = (int)(blue * fadeFactor);
-        strip.setPixelColor(activePixels + i, strip.Color(fadedR, fadedG, fadedB));
-      }
-      
-      strip.show();
-      delay(stepDelay);
-    }
-  } else {
-    for(int step = 0; step <= steps; step++) {
-      float progress = (float)step / steps;
-      int remainingPixels = (int)(LED_COUNT * (1.0 - progress));
-      
-      strip.clear();
-      for(int i = 0; i < remainingPixels; i++) {
-        strip.setPixelColor(i, strip.Color(red, green, blue));
-      }
-      
-      int fadeZone = 10;
-      for(int i = 0; i < fadeZone && (remainingPixels - fadeZone + i) >= 0; i++) {
-        float fadeFactor = (float)i / fadeZone;
-        int fadedR = (int)(red * fadeFactor);
-        int fadedG = (int)(green * fadeFactor);
-        int fadedB = (int)(blue * fadeFactor);
-        int pixelIdx = remainingPixels - fadeZone + i;
-        if(pixelIdx >= 0) {
-          strip.setPixelColor(pixelIdx, strip.Color(fadedR, fadedG, fadedB));
-        }
-      }
-      
-      strip.show();
-      delay(stepDelay);
-    }
-  }
+  WipeStyle style = { 1, 10 };
+  runWipe(strip, red, green, blue, fadeIn, durationMs, style);
 }
 
 //================= 새로운 20초 시퀀스 (OFF에서 시작) =================
@@ -287,4 +198,19 @@ void sequence20sec_v2() {
   // === 12.2초-20초: 30% 유지 (7.8초) ===
   turnOnAllLED(color30_R, color30_G, color30_B);
   delay(7800);
+}
+
+//================= 입김 반응 펄스 =================
+// sequence20sec_v2의 입김 한 번: 30% → 100% (0.2초) → 유지 → 100% → 30% (0.2초)
+void blowPulse() {
+  int color30_R = 110, color30_G = 110, color30_B = 60;  // 30% 컬러
+  int color100_R = 180, color100_G = 180, color100_B = 70; // 100% 컬러
+
+  linearFadeShort(color30_R, color30_G, color30_B,
+                  color100_R, color100_G, color100_B, 200);
+  turnOnAllLED(color100_R, color100_G, color100_B);
+  delay(BLOW_PULSE_HOLD_MS);
+  linearFadeShort(color100_R, color100_G, color100_B,
+                  color30_R, color30_G, color30_B, 200);
+  turnOnAllLED(color30_R, color30_G, color30_B);
 }
\ No newline at end of file
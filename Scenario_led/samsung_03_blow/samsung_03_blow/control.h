@@ -5,6 +5,7 @@
 
 #include <Adafruit_NeoPixel.h>
 #include "config.h"
+#include "power_strip.h"
 
 // 초기화 함수
 void initNeoPixel();
@@ -42,4 +43,7 @@ void sequence20sec();
 // 20초 시퀀스 v2 - 30%에서 시작
 void sequence20sec_v2();
 
+// 입김 반응 펄스 (BLOW_DETECT_MODE) - 30% → 100% → 30%
+void blowPulse();
+
 #endif
\ No newline at end of file
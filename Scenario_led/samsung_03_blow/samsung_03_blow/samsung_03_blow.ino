@@ -1,14 +1,32 @@
 // led_color_test.ino - 메인 실행 파일
 
 #include "control.h"
+#ifdef BLOW_DETECT_MODE
+#include "blow_detector.h"
+#endif
 
 void setup() {
   Serial.begin(115200);
   Serial.println("LED 27초 시퀀스 시작");
   
   initNeoPixel();  // NeoPixel 초기화
+
+#ifdef BLOW_DETECT_MODE
+  turnOnAllLED(110, 110, 60);  // 30%에서 입김 대기
+  blowBegin();
+#endif
 }
 
+#ifdef BLOW_DETECT_MODE
+// 입김 감지 모드: 감지할 때마다 펄스, 끝나면 분석 시간 출력
+void loop() {
+  if(blowPoll()) {
+    blowPulse();
+    blowResume();
+    blowReport();
+  }
+}
+#else
 void loop() {
   static bool done = false;
   
@@ -35,6 +53,7 @@ void loop() {
     // sequence27sec();    // 27초 버전
   }
 }
+#endif
 
 /*
 타이밍:
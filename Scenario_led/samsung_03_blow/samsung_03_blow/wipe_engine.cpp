@@ -0,0 +1,76 @@
+// wipe_engine.cpp - 시간 예산 와이프 엔진 구현
+
+#include "wipe_engine.h"
+
+//================= 픽셀 밝기 =================
+// 경계 head 기준 픽셀 p의 밝기 (0~256)
+// fadeIn: head 앞은 켜짐, head부터 edge개는 점점 어두워짐
+// fadeOut: head 앞 edge개는 점점 밝아지다가 head부터 꺼짐 (기존 gradientFade와 같은 모양)
+static uint16_t wipeLevel(int p, int head, bool fadeIn, uint8_t edge) {
+  if(fadeIn) {
+    if(p < head) return 256;
+    if(p < head + edge) return (uint16_t)(256 * (edge - (p - head)) / edge);
+    return 0;
+  }
+  if(p < head - edge) return 256;
+  if(p < head) return (uint16_t)(256 * (p - (head - edge)) / edge);
+  return 0;
+}
+
+static void writeSpan(PowerStrip& target, int from, int to, int head, bool fadeIn, uint8_t edge,
+                      uint8_t red, uint8_t green, uint8_t blue) {
+  if(from < 0) from = 0;
+  if(to > target.numPixels()) to = target.numPixels();
+  for(int p = from; p < to; p++) {
+    uint16_t level = wipeLevel(p, head, fadeIn, edge);
+    target.setPixelColor(p, (red * level) >> 8, (green * level) >> 8, (blue * level) >> 8);
+  }
+}
+
+// k번째 프레임의 경계 (step 단위로 내림)
+static int wipeHead(int count, uint16_t frame, uint16_t frames, bool fadeIn, uint8_t step) {
+  int done = (int)((uint32_t)count * frame / frames);
+  if(frame < frames) done -= done % step;
+  return fadeIn ? done : count - done;
+}
+
+static void waitMicros(uint32_t us) {
+  if(us >= 1000) delay(us / 1000);
+  delayMicroseconds(us % 1000);
+}
+
+//================= 와이프 실행 =================
+void runWipe(PowerStrip& target, uint8_t red, uint8_t green, uint8_t blue,
+             bool fadeIn, uint16_t durationMs, WipeStyle style) {
+  int count = target.numPixels();
+  if(style.step == 0) style.step = 1;
+
+  // 전송 시간으로 들어갈 수 있는 프레임 수와 프레임 간격
+  uint32_t wireUs = target.wireTimeUs();
+  uint32_t totalUs = (uint32_t)durationMs * 1000;
+  uint16_t frames = totalUs / wireUs;
+  if(frames < 1) frames = 1;
+  uint32_t slotUs = totalUs / frames;
+
+  int head = fadeIn ? 0 : count;
+  for(uint16_t k = 1; k <= frames; k++) {
+    uint32_t renderStart = micros();
+    int next = wipeHead(count, k, frames, fadeIn, style.step);
+
+    // 첫 프레임은 시작 상태 전체, 이후는 바뀐 구간만
+    bool changed = (k == 1) || next != head;
+    if(changed) {
+      int from = (k == 1) ? 0 : min(head, next) - style.edge;
+      int to = max(head, next) + style.edge;
+      writeSpan(target, from, to, next, fadeIn, style.edge, red, green, blue);
+      head = next;
+    }
+    uint32_t spentUs = micros() - renderStart;
+
+    if(changed) {
+      target.show();
+      spentUs += wireUs;
+    }
+    if(spentUs < slotUs) waitMicros(slotUs - spentUs);
+  }
+}
@@ -0,0 +1,20 @@
+// wipe_engine.h - 시간 예산 와이프 엔진
+// 목표 시간과 전송 시간으로 프레임 수를 먼저 정하고, 프레임마다 공개할 픽셀 수를 계산
+// 지난 프레임과 달라진 구간(경계 이동분 + 부드러운 가장자리)만 다시 씀
+
+#ifndef WIPE_ENGINE_H
+#define WIPE_ENGINE_H
+
+#include "power_strip.h"
+
+// ===== 와이프 모양 =====
+struct WipeStyle {
+  uint8_t step;   // 경계 이동 단위 (픽셀, 1 = 개별 픽셀, 20 = 웨이브 블록)
+  uint8_t edge;   // 부드러운 가장자리 폭 (픽셀, 0 = 딱 끊김)
+};
+
+// fadeIn: 0번부터 채움, fadeOut: 끝에서부터 끔, 정확히 durationMs 후 반환
+void runWipe(PowerStrip& target, uint8_t red, uint8_t green, uint8_t blue,
+             bool fadeIn, uint16_t durationMs, WipeStyle style);
+
+#endif
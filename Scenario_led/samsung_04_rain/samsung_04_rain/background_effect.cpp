@@ -32,6 +32,9 @@ void updateRainWithBackground() {
   // 4. 그라데이션 빗방울 그리기
   drawRaindrops();  // 실제로는 drawGradientRaindrops() 호출
   
-  // 5. 화면 업데이트
-  strip.show();
+  // 5. 빗방울 빛 번짐 (그린 빗방울의 행/열만)
+  applyRainGlow();
+  
+  // 6. 전송 시작 (전송되는 동안 다음 프레임 계산)
+  strip.beginShow();
 }
\ No newline at end of file
@@ -1,11 +1,15 @@
 // cloud_effect.cpp - 먹구름 모션 효과 (대기시간 제거)
+// 구름 위치는 구간별 고정 스텝(빠름 CLOUD_FAST_FPS / 느림 CLOUD_SLOW_FPS ms)으로만 진행하고
+// 호출될 때마다 직전 스텝 위치와 보간해서 그림 (sim_clock.h)
 
 #include "cloud_effect.h"
 #include "control.h"
+#include "sim_clock.h"
 
 // ================= 먹구름 모션 효과 변수 =================
 static float cloudOffset = -6.0f;        // 구름 패턴 Y 오프셋 (화면 위에서 시작)
-static unsigned long lastCloudUpdateMs = 0;
+static float previousCloudOffset = -6.0f; // 직전 스텝 오프셋 (그리기 보간용)
+static SimClock cloudClock;
 static int cloudCycleCount = 0;          // 현재 사이클 횟수 (0~1, 총 2번)
 
 // 먹구름 패턴 배열
@@ -27,18 +31,20 @@ const uint8_t cloudPattern[CLOUD_PATTERN_HEIGHT][MATRIX_WIDTH] PROGMEM = {
 // 먹구름 효과 초기화
 void initCloudMotion() {
   cloudOffset = -(float)CLOUD_PATTERN_HEIGHT;  // 화면 위에서 시작
-  lastCloudUpdateMs = millis();
+  previousCloudOffset = cloudOffset;
+  simClockBegin(&cloudClock, CLOUD_FAST_FPS * 1000UL);
   cloudCycleCount = 0;
 }
 
-// 먹구름 효과 패턴 그리기
+// 먹구름 효과 패턴 그리기 (직전 스텝과 현재 스텝 사이 보간 위치)
 void drawCloudPattern() {
   clearMatrix();
+  float offset = simClockLerp(previousCloudOffset, cloudOffset, simClockAlpha(&cloudClock));
   
   for(int y = 0; y < MATRIX_HEIGHT; y++) {
     for(int x = 0; x < MATRIX_WIDTH; x++) {
       // 현재 화면 Y 위치에서 패턴의 어느 줄에 해당하는지 계산
-      float patternY = y - cloudOffset;
+      float patternY = y - offset;
       
       // 패턴 범위 내에 있는지 확인
       if(patternY >= 0 && patternY < CLOUD_PATTERN_HEIGHT) {
@@ -51,48 +57,52 @@ void drawCloudPattern() {
     }
   }
   
-  strip.show();
+  strip.beginShow();
 }
 
-// 먹구름 모션 업데이트 (Y축: 위에서 아래로)
-void updateCloudMotion() {
-  unsigned long currentTime = millis();
-  
-  // 더 빠른 업데이트 주기
-  unsigned long frameInterval;
+// y=2 근처에서만 약간 느리게, 나머지는 빠르게
+static bool isCloudSlowZone() {
   float bottomLinePosition = cloudOffset + CLOUD_PATTERN_HEIGHT - 1;  // 패턴의 아래쪽 위치
+  return bottomLinePosition >= 1.5f && bottomLinePosition <= 2.5f;
+}
+
+// 먹구름 한 스텝 (Y축: 위에서 아래로)
+static void stepCloudMotion(bool slow) {
+  previousCloudOffset = cloudOffset;
   
-  // y=2 근처에서만 약간 느리게, 나머지는 빠르게
-  if(bottomLinePosition >= 1.5f && bottomLinePosition <= 2.5f) {
-    frameInterval = CLOUD_SLOW_FPS;  // 느린 프레임률
+  // 이동 속도 (아래로 이동)
+  if(slow) {
+    cloudOffset += CLOUD_SLOW_SPEED;  // 느리게
   } else {
-    frameInterval = CLOUD_FAST_FPS;  // 빠른 프레임률
+    cloudOffset += CLOUD_FAST_SPEED;   // 빠르게
   }
   
-  if(currentTime - lastCloudUpdateMs >= frameInterval) {
-    lastCloudUpdateMs = currentTime;
+  // 패턴이 완전히 벗어나면 즉시 다음 사이클 시작 (대기 없음, 보간 없이 바로 위로)
+  if(cloudOffset > MATRIX_HEIGHT) {  // 화면 아래로 벗어남
+    cloudCycleCount++;
     
-    // 이동 속도 (아래로 이동)
-    if(bottomLinePosition >= 1.5f && bottomLinePosition <= 2.5f) {
-      cloudOffset += CLOUD_SLOW_SPEED;  // 느리게
-    } else {
-      cloudOffset += CLOUD_FAST_SPEED;   // 빠르게
-    }
-    
-    // 패턴이 완전히 벗어나면 즉시 다음 사이클 시작 (대기 없음)
-    if(cloudOffset > MATRIX_HEIGHT) {  // 화면 아래로 벗어남
-      cloudCycleCount++;
-      
-      if(cloudCycleCount < CLOUD_CYCLES) {
-        // 대기 없이 즉시 다시 시작
-        cloudOffset = -(float)CLOUD_PATTERN_HEIGHT;
-      }
+    if(cloudCycleCount < CLOUD_CYCLES) {
+      // 대기 없이 즉시 다시 시작
+      cloudOffset = -(float)CLOUD_PATTERN_HEIGHT;
+      previousCloudOffset = cloudOffset;
     }
-    
-    drawCloudPattern();
   }
 }
 
+// 먹구름 모션 업데이트: 밀린 스텝 진행 후 보간해서 그림
+void updateCloudMotion() {
+  simClockAdvance(&cloudClock);
+  for(;;) {
+    // 스텝 간격은 현재 위치의 구간에 따라 (느린 구간은 간격도 김)
+    bool slow = isCloudSlowZone();
+    cloudClock.stepUs = (slow ? CLOUD_SLOW_FPS : CLOUD_FAST_FPS) * 1000UL;
+    if(!simClockStep(&cloudClock)) break;
+    stepCloudMotion(slow);
+  }
+  
+  drawCloudPattern();
+}
+
 // 먹구름 효과 사이클 완료 여부 확인
 bool isCloudMotionComplete() {
   return (cloudCycleCount >= CLOUD_CYCLES && cloudOffset > MATRIX_HEIGHT);
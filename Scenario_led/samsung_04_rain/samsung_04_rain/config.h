@@ -21,6 +21,15 @@
 // 기본 밝기 설정 (0-255)
 #define DEFAULT_BRIGHTNESS 20     // 약 8% 밝기 (실내용)
 
+// ================= 전류 제한 설정 (power_strip.cpp) =================
+// 예산을 넘는 프레임(번개 전체 점등 등)만 밝기를 낮추고 이후 프레임마다 POWER_RELEASE_STEP씩 회복
+#ifndef POWER_LIMIT_MA
+#define POWER_LIMIT_MA 2500          // LED 전체 전류 예산 (mA), 0이면 제한 안 함
+#endif
+#define LED_CHANNEL_MA 20            // 채널 하나 최대 전류 (전송 값 255 기준)
+#define LED_IDLE_MA 1                // LED 하나 대기 전류
+#define POWER_RELEASE_STEP 2         // 프레임당 밝기 회복량
+
 // ================= 비 효과 설정 =================
 #define MAX_RAINDROPS 10         // 동시에 떨어지는 빗방울 최대 개수
 #define RAINDROP_LENGTH 6        // 빗방울 길이 (세로 6개 픽셀)
@@ -32,11 +41,39 @@
 #define CLOUD_PATTERN_HEIGHT 6   // 구름 패턴 높이
 #define CLOUD_SLOW_SPEED 0.08f   // 구름 느린 속도 (절반으로 감소)
 #define CLOUD_FAST_SPEED 0.3f    // 구름 빠른 속도 (감소)
-#define CLOUD_SLOW_FPS 30        // 구름 느린 프레임 간격 (ms)
-#define CLOUD_FAST_FPS 15        // 구름 빠른 프레임 간격 (ms)
+#define CLOUD_SLOW_FPS 30        // 구름 느린 구간 스텝 간격 (ms)
+#define CLOUD_FAST_FPS 15        // 구름 빠른 구간 스텝 간격 (ms)
 #define CLOUD_WAIT_TIME 0        // 구름 사이클 간 대기시간 제거 (0ms)
 #define CLOUD_CYCLES 2           // 구름 반복 횟수
 
+// ================= 시뮬레이션 설정 (sim_clock.cpp) =================
+// 빗방울/구름은 고정 간격 스텝으로만 움직이고, 그릴 때 직전 스텝과 보간 (속도가 프레임률과 무관)
+// 스텝 간격 = strip.wireTimeUs() (speed를 맞춘 예전 프레임 간격 = 한 프레임 전송 시간)
+#define RAIN_ACTIVATION_STEPS 96     // 새 빗방울 확인 간격 (스텝, 약 1.5초)
+#define SIM_MAX_CATCHUP_STEPS 8      // 한 번에 따라잡는 최대 스텝 수 (넘는 시간은 버림)
+
+// 그리기 간격: 0이면 loop()마다 그림 (전송 시간이 상한), 0보다 크면 이 간격으로만 그림
+// (번개 스트로브는 제외, 움직임 속도와 전환 시각은 그대로)
+#ifndef RENDER_FRAME_US
+#define RENDER_FRAME_US 0
+#endif
+
+// ================= 빛 번짐 설정 (glow_effect.cpp) =================
+// 빗방울 픽셀의 행/열만 가로/세로 running sum으로 흐려 원래 화면에 더함 (반지름과 무관하게 픽셀당 고정 비용)
+// 번개는 화면 전체를 한 색으로 채우므로 번질 가장자리가 없어서 적용하지 않음
+// 켜면 줄 버퍼 약 120B SRAM 추가 (픽셀 버퍼 1536B + 프로파일러와 함께 2KB 보드에서 avr-size로 확인 후 켤 것)
+#ifndef RAIN_GLOW_RADIUS
+#define RAIN_GLOW_RADIUS 0           // 번짐 반지름 (픽셀, 0이면 끔, 권장 2)
+#endif
+#define RAIN_GLOW_GAIN 160           // 더하는 세기 (256 = 흐린 값 그대로)
+#define RAIN_GLOW_KERNEL GLOW_TENT   // GLOW_BOX / GLOW_TENT
+#define GLOW_MAX_RADIUS 4            // 삼각형 최대 창 합 (r+1)^2 × 255가 uint16 안
+#define GLOW_TOP_ROW 2               // 번짐 영역 (하늘 0~1행, 땅 15행은 그대로)
+#define GLOW_BOTTOM_ROW 14
+// #define GLOW_BENCH_MODE          // 주석 해제시 시퀀스 대신 반지름 1~4 번짐 비용을 시리얼로 출력
+#define GLOW_BENCH_BAUDRATE 115200
+#define GLOW_BENCH_REPEAT 20         // 조합마다 반복 횟수
+
 // ================= 번개 효과 설정 =================
 #define LIGHTNING_TOGGLE_TIME 100    // 번개 토글 간격 (ms)
 #define LIGHTNING_FLASH_COUNT 3      // 번개 플래시 횟수
@@ -48,15 +85,45 @@
 #define LIGHTNING_OVERLAY_G 130      // 번개 오버레이 G
 #define LIGHTNING_OVERLAY_B 250      // 번개 오버레이 B
 
+// 번개 스트로브 (lightning_effect.cpp)
+// 1: 타임라인을 전송 시작 시각 목록으로 미리 계산해 그 시각에 맞춰 전송 (loop 간격과 무관, 실행마다 같은 화면)
+// 0: loop()마다 경과 시간으로 상태 확인 (전송 시간보다 짧은 번쩍임은 합쳐지거나 빠짐)
+#ifndef LIGHTNING_STROBE_MODE
+#define LIGHTNING_STROBE_MODE 1
+#endif
+#define LIGHTNING_MIN_HOLD_FRAMES 1  // 켜짐/꺼짐 최소 길이 (전송 프레임 수), 짧은 구간은 이만큼 늘림
+#define LIGHTNING_SPIN_US 8000       // 이벤트가 이 안에 있으면 기다렸다가 전송 (번개 중 loop 한 번보다 길게)
+#define LIGHTNING_LATE_US 250        // 이보다 늦게 시작한 전송은 지연으로 기록
+
 // ================= 배경 효과 설정 =================
 #define CROSSFADE_CYCLE_TIME 3000    // 크로스페이드 전체 사이클 (ms)
 #define PATTERN1_HOLD_TIME 1000      // 패턴1 유지 시간 (ms)
 #define PATTERN_FADE_TIME 500        // 패턴 전환 시간 (ms)
 #define PATTERN2_HOLD_TIME 1000      // 패턴2 유지 시간 (ms)
 
+// ================= 비 페이드인 설정 (fade_effect.cpp) =================
+// -1이면 화면 전체가 같이 밝아짐, 0~3이면 전환 필드 모양으로 드러남
+// (transition_effect.h TransitionField: 0 원형, 1 대각선, 2 열, 3 디졸브, 필드 표는 PROGMEM 2KB)
+#ifndef FADE_TO_RAIN_FIELD
+#define FADE_TO_RAIN_FIELD 0
+#endif
+
+// ================= 난수 설정 =================
+// 0이면 부팅마다 새 시드 (DEBUG_MODE에서 시리얼로 출력), 0이 아니면 항상 같은 비 효과
+#ifndef RAIN_RANDOM_SEED
+#define RAIN_RANDOM_SEED 0
+#endif
+
 // ================= 타이밍 설정 =================
 #define RAIN_DURATION 4000           // 비 효과 지속 시간 (ms)
 
+// ================= 프로파일러 설정 (profiler.cpp) =================
+// #define PROFILE_MODE             // 주석 해제시 프레임별 사이클/스택 측정 (시리얼로 'P' 수신 시 덤프)
+#define PROFILE_BAUDRATE 115200
+#define PROFILE_DUMP_COMMAND 'P'
+#define PROFILE_BUCKETS 12           // 히스토그램 버킷 수 (항목 8개 × 2바이트씩)
+#define PROFILE_BUCKET_SHIFT 10      // 첫 버킷 상한 2^10 사이클 (16MHz에서 64us)
+
 // ================= 디버깅 설정 =================
 // #define DEBUG_MODE               // 주석 해제시 시리얼 디버그 메시지 출력
 #ifdef DEBUG_MODE
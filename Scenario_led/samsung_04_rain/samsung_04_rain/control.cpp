@@ -3,7 +3,7 @@
 #include "control.h"
 
 //================= NeoPixel 객체 =================
-Adafruit_NeoPixel strip(LED_COUNT, LED_PIN, PIXEL_TYPE);
+PowerStrip strip(LED_COUNT, LED_PIN, PIXEL_TYPE);
 
 //================= 초기화 함수 =================
 void initNeoPixel() {
@@ -70,6 +70,10 @@ void overlayColorAlpha(uint8_t targetR, uint8_t targetG, uint8_t targetB, float
   if (alpha <= 0.0f) return;
   if (alpha > 1.0f) alpha = 1.0f;
 
+#ifdef NEO_OVERLAY_COLOR
+  // 호스트 합성 커널 (렌더 데몬): 아래 픽셀 루프와 같은 결과
+  strip.overlayColor(targetR, targetG, targetB, alpha);
+#else
   for (int i = 0; i < LED_COUNT; ++i) {
     uint32_t c = strip.getPixelColor(i);
     uint8_t r = (c >> 16) & 0xFF;
@@ -83,4 +87,5 @@ void overlayColorAlpha(uint8_t targetR, uint8_t targetG, uint8_t targetB, float
 
     strip.setPixelColor(i, strip.Color(nr, ng, nb));
   }
+#endif
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include <Adafruit_NeoPixel.h>
 #include "config.h"
+#include "power_strip.h"
 
 // ===== 초기화 함수 =====
 void initNeoPixel();
@@ -23,6 +24,6 @@ void overlayWhiteAlpha(float alpha);
 void overlayColorAlpha(uint8_t targetR, uint8_t targetG, uint8_t targetB, float alpha);
 
 // ===== 전역 변수 선언 (extern) =====
-extern Adafruit_NeoPixel strip;
+extern PowerStrip strip;
 
 #endif
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "control.h"
 #include "rain_effect.h"
 #include "background_effect.h"
+#include "transition_effect.h"
 
 // ================= 페이드 상태 =================
 static unsigned long fadeStartMs = 0;
@@ -35,11 +36,16 @@ void updateFadeToRain() {
     return;
   }
   
+#if FADE_TO_RAIN_FIELD >= 0
+  // 필드 전환 - 완성된 화면을 그린 뒤 마스크로 드러냄
+  float progress = 1.0;
+#else
   // 페이드 진행도 계산 (0.0 ~ 1.0)
   float progress = (float)elapsed / FADE_TO_RAIN_DURATION;
   
   // Ease-in-out 적용
   progress = easeInOutSine(progress);
+#endif
   
   // 화면 지우기
   clearMatrix();
@@ -74,7 +80,11 @@ void updateFadeToRain() {
   // 빗방울도 페이드 적용하여 그리기
   moveRaindrops();
   drawRaindrops();  // 기존 빗방울 그리기
+  applyRainGlow();
   
+#if FADE_TO_RAIN_FIELD >= 0
+  applyTransitionMask((TransitionField)FADE_TO_RAIN_FIELD, transitionFront(elapsed, FADE_TO_RAIN_DURATION), true);
+#else
   // 전체 화면에 페이드 효과 적용 (알파 블렌딩)
   if (progress < 1.0) {
     for(int i = 0; i < LED_COUNT; i++) {
@@ -85,8 +95,9 @@ void updateFadeToRain() {
       strip.setPixelColor(i, strip.Color(r, g, b));
     }
   }
+#endif
   
-  strip.show();
+  strip.beginShow();
 }
 
 // 페이드 완료 여부
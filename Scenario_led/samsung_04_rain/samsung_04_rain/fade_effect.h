@@ -13,5 +13,6 @@ bool isFadeToRainComplete();
 
 // ===== 페이드 설정 =====
 #define FADE_TO_RAIN_DURATION 1000  // 1초간 페이드인
+// 페이드 모양은 config.h의 FADE_TO_RAIN_FIELD
 
 #endif
\ No newline at end of file
@@ -0,0 +1,60 @@
+// fast_random.cpp - 효과 공용 난수 발생기 구현
+
+#include "fast_random.h"
+
+// ================= 런타임 상태 =================
+static uint32_t randomState = 1;
+static uint32_t randomSeedValue = 1;
+
+// ================= 시드 =================
+
+// 시드를 섞어서 상태로 사용 (가까운 시드도 다른 수열, 상태 0 방지)
+void fastRandomSeed(uint32_t seed) {
+  randomSeedValue = seed;
+  uint32_t x = seed * 0x9E3779B9UL;
+  x ^= x >> 16;
+  x *= 0x85EBCA6BUL;
+  x ^= x >> 13;
+  randomState = x ? x : 0x6D2B79F5UL;
+}
+
+uint32_t fastRandomBegin(uint32_t seed) {
+  if(seed == 0) {
+    // 떠 있는 아날로그 핀의 최하위 비트 32개 + 부팅 시각
+    for(uint8_t i = 0; i < 32; i++) {
+      seed = (seed << 1) | (analogRead(0) & 1);
+    }
+    seed ^= micros();
+    if(seed == 0) seed = 1;
+  }
+  fastRandomSeed(seed);
+  return seed;
+}
+
+uint32_t fastRandomSeedValue() {
+  return randomSeedValue;
+}
+
+// ================= 난수 추출 =================
+uint32_t fastRandom32() {
+  uint32_t x = randomState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  randomState = x;
+  return x;
+}
+
+// 상위 16비트 × range 의 상위 16비트 (편향 최대 range/65536, 효과용으로 충분)
+uint16_t fastRandom(uint16_t range) {
+  return (uint16_t)(((fastRandom32() >> 16) * (uint32_t)range) >> 16);
+}
+
+int16_t fastRandomRange(int16_t low, int16_t high) {
+  if(low >= high) return low;
+  return low + (int16_t)fastRandom((uint16_t)(high - low));
+}
+
+bool fastRandomChance(uint8_t percent) {
+  return fastRandom(100) < percent;
+}
@@ -0,0 +1,22 @@
+// fast_random.h - 효과 공용 난수 발생기 (xorshift32)
+// random()의 32비트 나눗셈 대신 시프트/XOR만 사용, 범위 추출은 곱셈-시프트 (나눗셈 없음)
+// 시드를 기록해 두면 같은 시드로 비 효과 전체를 비트 단위로 재현 가능
+
+#ifndef FAST_RANDOM_H
+#define FAST_RANDOM_H
+
+#include <Arduino.h>
+
+// ===== 시드 =====
+// seed가 0이면 아날로그 잡음 + micros()로 부팅 시드 생성, 실제 사용한 시드 반환 (로그용)
+uint32_t fastRandomBegin(uint32_t seed);
+void fastRandomSeed(uint32_t seed);
+uint32_t fastRandomSeedValue();   // 마지막으로 설정한 시드
+
+// ===== 난수 추출 =====
+uint32_t fastRandom32();
+uint16_t fastRandom(uint16_t range);                  // 0 ~ range-1
+int16_t fastRandomRange(int16_t low, int16_t high);   // low ~ high-1
+bool fastRandomChance(uint8_t percent);               // percent% 확률로 true
+
+#endif
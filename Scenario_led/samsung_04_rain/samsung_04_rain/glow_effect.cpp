@@ -0,0 +1,189 @@
+// glow_effect.cpp - 빛 번짐 후처리 구현
+
+#include "glow_effect.h"
+#include "control.h"
+
+#define GLOW_REGION_ROWS (GLOW_BOTTOM_ROW - GLOW_TOP_ROW + 1)
+
+// ================= 더러운 줄 (비트 = 행/열 번호) =================
+static uint16_t dirtyRows = 0;
+static uint32_t dirtyColumns = 0;
+
+void glowMarkPixel(int x, int y) {
+  if(x < 0 || x >= MATRIX_WIDTH || y < GLOW_TOP_ROW || y > GLOW_BOTTOM_ROW) return;
+  dirtyRows |= (uint16_t)1 << y;
+  dirtyColumns |= (uint32_t)1 << x;
+}
+
+void glowMarkAll() {
+  for(uint8_t y = GLOW_TOP_ROW; y <= GLOW_BOTTOM_ROW; y++) {
+    dirtyRows |= (uint16_t)1 << y;
+  }
+  dirtyColumns = 0xFFFFFFFFUL;
+}
+
+// ================= 줄 버퍼 =================
+// 값 버퍼는 양쪽에 GLOW_MAX_RADIUS칸씩 0을 두어, 삼각형의 두 번째 상자가 줄 밖의 첫 번째 합도 읽을 수 있게 함
+// 줄의 픽셀 인덱스는 저장하지 않고 좌표로 계산 (AVR SRAM: 값 40B + 합 80B)
+#define GLOW_PAD GLOW_MAX_RADIUS
+#define GLOW_LINE_MAX (MATRIX_WIDTH + 2 * GLOW_PAD)
+
+static uint8_t lineValue[GLOW_LINE_MAX];    // 원본 채널 값 (GLOW_PAD부터)
+static uint16_t lineSum[GLOW_LINE_MAX];     // 상자 합 (삼각형은 두 번째 상자도 같은 버퍼에)
+
+// 줄의 i번째 픽셀 인덱스 (가로 줄: fixed행의 i열, 세로 줄: fixed열의 GLOW_TOP_ROW + i행)
+// getPixelIndex와 같은 세로 지그재그 (범위 검사 없음)
+static inline uint16_t linePixel(bool vertical, uint8_t fixed, uint8_t i) {
+  uint8_t x = vertical ? fixed : i;
+  uint8_t y = vertical ? GLOW_TOP_ROW + i : fixed;
+  return (uint16_t)x * MATRIX_HEIGHT + ((x & 1) ? MATRIX_HEIGHT - 1 - y : y);
+}
+
+// out[i] = in[i - before] + ... + in[i + after] (줄 밖은 0)
+// 창이 한 칸 움직일 때 들어오는 값 더하고 나가는 값 빼기 → 반지름과 무관하게 픽셀당 두 번
+static void boxSums(const uint8_t* in, uint16_t* out, uint8_t count, uint8_t before, uint8_t after) {
+  uint16_t sum = 0;
+  for(uint8_t j = 0; j < after && j < count; j++) {
+    sum += in[j];
+  }
+  for(uint8_t i = 0; i < count; i++) {
+    if(i + after < count) sum += in[i + after];
+    if(i > before) sum -= in[i - before - 1];
+    out[i] = sum;
+  }
+}
+
+// boxSums를 같은 버퍼에 (덮어쓴 값은 창에서 빠질 때까지 before + 1칸 링에 보관)
+static void boxSumsInPlace(uint16_t* line, uint8_t count, uint8_t before, uint8_t after) {
+  uint16_t history[GLOW_MAX_RADIUS + 1];
+  uint8_t slot = 0;
+  uint16_t sum = 0;
+  for(uint8_t j = 0; j < after && j < count; j++) {
+    sum += line[j];
+  }
+  for(uint8_t i = 0; i < count; i++) {
+    if(i + after < count) sum += line[i + after];
+    if(i > before) sum -= history[slot];
+    history[slot] = line[i];
+    slot = (slot == before) ? 0 : slot + 1;
+    line[i] = sum;
+  }
+}
+
+// 한 줄의 세 채널을 흐려서 더함 (weight: 창 합 → 더할 값, 1/65536 단위)
+// 창 합 ≤ 255 × 정규화, weight ≤ gain × 256 / 정규화 → 곱 ≤ 255 × 65535 × 256 (uint32 안)
+static void glowLine(uint8_t count, bool vertical, uint8_t fixed, uint8_t radius, GlowKernel kernel,
+                     uint32_t weight, uint8_t cap) {
+  const uint8_t* pixels = strip.getPixels();
+  uint8_t padded = count + 2 * GLOW_PAD;
+  for(uint8_t i = 0; i < GLOW_PAD; i++) {
+    lineValue[i] = 0;
+    lineValue[GLOW_PAD + count + i] = 0;
+  }
+
+  for(uint8_t channel = 0; channel < 3; channel++) {
+    for(uint8_t i = 0; i < count; i++) {
+      lineValue[GLOW_PAD + i] = pixels[linePixel(vertical, fixed, i) * 3 + channel];
+    }
+
+    if(kernel == GLOW_TENT) {
+      // 폭 r+1 상자 두 번 (앞은 오른쪽으로, 뒤는 왼쪽으로 치우쳐서 합치면 [-r, r] 대칭)
+      boxSums(lineValue, lineSum, padded, radius / 2, radius - radius / 2);
+      boxSumsInPlace(lineSum, padded, radius - radius / 2, radius / 2);
+    } else {
+      boxSums(lineValue, lineSum, padded, radius, radius);
+    }
+
+    for(uint8_t i = 0; i < count; i++) {
+      uint16_t add = (uint16_t)((lineSum[GLOW_PAD + i] * weight + 32768UL) >> 16);
+      if(add == 0) continue;
+      uint16_t value = lineValue[GLOW_PAD + i] + add;
+      strip.setWireByte(linePixel(vertical, fixed, i) * 3 + channel, value > cap ? cap : (uint8_t)value);
+    }
+  }
+}
+
+// ================= 적용 =================
+void glowApply(uint8_t radius, uint16_t gain, GlowKernel kernel) {
+  if(radius < 1 || radius > GLOW_MAX_RADIUS) return;
+
+  // 창 합 하나에 곱하는 값 = gain / 256 / 정규화 (상자 2r+1, 삼각형 (r+1)^2)
+  // gain이 767을 넘으면 상자 r=1에서 uint16을 넘으므로 uint32 (gain 전체 범위)
+  uint16_t norm = (kernel == GLOW_TENT) ? (uint16_t)(radius + 1) * (radius + 1) : 2 * radius + 1;
+  uint32_t weight = ((uint32_t)gain << 8) / norm;
+
+  // 전송 값 상한 (라이브러리 스케일: 색 255 × (밝기 + 1) / 256)
+  uint8_t cap = (uint8_t)((255U * ((uint16_t)strip.getBrightness() + 1)) >> 8);
+
+  // 가로 패스: 표시된 행 전체 폭
+  for(uint8_t y = GLOW_TOP_ROW; y <= GLOW_BOTTOM_ROW; y++) {
+    if(!(dirtyRows & ((uint16_t)1 << y))) continue;
+    glowLine(MATRIX_WIDTH, false, y, radius, kernel, weight, cap);
+  }
+
+  // 세로 패스: 가로로 번진 만큼 넓힌 열, 번짐 영역 행만
+  uint32_t columns = dirtyColumns;
+  for(uint8_t k = 1; k <= radius; k++) {
+    columns |= (dirtyColumns << k) | (dirtyColumns >> k);
+  }
+  for(uint8_t x = 0; x < MATRIX_WIDTH; x++) {
+    if(!(columns & ((uint32_t)1 << x))) continue;
+    glowLine(GLOW_REGION_ROWS, true, x, radius, kernel, weight, cap);
+  }
+
+  dirtyRows = 0;
+  dirtyColumns = 0;
+}
+
+// ================= 측정 =================
+void glowBenchFrame() {
+  static const uint8_t dropX[3] = { 4, 15, 26 };
+  static const uint8_t dropY[3] = { 6, 10, 13 };
+
+  clearMatrix();
+  for(uint8_t x = 0; x < MATRIX_WIDTH; x++) {
+    setPixel(x, 0, 103, 161, 255);
+    setPixel(x, 1, 0, 111, 255);
+    setPixel(x, 15, 144, 144, 144);
+  }
+  for(uint8_t i = 0; i < 3; i++) {
+    for(uint8_t py = 0; py < 5; py++) {
+      uint8_t level = 50 + py * 51;
+      setPixel(dropX[i], dropY[i] - py, level, level, level);
+      glowMarkPixel(dropX[i], dropY[i] - py);
+    }
+  }
+}
+
+#ifdef GLOW_BENCH_MODE
+// micros() 해상도(4us) 때문에 GLOW_BENCH_REPEAT번 평균, 화면 다시 그리기는 측정에서 뺌
+static uint32_t benchOne(uint8_t radius, GlowKernel kernel, bool fullFrame) {
+  uint32_t total = 0;
+  for(uint8_t n = 0; n < GLOW_BENCH_REPEAT; n++) {
+    glowBenchFrame();
+    if(fullFrame) glowMarkAll();
+    unsigned long start = micros();
+    glowApply(radius, RAIN_GLOW_GAIN, kernel);
+    total += micros() - start;
+  }
+  return total / GLOW_BENCH_REPEAT;
+}
+
+void runGlowBench() {
+  Serial.begin(GLOW_BENCH_BAUDRATE);
+  Serial.println("radius box_dirty_us box_full_us tent_dirty_us tent_full_us");
+  for(uint8_t radius = 1; radius <= GLOW_MAX_RADIUS; radius++) {
+    Serial.print(radius);
+    Serial.print(' ');
+    Serial.print(benchOne(radius, GLOW_BOX, false));
+    Serial.print(' ');
+    Serial.print(benchOne(radius, GLOW_BOX, true));
+    Serial.print(' ');
+    Serial.print(benchOne(radius, GLOW_TENT, false));
+    Serial.print(' ');
+    Serial.println(benchOne(radius, GLOW_TENT, true));
+  }
+  clearMatrix();
+  strip.show();
+}
+#endif
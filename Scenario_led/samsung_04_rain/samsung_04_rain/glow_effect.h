@@ -0,0 +1,36 @@
+// glow_effect.h - 빛 번짐 후처리 (가로/세로 분리 흐림을 원래 화면에 더함)
+// 한 줄씩 running sum으로 흐리므로 반지름과 무관하게 픽셀당 고정 비용 (고정소수점, 줄 버퍼만 사용)
+// 가로 패스 결과에 세로 패스를 다시 더하는 방식이라 번짐 모양은 십자 + 부드러운 모서리
+// (2D 흐림을 원본에 더하려면 화면 복사본이 필요해서 AVR SRAM에 맞게 축마다 더함)
+
+#ifndef GLOW_EFFECT_H
+#define GLOW_EFFECT_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ===== 흐림 커널 =====
+enum GlowKernel {
+  GLOW_BOX = 0,     // 상자 (반지름 r → 폭 2r+1, running sum 한 번)
+  GLOW_TENT         // 삼각형 (폭 r+1 상자 두 번, 같은 폭 2r+1)
+};
+
+// ===== 더러운 줄 표시 =====
+// 표시한 픽셀의 행/열만 처리 (GLOW_TOP_ROW ~ GLOW_BOTTOM_ROW 밖은 무시), glowApply 후 비워짐
+void glowMarkPixel(int x, int y);
+void glowMarkAll();
+
+// ===== 적용 =====
+// radius 1 ~ GLOW_MAX_RADIUS, gain: 더하는 세기 (256 = 흐린 값 그대로), 전송 값 기준 (밝기 상한에서 포화)
+void glowApply(uint8_t radius, uint16_t gain, GlowKernel kernel);
+
+// ===== 측정 =====
+// 측정용 화면 (비 배경 + 빗방울 3개, 빗방울 픽셀만 표시)
+void glowBenchFrame();
+
+#ifdef GLOW_BENCH_MODE
+// 반지름 1~4, 상자/삼각형, 더러운 줄/전체 화면의 glowApply 평균 시간을 시리얼로 출력
+void runGlowBench();
+#endif
+
+#endif
@@ -12,21 +12,149 @@
 static unsigned long lightningStartMs = 0;
 static bool lightningActive = false;
 
+// 화면 전체 번개 색 / 끄기
+static void fillLightning() {
+  for (int i = 0; i < LED_COUNT; i++) {
+    strip.setPixelColor(i, strip.Color(LIGHTNING_R, LIGHTNING_G, LIGHTNING_B));
+  }
+}
+
+#if LIGHTNING_STROBE_MODE
+// ================= 이벤트 스케줄 스트로브 =================
+// 타임라인을 시작할 때 전송 시작 시각 목록으로 미리 바꿔 두고, 시각이 스핀 창 안에 들어오면
+// micros()로 기다렸다가 그 시각에 바로 전송 시작 (loop()의 delay/프레임 간격과 무관)
+// 시각은 PowerStrip::nowUs() 기준 (power_strip.h)
+// 켜진 화면은 다음 프레임이 래치될 때까지 보이므로 보이는 길이 = 전송 시작 간격 ≥ 전송 시간
+// → 전송 시간보다 짧은 구간은 LIGHTNING_MIN_HOLD_FRAMES 프레임 길이로 늘리고 뒤 이벤트를 그만큼 밀어냄
+
+#define LIGHTNING_OFF 0
+#define LIGHTNING_ON  1
+#define LIGHTNING_END 2
+
+struct LightningStep {
+  uint16_t atMs;    // 시작 기준 시각
+  uint8_t state;    // 이 시각부터의 상태
+};
+
+static const LightningStep lightningTimeline[] PROGMEM = {
+  {    0, LIGHTNING_ON  },
+  {  500, LIGHTNING_OFF },
+  { 1800, LIGHTNING_ON  },
+  { 1905, LIGHTNING_OFF },
+  { 2001, LIGHTNING_ON  },
+  { 2005, LIGHTNING_OFF },
+  { 4000, LIGHTNING_END },
+};
+#define LIGHTNING_EVENT_COUNT (uint8_t)(sizeof(lightningTimeline) / sizeof(lightningTimeline[0]))
+
+static uint32_t eventUs[LIGHTNING_EVENT_COUNT];   // 시작 기준 전송 시작 시각 (늘린 뒤)
+static uint8_t nextEvent = 0;
+static unsigned long lightningStartUs = 0;
+static uint8_t stretchedCount = 0;
+static uint8_t lateCount = 0;
+static uint8_t missedCount = 0;
+static uint32_t maxLateUs = 0;
+
+// 앞 이벤트와 간격이 최소 길이보다 짧으면 그 간격으로 늘림 (결과는 실행마다 같음)
+static void buildSchedule() {
+  uint32_t minHoldUs = strip.wireTimeUs() * LIGHTNING_MIN_HOLD_FRAMES;
+  stretchedCount = 0;
+  for (uint8_t i = 0; i < LIGHTNING_EVENT_COUNT; i++) {
+    uint32_t at = (uint32_t)pgm_read_word(&lightningTimeline[i].atMs) * 1000;
+    if (i > 0 && at < eventUs[i - 1] + minHoldUs) {
+      at = eventUs[i - 1] + minHoldUs;
+      stretchedCount++;
+    }
+    eventUs[i] = at;
+  }
+}
+
+static void fireEvent(uint8_t state) {
+  if (state == LIGHTNING_ON) {
+    fillLightning();
+  } else {
+    clearMatrix();
+  }
+  strip.beginShow();
+  if (state == LIGHTNING_END) {
+    lightningActive = false;
+    DEBUG_PRINT("lightning stretched=");
+    DEBUG_PRINT(stretchedCount);
+    DEBUG_PRINT(" late=");
+    DEBUG_PRINT(lateCount);
+    DEBUG_PRINT(" missed=");
+    DEBUG_PRINT(missedCount);
+    DEBUG_PRINT(" max_late_us=");
+    DEBUG_PRINTLN(maxLateUs);
+  }
+}
+
+// 스핀 창 안의 이벤트를 모두 처리 (짧은 번쩍임은 한 번 호출에서 켜고 끔)
+// 다음 이벤트 시각까지 이미 지났으면 그 이벤트는 보낼 의미가 없으므로 놓침으로 기록
+static void runSchedule() {
+  while (lightningActive) {
+    uint32_t deadline = eventUs[nextEvent];
+    if ((long)(deadline - (PowerStrip::nowUs() - lightningStartUs)) > LIGHTNING_SPIN_US) return;
+
+    if (nextEvent + 1 < LIGHTNING_EVENT_COUNT &&
+        (long)((PowerStrip::nowUs() - lightningStartUs) - eventUs[nextEvent + 1]) >= 0) {
+      missedCount++;
+      DEBUG_PRINT("lightning missed event ");
+      DEBUG_PRINTLN(nextEvent);
+      nextEvent++;
+      continue;
+    }
+
+    // 남은 시간은 스핀 창 이하 (delayMicroseconds는 16383us까지 정확)
+    long remaining = (long)(deadline - (PowerStrip::nowUs() - lightningStartUs));
+    if (remaining > 0) delayMicroseconds((unsigned int)remaining);
+    uint32_t late = (PowerStrip::nowUs() - lightningStartUs) - deadline;
+    if (late > maxLateUs) maxLateUs = late;
+    if (late > LIGHTNING_LATE_US) {
+      lateCount++;
+      DEBUG_PRINT("lightning late event ");
+      DEBUG_PRINT(nextEvent);
+      DEBUG_PRINT(" us=");
+      DEBUG_PRINTLN(late);
+    }
+
+    fireEvent(pgm_read_byte(&lightningTimeline[nextEvent].state));
+    nextEvent++;
+  }
+}
+#endif
+
 // ================= 공개 함수 =================
 
 // 번개 효과 초기화
 void initLightningEffect() {
   lightningStartMs = millis();
   lightningActive = true;
-  
+
+#if LIGHTNING_STROBE_MODE
+  // 첫 이벤트(0 ms 점등)는 바로 전송
+  buildSchedule();
+  nextEvent = 0;
+  lateCount = 0;
+  missedCount = 0;
+  maxLateUs = 0;
+  lightningStartUs = PowerStrip::nowUs();
+  runSchedule();
+#else
   // 화면 초기화 후 첫 번개 켜기
   clearMatrix();
-  for (int i = 0; i < LED_COUNT; i++) {
-    strip.setPixelColor(i, strip.Color(LIGHTNING_R, LIGHTNING_G, LIGHTNING_B));
-  }
+  fillLightning();
   strip.show();
+#endif
 }
 
+#if LIGHTNING_STROBE_MODE
+// 번개 효과 업데이트 (이벤트 스케줄)
+void updateLightningEffect() {
+  if (!lightningActive) return;
+  runSchedule();
+}
+#else
 // 번개 효과 업데이트 (간단한 타임라인)
 void updateLightningEffect() {
   if (!lightningActive) return;
@@ -62,9 +190,7 @@ void updateLightningEffect() {
     
     if (currentState == 1) {
       // 번개 켜기
-      for (int i = 0; i < LED_COUNT; i++) {
-        strip.setPixelColor(i, strip.Color(LIGHTNING_R, LIGHTNING_G, LIGHTNING_B));
-      }
+      fillLightning();
       strip.show();
     } else {
       // 번개 끄기
@@ -73,6 +199,7 @@ void updateLightningEffect() {
     }
   }
 }
+#endif
 
 // 번개 효과 완료 여부
 bool isLightningComplete() {
@@ -0,0 +1,173 @@
+// profiler.cpp - 핫패스 프로파일러 구현
+
+#include "profiler.h"
+#include "power_strip.h"
+
+#ifdef PROFILE_MODE
+
+// ================= 사이클 카운터 =================
+// PowerStrip::nowUs() 기반 (AVR 16MHz에서 4us = 64사이클 해상도, 프레임 단위 측정에는 충분)
+#define PROFILE_CYCLES_PER_US (F_CPU / 1000000UL)
+
+static inline uint32_t profileCycles() {
+  return PowerStrip::nowUs() * PROFILE_CYCLES_PER_US;
+}
+
+// ================= 런타임 상태 =================
+struct ProfileHistogram {
+  uint32_t maxCycles;
+  uint32_t totalCycles;   // 포화 (넘치면 0xFFFFFFFF 유지)
+  uint16_t buckets[PROFILE_BUCKETS];
+};
+
+static ProfileHistogram histograms[PROF_METRIC_COUNT];
+static uint32_t frameCycles[PROF_METRIC_COUNT];
+static uint32_t sectionStart[PROF_METRIC_COUNT];
+static uint32_t sectionShowStart[PROF_METRIC_COUNT];
+static uint8_t frameRan = 0;        // 이번 프레임에 실행된 구간 (비트마스크)
+static uint32_t frameStart = 0;
+static uint32_t frameCount = 0;
+static bool frameOpen = false;
+
+// ================= 스택 칠하기 (AVR) =================
+#define STACK_CANARY 0xA5
+
+#ifdef __AVR__
+extern uint8_t _end;
+extern uint8_t __stack;
+extern char* __brkval;
+
+// C 런타임 초기화 전(.init1)에 .bss 끝부터 스택 꼭대기까지 칠함 (스택은 아직 사용 전)
+void profilePaintStack() __attribute__((naked, used, section(".init1")));
+void profilePaintStack() {
+  uint8_t* p = &_end;
+  while(p <= &__stack) {
+    *p++ = STACK_CANARY;
+  }
+}
+
+// 힙 끝(malloc한 NeoPixel 버퍼 포함)부터 위로 칠이 남은 마지막 주소 찾기
+static uint8_t* deepestStack() {
+  uint8_t* p = __brkval ? (uint8_t*)__brkval : &_end;
+  while(p <= &__stack && *p == STACK_CANARY) p++;
+  return p;
+}
+
+uint16_t profileStackUsed() {
+  return (uint16_t)(&__stack - deepestStack() + 1);
+}
+
+uint16_t profileStackFree() {
+  uint8_t* heapEnd = __brkval ? (uint8_t*)__brkval : &_end;
+  return (uint16_t)(deepestStack() - heapEnd);
+}
+#else
+uint16_t profileStackUsed() { return 0; }
+uint16_t profileStackFree() { return 0; }
+#endif
+
+// ================= 히스토그램 =================
+// 버킷 k: 2^(shift+k) 사이클 미만 (마지막 버킷은 그 이상 전부)
+static void recordSample(uint8_t metric, uint32_t cycles) {
+  ProfileHistogram& h = histograms[metric];
+  if(cycles > h.maxCycles) h.maxCycles = cycles;
+  h.totalCycles = (h.totalCycles + cycles < h.totalCycles) ? 0xFFFFFFFFUL : h.totalCycles + cycles;
+
+  uint8_t bucket = 0;
+  uint32_t limit = 1UL << PROFILE_BUCKET_SHIFT;
+  while(bucket < PROFILE_BUCKETS - 1 && cycles >= limit) {
+    bucket++;
+    limit <<= 1;
+  }
+  if(h.buckets[bucket] != 0xFFFF) h.buckets[bucket]++;
+}
+
+// ================= 구간 측정 =================
+void profileInit() {
+  memset(histograms, 0, sizeof(histograms));
+  frameCount = 0;
+  frameOpen = false;
+}
+
+void profileBegin(uint8_t metric) {
+  sectionStart[metric] = profileCycles();
+  sectionShowStart[metric] = frameCycles[PROF_SHOW];
+}
+
+// show 외 구간은 안에서 호출된 show() 시간을 뺌
+void profileEnd(uint8_t metric) {
+  uint32_t elapsed = profileCycles() - sectionStart[metric];
+  if(metric != PROF_SHOW) {
+    elapsed -= frameCycles[PROF_SHOW] - sectionShowStart[metric];
+  }
+  frameCycles[metric] += elapsed;
+  frameRan |= 1 << metric;
+}
+
+void profileFrameBegin() {
+  memset(frameCycles, 0, sizeof(frameCycles));
+  frameRan = 0;
+  frameStart = profileCycles();
+  frameOpen = true;
+}
+
+// 렌더 = 프레임 전체 - show - 대기, 효과는 이번 프레임에 실행된 것만 기록
+void profileFrameEnd() {
+  if(!frameOpen) return;
+  frameOpen = false;
+
+  uint32_t total = profileCycles() - frameStart;
+  uint32_t busy = frameCycles[PROF_SHOW] + frameCycles[PROF_IDLE];
+  frameCycles[PROF_RENDER] = total > busy ? total - busy : 0;
+
+  recordSample(PROF_RENDER, frameCycles[PROF_RENDER]);
+  recordSample(PROF_SHOW, frameCycles[PROF_SHOW]);
+  recordSample(PROF_IDLE, frameCycles[PROF_IDLE]);
+  for(uint8_t m = PROF_CLOUD; m < PROF_METRIC_COUNT; m++) {
+    if(frameRan & (1 << m)) recordSample(m, frameCycles[m]);
+  }
+  frameCount++;
+}
+
+// ================= 덤프 =================
+static uint8_t dumpChecksum;
+
+static void dumpBytes(uint32_t value, uint8_t count) {
+  for(uint8_t i = 0; i < count; i++) {
+    uint8_t b = (uint8_t)(value >> (8 * i));
+    dumpChecksum += b;
+    Serial.write(b);
+  }
+}
+
+void profileDump() {
+  dumpChecksum = 0;
+  dumpBytes('P', 1);
+  dumpBytes('F', 1);
+  dumpBytes(PROFILE_RECORD_VERSION, 1);
+  dumpBytes(PROF_METRIC_COUNT, 1);
+  dumpBytes(PROFILE_BUCKETS, 1);
+  dumpBytes(PROFILE_BUCKET_SHIFT, 1);
+  dumpBytes(frameCount, 4);
+  dumpBytes(PROFILE_CYCLES_PER_US, 1);
+  dumpBytes(profileStackUsed(), 2);
+  dumpBytes(profileStackFree(), 2);
+
+  for(uint8_t m = 0; m < PROF_METRIC_COUNT; m++) {
+    dumpBytes(histograms[m].maxCycles, 4);
+    dumpBytes(histograms[m].totalCycles, 4);
+    for(uint8_t b = 0; b < PROFILE_BUCKETS; b++) {
+      dumpBytes(histograms[m].buckets[b], 2);
+    }
+  }
+  Serial.write(dumpChecksum);
+  Serial.flush();
+}
+
+void profilePollRequest() {
+  while(Serial.available() > 0) {
+    if(Serial.read() == PROFILE_DUMP_COMMAND) profileDump();
+  }
+}
+
+#endif // PROFILE_MODE
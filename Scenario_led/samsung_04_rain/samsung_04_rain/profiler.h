@@ -0,0 +1,59 @@
+// profiler.h - 핫패스 프로파일러 (config.h의 PROFILE_MODE로 켜고 끔)
+// 프레임(loop 한 번)마다 렌더 / show() / 대기 사이클과 효과별 렌더 사이클을 누적해
+// 고정 크기 log2 히스토그램에 기록, 시리얼로 PROFILE_DUMP_COMMAND를 받으면 바이너리 레코드 출력
+// 스택은 부팅 시 칠해 두고 덤프 때 가장 깊이 내려간 지점(SRAM 최소 여유)을 찾음
+// 시간은 PowerStrip::nowUs() 기준: AVR의 PROF_SHOW는 잰 값이 아니라 wireTimeUs() 계산값,
+// 전송 중 놓친 인터럽트(시리얼 수신 등)나 클럭 편차는 반영되지 않음
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ===== 측정 항목 =====
+enum ProfileMetric {
+  PROF_RENDER = 0,      // 프레임 전체 - show - 대기
+  PROF_SHOW,            // strip.show() 전송
+  PROF_IDLE,            // loop()의 delay
+  PROF_CLOUD,           // updateCloudMotion (show 제외)
+  PROF_RAIN,            // updateRainWithBackground (show 제외)
+  PROF_LIGHTNING,       // updateLightningEffect (show 제외)
+  PROF_FADE_TO_RAIN,    // updateFadeToRain (show 제외)
+  PROF_GLOW,            // 빗방울 빛 번짐 (PROF_RAIN / PROF_FADE_TO_RAIN 안에 포함)
+  PROF_METRIC_COUNT
+};
+
+// ===== 바이너리 레코드 (리틀 엔디언) =====
+// 헤더: 'P' 'F' version metricCount bucketCount bucketShift
+//       frames(u32) cyclesPerUs(u8) stackUsed(u16) stackFree(u16)
+// 항목마다: maxCycles(u32) totalCycles(u32) buckets(u16 × bucketCount)
+// 끝: 앞 바이트 전체의 8비트 합 (체크섬)
+#define PROFILE_RECORD_VERSION 1
+
+#ifdef PROFILE_MODE
+  #define PROFILE_BEGIN(metric)   profileBegin(metric)
+  #define PROFILE_END(metric)     profileEnd(metric)
+  #define PROFILE_FRAME_BEGIN()   profileFrameBegin()
+  #define PROFILE_FRAME_END()     profileFrameEnd()
+  #define PROFILE_POLL()          profilePollRequest()
+#else
+  #define PROFILE_BEGIN(metric)
+  #define PROFILE_END(metric)
+  #define PROFILE_FRAME_BEGIN()
+  #define PROFILE_FRAME_END()
+  #define PROFILE_POLL()
+#endif
+
+// ===== 프로파일러 함수 =====
+void profileInit();
+void profileBegin(uint8_t metric);
+void profileEnd(uint8_t metric);
+void profileFrameBegin();
+void profileFrameEnd();
+void profilePollRequest();    // 시리얼 요청 확인 후 덤프
+void profileDump();
+uint16_t profileStackUsed();  // 부팅 후 최대 스택 사용량 (바이트, 호스트는 0)
+uint16_t profileStackFree();  // 힙 끝과 가장 깊은 스택 사이 최소 여유 (바이트, 호스트는 0)
+
+#endif
@@ -1,7 +1,12 @@
 // rain_effect.cpp - 새로운 비 효과 (그라데이션 빗방울)
+// 빗방울은 한 프레임 전송 시간 간격 스텝으로만 움직이고 (sim_clock.h), 그릴 때 직전 스텝 위치와 보간
 
 #include "rain_effect.h"
 #include "control.h"
+#include "fast_random.h"
+#include "sim_clock.h"
+#include "glow_effect.h"
+#include "profiler.h"
 
 // ================= 기존 빗방울 배열 (호환성 유지) =================
 Raindrop raindrops[MAX_RAINDROPS];
@@ -9,12 +14,16 @@ Raindrop raindrops[MAX_RAINDROPS];
 // ================= 새로운 빗방울 구조체 =================
 struct GradientRaindrop {
   float x, y, speed;
+  float previousY;    // 직전 스텝 위치 (그리기 보간용)
   bool active;
 };
 
 #define MAX_GRADIENT_RAINDROPS 3
 static GradientRaindrop gradientRaindrops[MAX_GRADIENT_RAINDROPS];
 
+static SimClock rainClock;
+static uint16_t stepsSinceActivation = RAIN_ACTIVATION_STEPS;   // 시작하자마자 확인 가능
+
 // 빗방울 그라데이션 패턴 (5픽셀)
 #define GRADIENT_RAINDROP_HEIGHT 5
 const uint8_t raindropGradient[GRADIENT_RAINDROP_HEIGHT][3] PROGMEM = {
@@ -26,21 +35,22 @@ const uint8_t raindropGradient[GRADIENT_RAINDROP_HEIGHT][3] PROGMEM = {
 };
 
 // ================= 초기화 함수 (Y축 반전) =================
+// 시드는 setup()에서 한 번만 설정 (fastRandomBegin), 여기서 다시 섞지 않음
 void initRainEffect() {
   // 그라데이션 빗방울 초기화
   for(int i = 0; i < MAX_GRADIENT_RAINDROPS; i++) {
     gradientRaindrops[i].active = (i < 1);  // 처음에 1개만 활성화
-    gradientRaindrops[i].x = random(MATRIX_WIDTH);
-    gradientRaindrops[i].y = MATRIX_HEIGHT + random(MATRIX_HEIGHT);  // 아래에서 시작
+    gradientRaindrops[i].x = fastRandom(MATRIX_WIDTH);
+    gradientRaindrops[i].y = MATRIX_HEIGHT + fastRandom(MATRIX_HEIGHT);  // 아래에서 시작
     gradientRaindrops[i].speed = 1.4;
+    gradientRaindrops[i].previousY = gradientRaindrops[i].y;
   }
+  simClockBegin(&rainClock, strip.wireTimeUs());
   
   // 기존 빗방울 배열 비활성화 (호환성)
   for(int i = 0; i < MAX_RAINDROPS; i++) {
     raindrops[i].active = false;
   }
-  
-  randomSeed(analogRead(0));
 }
 
 // ================= 새로운 비 배경 그리기 (Y축 반전) =================
@@ -63,45 +73,58 @@ void drawRainBackground() {
   }
 }
 
-// ================= 그라데이션 빗방울 업데이트 (Y축 반전) =================
-void updateGradientRaindrops() {
+// ================= 그라데이션 빗방울 한 스텝 (Y축 반전) =================
+static void stepGradientRaindrops() {
   for(int i = 0; i < MAX_GRADIENT_RAINDROPS; i++) {
     if(gradientRaindrops[i].active) {
       // 위로 이동 (Y축 반전)
+      gradientRaindrops[i].previousY = gradientRaindrops[i].y;
       gradientRaindrops[i].y -= gradientRaindrops[i].speed;
       
-      // 화면 위로 벗어나면 아래에서 다시 시작
+      // 화면 위로 벗어나면 아래에서 다시 시작 (보간 없이 바로 이동)
       if(gradientRaindrops[i].y < -GRADIENT_RAINDROP_HEIGHT) {
         gradientRaindrops[i].y = MATRIX_HEIGHT + GRADIENT_RAINDROP_HEIGHT;
-        gradientRaindrops[i].x = random(MATRIX_WIDTH);
+        gradientRaindrops[i].previousY = gradientRaindrops[i].y;
+        gradientRaindrops[i].x = fastRandom(MATRIX_WIDTH);
       }
     }
   }
   
-  // 확률적으로 새 빗방울 활성화
-  static unsigned long lastActivation = 0;
-  unsigned long currentTime = millis();
-  
-  if(currentTime - lastActivation > 1500) {  // 1.5초마다 체크
-    for(int i = 0; i < MAX_GRADIENT_RAINDROPS; i++) {
-      if(!gradientRaindrops[i].active && random(100) < 40) {  // 40% 확률
-        gradientRaindrops[i].active = true;
-        gradientRaindrops[i].x = random(MATRIX_WIDTH);
-        gradientRaindrops[i].y = MATRIX_HEIGHT + GRADIENT_RAINDROP_HEIGHT;  // 아래에서 시작
-        gradientRaindrops[i].speed = 1.2 + (random(100) / 200.0);  // 1.2 ~ 1.7 속도
-        lastActivation = currentTime;
-        break;
-      }
+  // 확률적으로 새 빗방울 활성화 (약 1.5초마다 확인 시작, 스텝마다 40% 확률)
+  if(stepsSinceActivation < RAIN_ACTIVATION_STEPS) {
+    stepsSinceActivation++;
+    return;
+  }
+  for(int i = 0; i < MAX_GRADIENT_RAINDROPS; i++) {
+    if(!gradientRaindrops[i].active && fastRandomChance(40)) {  // 40% 확률
+      gradientRaindrops[i].active = true;
+      gradientRaindrops[i].x = fastRandom(MATRIX_WIDTH);
+      gradientRaindrops[i].y = MATRIX_HEIGHT + GRADIENT_RAINDROP_HEIGHT;  // 아래에서 시작
+      gradientRaindrops[i].previousY = gradientRaindrops[i].y;
+      gradientRaindrops[i].speed = 1.2 + (fastRandom(100) / 200.0);  // 1.2 ~ 1.7 속도
+      stepsSinceActivation = 0;
+      break;
     }
   }
 }
 
+// ================= 그라데이션 빗방울 업데이트 =================
+// 지난 호출 이후 밀린 스텝만큼 진행 (호출 간격과 무관하게 같은 속도)
+void updateGradientRaindrops() {
+  simClockAdvance(&rainClock);
+  while(simClockStep(&rainClock)) {
+    stepGradientRaindrops();
+  }
+}
+
 // ================= 그라데이션 빗방울 그리기 (Y축 반전) =================
 void drawGradientRaindrops() {
+  uint8_t alpha = simClockAlpha(&rainClock);
+  
   for(int i = 0; i < MAX_GRADIENT_RAINDROPS; i++) {
     if(gradientRaindrops[i].active) {
       int baseX = (int)gradientRaindrops[i].x;
-      int baseY = (int)gradientRaindrops[i].y;
+      int baseY = (int)simClockLerp(gradientRaindrops[i].previousY, gradientRaindrops[i].y, alpha);
       
       // 5픽셀 그라데이션 빗방울 그리기 (순서 반전: 밝음→어두움)
       for(int py = 0; py < GRADIENT_RAINDROP_HEIGHT; py++) {
@@ -122,12 +145,24 @@ void drawGradientRaindrops() {
             // 일반 회색 빗방울
             setPixel(baseX, y, brightness, brightness, brightness);
           }
+#if RAIN_GLOW_RADIUS > 0
+          glowMarkPixel(baseX, y);
+#endif
         }
       }
     }
   }
 }
 
+// ================= 빛 번짐 =================
+void applyRainGlow() {
+#if RAIN_GLOW_RADIUS > 0
+  PROFILE_BEGIN(PROF_GLOW);
+  glowApply(RAIN_GLOW_RADIUS, RAIN_GLOW_GAIN, RAIN_GLOW_KERNEL);
+  PROFILE_END(PROF_GLOW);
+#endif
+}
+
 // ================= 기존 인터페이스 함수들 (호환성 유지) =================
 
 // 새로운 빗방울 생성 (더 이상 사용하지 않지만 호환성 유지)
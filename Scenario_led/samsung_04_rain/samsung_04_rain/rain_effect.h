@@ -22,6 +22,7 @@ void createRaindrop();
 void moveRaindrops();
 void drawRaindrops();
 void updateRainEffect();
+void applyRainGlow();   // 이번 프레임 빗방울에 빛 번짐 (RAIN_GLOW_RADIUS 0이면 아무것도 안 함)
 
 // ===== 새로운 비 배경 함수 =====
 void drawRainBackground();
@@ -7,6 +7,9 @@
 #include "cloud_effect.h"
 #include "lightning_effect.h"
 #include "fade_effect.h"
+#include "fast_random.h"
+#include "profiler.h"
+#include "glow_effect.h"
 
 enum Mode {
   MODE_CLOUD_MOTION = 0,    // 먹구름 모션 (0-6초)
@@ -19,10 +22,32 @@ enum Mode {
 
 Mode currentMode = MODE_CLOUD_MOTION;
 unsigned long programStartMs = 0;  // 전체 프로그램 시작 시간
+unsigned long lastRenderUs = 0;    // 마지막으로 그린 시각 (RENDER_FRAME_US 사용시)
 
 void setup() {
   // 기본 초기화
   initNeoPixel();
+
+#if defined(DEBUG_MODE)
+  Serial.begin(DEBUG_BAUDRATE);
+#elif defined(PROFILE_MODE)
+  Serial.begin(PROFILE_BAUDRATE);
+#endif
+#ifdef PROFILE_MODE
+  profileInit();
+#endif
+
+#ifdef GLOW_BENCH_MODE
+  // 측정 모드: 번짐 비용만 출력하고 꺼진 상태로 대기
+  runGlowBench();
+  currentMode = MODE_COMPLETE;
+  return;
+#endif
+
+  // 난수 시드 (로그의 시드를 RAIN_RANDOM_SEED에 넣으면 같은 화면 재현)
+  fastRandomBegin(RAIN_RANDOM_SEED);
+  DEBUG_PRINT("random seed: ");
+  DEBUG_PRINTLN(fastRandomSeedValue());
   
   // 프로그램 시작 시간 기록
   programStartMs = millis();
@@ -33,6 +58,9 @@ void setup() {
 }
 
 void loop() {
+  // 프로파일 덤프 요청 (완료 후에도 응답)
+  PROFILE_POLL();
+
   unsigned long now = millis();
   unsigned long programElapsed = now - programStartMs;
   
@@ -45,11 +73,27 @@ void loop() {
     }
     return;
   }
+
+#if RENDER_FRAME_US > 0
+  // 그리기 간격 제한 (움직임은 효과별 시뮬레이션 시계가 따라잡음, 번개는 자체 시각표로 전송)
+  if (currentMode != MODE_LIGHTNING) {
+    unsigned long nowUs = PowerStrip::nowUs();   // 블로킹 전송 시간 포함 (AVR micros()는 전송 중 멈춤)
+    if (nowUs - lastRenderUs < RENDER_FRAME_US) {
+      delay(1);
+      return;
+    }
+    lastRenderUs = nowUs;
+  }
+#endif
   
+  PROFILE_FRAME_BEGIN();
+
   // 각 모드별 처리 및 전환
   switch(currentMode) {
     case MODE_CLOUD_MOTION:
+      PROFILE_BEGIN(PROF_CLOUD);
       updateCloudMotion();
+      PROFILE_END(PROF_CLOUD);
       
       // 6초 경과 또는 먹구름 완료시 즉시 비로 전환
       if (programElapsed >= 6500 || isCloudMotionComplete()) {
@@ -61,20 +105,26 @@ void loop() {
       break;
       
     case MODE_RAIN_FIRST:
+      PROFILE_BEGIN(PROF_RAIN);
       updateRainWithBackground();
+      PROFILE_END(PROF_RAIN);
       
       // 정확히 12초에 번개로 전환
       if (programElapsed >= 6000) {
         currentMode = MODE_LIGHTNING;
         clearMatrix();
         strip.show();
+        PROFILE_BEGIN(PROF_IDLE);
         delay(20);
+        PROFILE_END(PROF_IDLE);
         initLightningEffect();
       }
       break;
       
     case MODE_LIGHTNING:
+      PROFILE_BEGIN(PROF_LIGHTNING);
       updateLightningEffect();
+      PROFILE_END(PROF_LIGHTNING);
       
       // 17초에 페이드인 시작
       if (programElapsed >= 9500) {
@@ -87,7 +137,9 @@ void loop() {
       break;
       
     case MODE_FADE_TO_RAIN:
+      PROFILE_BEGIN(PROF_FADE_TO_RAIN);
       updateFadeToRain();
+      PROFILE_END(PROF_FADE_TO_RAIN);
       
       // 18초에 두 번째 비로 전환
       if (programElapsed >= 18000 || isFadeToRainComplete()) {
@@ -96,7 +148,9 @@ void loop() {
       break;
       
     case MODE_RAIN_SECOND:
+      PROFILE_BEGIN(PROF_RAIN);
       updateRainWithBackground();
+      PROFILE_END(PROF_RAIN);
       // 30초까지 계속 (상단에서 처리)
       break;
       
@@ -106,5 +160,9 @@ void loop() {
   }
   
   // 프레임 안정성
+  PROFILE_BEGIN(PROF_IDLE);
   delay(5);
+  PROFILE_END(PROF_IDLE);
+
+  PROFILE_FRAME_END();
 }
\ No newline at end of file
@@ -0,0 +1,40 @@
+// sim_clock.cpp - 고정 간격 시뮬레이션 시계 구현
+
+#include "sim_clock.h"
+#include "power_strip.h"
+
+// ================= 시계 함수 =================
+void simClockBegin(SimClock* clock, uint32_t stepUs) {
+  clock->lastUs = PowerStrip::nowUs();
+  clock->accumulatorUs = 0;
+  clock->stepUs = stepUs;
+}
+
+// 경과 시간 누적 (모드 전환 delay 등으로 오래 멈췄으면 SIM_MAX_CATCHUP_STEPS 스텝만 따라잡고 나머지는 버림)
+void simClockAdvance(SimClock* clock) {
+  unsigned long now = PowerStrip::nowUs();
+  clock->accumulatorUs += now - clock->lastUs;
+  clock->lastUs = now;
+
+  uint32_t limit = clock->stepUs * SIM_MAX_CATCHUP_STEPS;
+  if (clock->accumulatorUs > limit) {
+    clock->accumulatorUs = limit;
+  }
+}
+
+bool simClockStep(SimClock* clock) {
+  if (clock->accumulatorUs < clock->stepUs) return false;
+  clock->accumulatorUs -= clock->stepUs;
+  return true;
+}
+
+// 남은 누적 시간 / 스텝 간격 (Q8, 프레임당 나눗셈 한 번)
+uint8_t simClockAlpha(const SimClock* clock) {
+  if (clock->accumulatorUs >= clock->stepUs) return 255;
+  return (uint8_t)((clock->accumulatorUs << 8) / clock->stepUs);
+}
+
+// ================= 보간 =================
+float simClockLerp(float previous, float current, uint8_t alpha) {
+  return previous + (current - previous) * (alpha * (1.0f / 256));
+}
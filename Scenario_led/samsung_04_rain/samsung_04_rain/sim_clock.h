@@ -0,0 +1,32 @@
+// sim_clock.h - 고정 간격 시뮬레이션 시계 (움직임과 그리기 분리)
+// 효과 상태는 stepUs마다 한 스텝씩만 진행하고, 그릴 때는 직전 상태와 현재 상태 사이를 보간
+// → loop()/전송 간격이 바뀌어도 움직이는 속도는 그대로, 프레임을 줄여도 안무는 같음
+// 시각은 PowerStrip::nowUs() 기준 (power_strip.h)
+//
+// 사용:
+//   simClockAdvance(&clock);                         // 지난 호출 이후 경과 시간 누적
+//   while (simClockStep(&clock)) { 이전 = 현재; 현재 = 한 스텝 진행; }
+//   그리기 = simClockLerp(이전, 현재, simClockAlpha(&clock));
+
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <Arduino.h>
+#include "config.h"
+
+struct SimClock {
+  unsigned long lastUs;     // 마지막 simClockAdvance 시각 (PowerStrip::nowUs)
+  uint32_t accumulatorUs;   // 아직 진행하지 않은 시간
+  uint32_t stepUs;          // 스텝 간격 (효과가 단계마다 바꿔도 됨)
+};
+
+// ===== 시계 함수 =====
+void simClockBegin(SimClock* clock, uint32_t stepUs);
+void simClockAdvance(SimClock* clock);
+bool simClockStep(SimClock* clock);                 // 누적 시간이 한 스텝 이상이면 빼고 true
+uint8_t simClockAlpha(const SimClock* clock);       // 직전 → 현재 상태 보간 비율 (0~255)
+
+// ===== 보간 =====
+float simClockLerp(float previous, float current, uint8_t alpha);
+
+#endif
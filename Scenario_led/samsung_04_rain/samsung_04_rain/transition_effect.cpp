@@ -0,0 +1,49 @@
+// transition_effect.cpp - 거리 필드 기반 화면 전환 구현
+
+#include "transition_effect.h"
+#include "transition_fields.h"
+#include "control.h"
+
+#define TRANSITION_FRONT_MAX (255 + TRANSITION_EDGE)
+
+// ================= 전환 경계 =================
+
+uint16_t transitionFront(unsigned long elapsedMs, unsigned long durationMs) {
+  if(elapsedMs >= durationMs) return TRANSITION_FRONT_MAX;
+  return (uint32_t)elapsedMs * TRANSITION_FRONT_MAX / durationMs;
+}
+
+// ================= 마스크 적용 =================
+
+// 경계 - 필드값이 가장자리 폭 이상이면 드러난 픽셀, 0 이하면 가려진 픽셀
+// 가장자리 안의 픽셀만 램프 테이블로 밝기 조절 (읽기-곱셈-쓰기)
+void applyTransitionMask(TransitionField field, uint16_t front, bool reveal) {
+  const uint8_t* values = transitionFields[field];
+
+  for(int i = 0; i < LED_COUNT; i++) {
+    uint8_t value = pgm_read_byte(&values[i]);
+    uint8_t level;
+
+    if(front >= (uint16_t)value + TRANSITION_EDGE) {
+      if(reveal) continue;
+      level = 0;
+    } else if(front <= value) {
+      if(!reveal) continue;
+      level = 0;
+    } else {
+      level = pgm_read_byte(&transitionRamp[front - value]);
+      if(!reveal) level = 255 - level;
+    }
+
+    if(level == 0) {
+      strip.setPixelColor(i, 0);
+      continue;
+    }
+
+    uint32_t c = strip.getPixelColor(i);
+    uint8_t r = (((c >> 16) & 0xFF) * level) >> 8;
+    uint8_t g = (((c >>  8) & 0xFF) * level) >> 8;
+    uint8_t b = (((c >>  0) & 0xFF) * level) >> 8;
+    strip.setPixelColor(i, r, g, b);
+  }
+}
@@ -0,0 +1,26 @@
+// transition_effect.h - 거리 필드 기반 화면 전환 (원형/대각선/열/디졸브)
+// 필드 값(0~255)은 transition_fields.h에 PROGMEM으로 미리 계산, 프레임당 픽셀마다 비교 한 번
+
+#ifndef TRANSITION_EFFECT_H
+#define TRANSITION_EFFECT_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ===== 전환 필드 (transition_fields.h 순서와 같음) =====
+enum TransitionField {
+  FIELD_RADIAL = 0,   // 가운데에서 바깥으로
+  FIELD_DIAGONAL,     // 왼쪽 위에서 오른쪽 아래로
+  FIELD_COLUMN,       // 왼쪽 열부터
+  FIELD_NOISE         // 무작위 디졸브
+};
+
+// ===== 전환 함수 =====
+// 경과 시간 → 전환 경계 (0 ~ 255 + 가장자리 폭), 경계가 끝까지 가면 전체 화면이 드러남
+uint16_t transitionFront(unsigned long elapsedMs, unsigned long durationMs);
+
+// 이미 그린 프레임에 마스크 적용
+// reveal이 true면 경계 안쪽만 보이고, false면 경계 안쪽부터 꺼짐
+void applyTransitionMask(TransitionField field, uint16_t front, bool reveal);
+
+#endif
@@ -0,0 +1,157 @@
+// transition_fields.h - PROGMEM 전환 필드 (field_export로 생성, 직접 수정 금지)
+// 스트립 인덱스 순서, 값 0~255 = 드러나는 순서 (32x16 세로 지그재그)
+
+#ifndef TRANSITION_FIELDS_H
+#define TRANSITION_FIELDS_H
+
+#include <Arduino.h>
+
+#define TRANSITION_FIELD_COUNT 4
+#define TRANSITION_FIELD_PIXELS 512
+#define TRANSITION_EDGE 16
+
+// 가장자리 밝기 (0~255, smoothstep)
+const uint8_t transitionRamp[TRANSITION_EDGE] PROGMEM = {
+  0, 3, 11, 24, 40, 59, 81, 104, 128, 151, 174, 196, 215, 231, 244, 252
+};
+
+const uint8_t transitionFields[TRANSITION_FIELD_COUNT][TRANSITION_FIELD_PIXELS] PROGMEM = {
+  { // radial
+    255, 249, 244, 239, 235, 233, 231, 230, 230, 231, 233, 235, 239, 244, 249, 255,
+    242, 235, 230, 225, 221, 218, 216, 215, 215, 216, 218, 221, 225, 230, 235, 242,
+    229, 222, 216, 211, 207, 203, 201, 200, 200, 201, 203, 207, 211, 216, 222, 229,
+    216, 209, 202, 197, 192, 189, 186, 185, 185, 186, 189, 192, 197, 202, 209, 216,
+    203, 196, 189, 183, 178, 174, 172, 170, 170, 172, 174, 178, 183, 189, 196, 203,
+    191, 183, 176, 169, 164, 160, 157, 156, 156, 157, 160, 164, 169, 176, 183, 191,
+    179, 170, 163, 156, 150, 145, 142, 141, 141, 142, 145, 150, 156, 163, 170, 179,
+    168, 158, 150, 142, 136, 131, 128, 126, 126, 128, 131, 136, 142, 150, 158, 168,
+    157, 147, 138, 130, 123, 117, 113, 111, 111, 113, 117, 123, 130, 138, 147, 157,
+    147, 136, 126, 117, 109, 103, 99, 97, 97, 99, 103, 109, 117, 126, 136, 147,
+    138, 126, 115, 105, 97, 89, 84, 82, 82, 84, 89, 97, 105, 115, 126, 138,
+    130, 117, 105, 94, 84, 76, 70, 67, 67, 70, 76, 84, 94, 105, 117, 130,
+    123, 109, 97, 84, 73, 64, 56, 52, 52, 56, 64, 73, 84, 97, 109, 123,
+    117, 103, 89, 76, 64, 52, 43, 38, 38, 43, 52, 64, 76, 89, 103, 117,
+    113, 99, 84, 70, 56, 43, 31, 23, 23, 31, 43, 56, 70, 84, 99, 113,
+    111, 97, 82, 67, 52, 38, 23, 10, 10, 23, 38, 52, 67, 82, 97, 111,
+    111, 97, 82, 67, 52, 38, 23, 10, 10, 23, 38, 52, 67, 82, 97, 111,
+    113, 99, 84, 70, 56, 43, 31, 23, 23, 31, 43, 56, 70, 84, 99, 113,
+    117, 103, 89, 76, 64, 52, 43, 38, 38, 43, 52, 64, 76, 89, 103, 117,
+    123, 109, 97, 84, 73, 64, 56, 52, 52, 56, 64, 73, 84, 97, 109, 123,
+    130, 117, 105, 94, 84, 76, 70, 67, 67, 70, 76, 84, 94, 105, 117, 130,
+    138, 126, 115, 105, 97, 89, 84, 82, 82, 84, 89, 97, 105, 115, 126, 138,
+    147, 136, 126, 117, 109, 103, 99, 97, 97, 99, 103, 109, 117, 126, 136, 147,
+    157, 147, 138, 130, 123, 117, 113, 111, 111, 113, 117, 123, 130, 138, 147, 157,
+    168, 158, 150, 142, 136, 131, 128, 126, 126, 128, 131, 136, 142, 150, 158, 168,
+    179, 170, 163, 156, 150, 145, 142, 141, 141, 142, 145, 150, 156, 163, 170, 179,
+    191, 183, 176, 169, 164, 160, 157, 156, 156, 157, 160, 164, 169, 176, 183, 191,
+    203, 196, 189, 183, 178, 174, 172, 170, 170, 172, 174, 178, 183, 189, 196, 203,
+    216, 209, 202, 197, 192, 189, 186, 185, 185, 186, 189, 192, 197, 202, 209, 216,
+    229, 222, 216, 211, 207, 203, 201, 200, 200, 201, 203, 207, 211, 216, 222, 229,
+    242, 235, 230, 225, 221, 218, 216, 215, 215, 216, 218, 221, 225, 230, 235, 242,
+    255, 249, 244, 239, 235, 233, 231, 230, 230, 231, 233, 235, 239, 244, 249, 255,
+  },
+  { // diagonal
+    0, 6, 11, 17, 22, 28, 33, 39, 44, 50, 55, 61, 67, 72, 78, 83,
+    89, 83, 78, 72, 67, 61, 55, 50, 44, 39, 33, 28, 22, 17, 11, 6,
+    11, 17, 22, 28, 33, 39, 44, 50, 55, 61, 67, 72, 78, 83, 89, 94,
+    100, 94, 89, 83, 78, 72, 67, 61, 55, 50, 44, 39, 33, 28, 22, 17,
+    22, 28, 33, 39, 44, 50, 55, 61, 67, 72, 78, 83, 89, 94, 100, 105,
+    111, 105, 100, 94, 89, 83, 78, 72, 67, 61, 55, 50, 44, 39, 33, 28,
+    33, 39, 44, 50, 55, 61, 67, 72, 78, 83, 89, 94, 100, 105, 111, 116,
+    122, 116, 111, 105, 100, 94, 89, 83, 78, 72, 67, 61, 55, 50, 44, 39,
+    44, 50, 55, 61, 67, 72, 78, 83, 89, 94, 100, 105, 111, 116, 122, 128,
+    133, 128, 122, 116, 111, 105, 100, 94, 89, 83, 78, 72, 67, 61, 55, 50,
+    55, 61, 67, 72, 78, 83, 89, 94, 100, 105, 111, 116, 122, 128, 133, 139,
+    144, 139, 133, 128, 122, 116, 111, 105, 100, 94, 89, 83, 78, 72, 67, 61,
+    67, 72, 78, 83, 89, 94, 100, 105, 111, 116, 122, 128, 133, 139, 144, 150,
+    155, 150, 144, 139, 133, 128, 122, 116, 111, 105, 100, 94, 89, 83, 78, 72,
+    78, 83, 89, 94, 100, 105, 111, 116, 122, 128, 133, 139, 144, 150, 155, 161,
+    166, 161, 155, 150, 144, 139, 133, 128, 122, 116, 111, 105, 100, 94, 89, 83,
+    89, 94, 100, 105, 111, 116, 122, 128, 133, 139, 144, 150, 155, 161, 166, 172,
+    177, 172, 166, 161, 155, 150, 144, 139, 133, 128, 122, 116, 111, 105, 100, 94,
+    100, 105, 111, 116, 122, 128, 133, 139, 144, 150, 155, 161, 166, 172, 177, 183,
+    188, 183, 177, 172, 166, 161, 155, 150, 144, 139, 133, 128, 122, 116, 111, 105,
+    111, 116, 122, 128, 133, 139, 144, 150, 155, 161, 166, 172, 177, 183, 188, 194,
+    200, 194, 188, 183, 177, 172, 166, 161, 155, 150, 144, 139, 133, 128, 122, 116,
+    122, 128, 133, 139, 144, 150, 155, 161, 166, 172, 177, 183, 188, 194, 200, 205,
+    211, 205, 200, 194, 188, 183, 177, 172, 166, 161, 155, 150, 144, 139, 133, 128,
+    133, 139, 144, 150, 155, 161, 166, 172, 177, 183, 188, 194, 200, 205, 211, 216,
+    222, 216, 211, 205, 200, 194, 188, 183, 177, 172, 166, 161, 155, 150, 144, 139,
+    144, 150, 155, 161, 166, 172, 177, 183, 188, 194, 200, 205, 211, 216, 222, 227,
+    233, 227, 222, 216, 211, 205, 200, 194, 188, 183, 177, 172, 166, 161, 155, 150,
+    155, 161, 166, 172, 177, 183, 188, 194, 200, 205, 211, 216, 222, 227, 233, 238,
+    244, 238, 233, 227, 222, 216, 211, 205, 200, 194, 188, 183, 177, 172, 166, 161,
+    166, 172, 177, 183, 188, 194, 200, 205, 211, 216, 222, 227, 233, 238, 244, 249,
+    255, 249, 244, 238, 233, 227, 222, 216, 211, 205, 200, 194, 188, 183, 177, 172,
+  },
+  { // column
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+    107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+    123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+    132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+    140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+    148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+    156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+    173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197,
+    206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206,
+    214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+    222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+    247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  },
+  { // noise
+    0, 107, 211, 89, 220, 96, 173, 157, 233, 70, 186, 5, 164, 65, 177, 249,
+    40, 79, 12, 32, 42, 75, 147, 47, 117, 6, 127, 60, 153, 138, 241, 69,
+    24, 15, 161, 134, 100, 58, 189, 112, 250, 86, 26, 114, 207, 136, 220, 210,
+    30, 27, 10, 33, 203, 250, 116, 200, 244, 36, 16, 92, 162, 111, 10, 214,
+    223, 25, 164, 145, 131, 218, 145, 174, 154, 109, 113, 190, 72, 14, 217, 103,
+    49, 95, 167, 85, 227, 182, 101, 17, 231, 124, 151, 57, 2, 111, 42, 110,
+    6, 140, 52, 86, 74, 23, 58, 184, 202, 247, 246, 45, 48, 203, 23, 249,
+    61, 134, 196, 21, 208, 117, 59, 28, 113, 37, 217, 199, 73, 162, 172, 176,
+    144, 131, 47, 149, 141, 141, 163, 226, 180, 187, 55, 187, 204, 24, 88, 195,
+    95, 63, 214, 238, 176, 62, 123, 103, 96, 88, 161, 87, 100, 51, 79, 49,
+    16, 85, 64, 3, 156, 253, 166, 15, 155, 188, 108, 60, 156, 80, 35, 244,
+    4, 237, 121, 228, 213, 212, 237, 0, 81, 199, 93, 132, 160, 133, 216, 153,
+    221, 3, 18, 255, 157, 222, 167, 19, 202, 140, 175, 231, 190, 59, 239, 230,
+    224, 105, 119, 177, 165, 110, 82, 66, 151, 129, 152, 5, 97, 230, 243, 192,
+    71, 168, 148, 52, 215, 206, 172, 38, 78, 194, 104, 191, 39, 30, 54, 171,
+    20, 166, 68, 232, 130, 243, 149, 22, 101, 70, 185, 236, 2, 71, 221, 181,
+    204, 179, 135, 11, 170, 229, 32, 248, 228, 192, 19, 207, 12, 109, 193, 154,
+    27, 147, 245, 191, 29, 136, 245, 242, 227, 76, 178, 50, 124, 181, 135, 143,
+    143, 251, 123, 238, 225, 184, 229, 183, 13, 91, 248, 91, 65, 67, 75, 235,
+    7, 254, 46, 73, 4, 215, 171, 159, 247, 68, 97, 255, 211, 125, 94, 160,
+    106, 121, 44, 159, 198, 94, 142, 128, 222, 81, 133, 186, 128, 37, 25, 206,
+    99, 13, 119, 18, 170, 33, 115, 31, 120, 122, 36, 209, 236, 210, 116, 218,
+    188, 252, 102, 43, 41, 197, 195, 35, 122, 193, 169, 56, 180, 99, 1, 182,
+    87, 152, 22, 146, 105, 26, 137, 102, 125, 118, 142, 208, 126, 189, 41, 169,
+    137, 17, 8, 93, 90, 174, 254, 63, 223, 196, 62, 39, 158, 67, 168, 234,
+    225, 107, 155, 34, 45, 213, 205, 246, 178, 82, 114, 78, 34, 28, 77, 197,
+    11, 51, 84, 209, 56, 163, 226, 205, 242, 148, 216, 150, 219, 120, 127, 1,
+    90, 144, 251, 53, 241, 40, 146, 31, 7, 14, 80, 50, 165, 139, 253, 104,
+    64, 83, 74, 21, 84, 194, 98, 183, 126, 53, 158, 219, 38, 29, 198, 132,
+    76, 48, 9, 200, 130, 57, 252, 98, 150, 43, 54, 9, 55, 212, 77, 129,
+    240, 92, 72, 66, 185, 8, 89, 44, 179, 201, 115, 239, 108, 46, 173, 233,
+    20, 240, 138, 232, 69, 175, 224, 201, 61, 106, 139, 112, 235, 118, 234, 83,
+  },
+};
+
+#endif
@@ -0,0 +1,208 @@
+// companion_face.cpp - 컴패니언 표정 구현
+
+#include "companion_face.h"
+#include "control.h"
+#include "shape_raster.h"
+
+// ================= 얼굴 배치 (1/16 픽셀) =================
+#define EYE_LEFT_X      RASTER_PX(9.5)
+#define EYE_RIGHT_X     RASTER_PX(22.5)
+#define EYE_Y           RASTER_PX(6.5)
+#define EYE_HALF_WIDTH  RASTER_PX(3)
+#define EYE_MAX_HEIGHT  RASTER_PX(8)
+#define EYE_MIN_HEIGHT  RASTER_PX(1)      // 감은 눈도 가는 막대로 보임
+#define EYE_RADIUS      RASTER_PX(2)
+#define BROW_Y          RASTER_PX(1.5)
+#define MOUTH_X         RASTER_PX(16)
+#define MOUTH_Y         RASTER_PX(12.5)
+#define MOUTH_HALF      RASTER_PX(4.5)
+#define MOUTH_INNER     RASTER_PX(2)
+#define BLUSH_Y         RASTER_PX(11.5)
+#define HEART_X         RASTER_PX(16)
+#define HEART_Y         RASTER_PX(8)
+
+// ================= 색상 =================
+#define EYE_COLOR    0x28BEFFUL   // (40, 190, 255)
+#define BROW_COLOR   0x1E6EAAUL   // (30, 110, 170)
+#define MOUTH_COLOR  0xFF8C3CUL   // (255, 140, 60)
+#define BLUSH_COLOR  0xFF3C5AUL   // (255, 60, 90)
+#define RING_COLOR   0x78DCFFUL   // (120, 220, 255)
+#define HEART_COLOR  0xFF2850UL   // (255, 40, 80)
+
+// ================= 표정 키프레임 =================
+struct FaceKey {
+  uint16_t atMs;
+  FaceParams face;
+};
+
+//   lookX, lookY, browLift, browTilt, mouthCurve, eyeOpen, mouthOpen, blush, ring, heart
+static const FaceKey faceKeys[] PROGMEM = {
+  {     0, {            0,           0,            0, 0,           0,   0,   0,   0,   0,   0 } },  // 감은 눈
+  {   600, {            0,           0,            0, 0, RASTER_PX(0.5), 200,  0,   0,   0,   0 } },  // 깨어남
+  {  2000, { RASTER_PX(-3),          0,            0, 0, RASTER_PX(0.5), 200,  0,   0,   0,   0 } },  // 왼쪽 보기
+  {  3000, { RASTER_PX(3),           0,            0, 0, RASTER_PX(0.5), 200,  0,   0,   0,   0 } },  // 오른쪽 보기
+  {  4000, {            0,           0,            0, 0, RASTER_PX(0.5), 200,  0,   0,   0,   0 } },
+  {  5000, {            0,           0, RASTER_PX(0.5), 0, RASTER_PX(1.5), 120, 60, 255,   0,   0 } },  // 기쁨
+  {  7000, {            0,           0, RASTER_PX(0.5), 0, RASTER_PX(1.5), 120, 60, 255,   0,   0 } },
+  {  7800, {            0,           0, RASTER_PX(1.5), 0,           0, 255, 255,   0,   0,   0 } },  // 놀람
+  {  9300, {            0,           0, RASTER_PX(1.5), 0,           0, 255, 255,   0,   0,   0 } },
+  { 10000, {            0, RASTER_PX(1), RASTER_PX(-0.5), RASTER_PX(1), RASTER_PX(-0.5), 60, 0, 0, 0, 0 } },  // 졸림/시무룩
+  { 11500, {            0,           0,            0, 0,           0, 230,   0,   0, 255,   0 } },  // 듣는 중
+  { 13000, {            0,           0,            0, 0,           0,   0,   0,   0,   0, 255 } },  // 하트
+  { 14500, {            0,           0,            0, 0,           0,   0,   0,   0,   0, 255 } },
+  { 15500, {            0,           0,            0, 0,           0,   0,   0,   0,   0,   0 } },
+};
+#define FACE_KEY_COUNT (uint8_t)(sizeof(faceKeys) / sizeof(faceKeys[0]))
+
+// ================= 보간 =================
+static int16_t lerp16(int16_t from, int16_t to, uint16_t t) {
+  return from + (int16_t)(((int32_t)(to - from) * t) >> 8);
+}
+
+// smoothstep (Q8): 3t² - 2t³
+static uint16_t easeQ8(uint16_t t) {
+  uint32_t t2 = (uint32_t)t * t;
+  return (uint16_t)((3 * t2 - ((2 * t2 * t) >> 8)) >> 8);
+}
+
+static void readKey(uint8_t index, FaceKey* key) {
+  memcpy_P(key, &faceKeys[index], sizeof(FaceKey));
+}
+
+unsigned long faceSequenceMs() {
+  FaceKey last;
+  readKey(FACE_KEY_COUNT - 1, &last);
+  return last.atMs;
+}
+
+void faceParamsAt(unsigned long elapsedMs, FaceParams* face) {
+  FaceKey from, to;
+  uint8_t i = 0;
+  readKey(0, &from);
+  to = from;
+  while(i + 1 < FACE_KEY_COUNT) {
+    readKey(i + 1, &to);
+    if(elapsedMs < to.atMs) break;
+    from = to;
+    i++;
+  }
+
+  uint16_t t = 256;
+  if(to.atMs > from.atMs && elapsedMs < to.atMs) {
+    t = easeQ8((uint16_t)(((uint32_t)(elapsedMs - from.atMs) << 8) / (to.atMs - from.atMs)));
+  }
+
+  const FaceParams& a = from.face;
+  const FaceParams& b = to.face;
+  face->lookX = lerp16(a.lookX, b.lookX, t);
+  face->lookY = lerp16(a.lookY, b.lookY, t);
+  face->browLift = lerp16(a.browLift, b.browLift, t);
+  face->browTilt = lerp16(a.browTilt, b.browTilt, t);
+  face->mouthCurve = lerp16(a.mouthCurve, b.mouthCurve, t);
+  face->eyeOpen = lerp16(a.eyeOpen, b.eyeOpen, t);
+  face->mouthOpen = lerp16(a.mouthOpen, b.mouthOpen, t);
+  face->blush = lerp16(a.blush, b.blush, t);
+  face->ring = lerp16(a.ring, b.ring, t);
+  face->heart = lerp16(a.heart, b.heart, t);
+
+  // 깜빡임: 주기마다 FACE_BLINK_MS 동안 감았다가 다시 뜸 (삼각형)
+  unsigned long phase = elapsedMs % FACE_BLINK_PERIOD_MS;
+  if(phase < FACE_BLINK_MS) {
+    long half = FACE_BLINK_MS / 2;
+    uint16_t open = (uint16_t)(abs((long)phase - half) * 256 / half);
+    face->eyeOpen = (uint8_t)((face->eyeOpen * open) >> 8);
+  }
+}
+
+// ================= 부분별 그리기 =================
+static uint32_t scaleColor(uint32_t color, uint8_t amount) {
+  uint8_t r = ((color >> 16) & 0xFF) * amount >> 8;
+  uint8_t g = ((color >> 8) & 0xFF) * amount >> 8;
+  uint8_t b = (color & 0xFF) * amount >> 8;
+  return strip.Color(r, g, b);
+}
+
+static void drawEye(int16_t cx, const FaceParams* face, uint32_t color) {
+  int16_t height = EYE_MIN_HEIGHT + (int16_t)((uint32_t)(EYE_MAX_HEIGHT - EYE_MIN_HEIGHT) * face->eyeOpen >> 8);
+  int16_t x = cx + face->lookX;
+  int16_t y = EYE_Y + face->lookY;
+  rasterRoundRect(x - EYE_HALF_WIDTH, y - height / 2, x + EYE_HALF_WIDTH, y + height - height / 2,
+                  EYE_RADIUS, color);
+}
+
+// side: -1 = 왼쪽 눈썹, 1 = 오른쪽 (안쪽 끝이 browTilt만큼 내려감)
+static void drawBrow(int16_t cx, int8_t side, const FaceParams* face, uint32_t color) {
+  int16_t y = BROW_Y - face->browLift + face->lookY / 2;
+  int16_t x = cx + face->lookX / 2;
+  int16_t outerY = y - face->browTilt / 2;
+  int16_t innerY = y + face->browTilt / 2;
+  rasterLine(x + side * EYE_HALF_WIDTH, outerY, x - side * (EYE_HALF_WIDTH - RASTER_PX(1)), innerY, color);
+}
+
+// 입: 양 끝 + 위/아래 안쪽 두 점씩의 육각형, 입꼬리는 mouthCurve, 두께는 mouthOpen
+static void drawMouth(const FaceParams* face, uint32_t color) {
+  int16_t cornerY = MOUTH_Y - face->mouthCurve;
+  int16_t topY = MOUTH_Y + face->mouthCurve / 2;
+  int16_t bottomY = topY + RASTER_PX(1) + (int16_t)((uint32_t)RASTER_PX(3) * face->mouthOpen >> 8);
+  int16_t points[12] = {
+    (int16_t)(MOUTH_X - MOUTH_HALF),  cornerY,
+    (int16_t)(MOUTH_X - MOUTH_INNER), topY,
+    (int16_t)(MOUTH_X + MOUTH_INNER), topY,
+    (int16_t)(MOUTH_X + MOUTH_HALF),  cornerY,
+    (int16_t)(MOUTH_X + MOUTH_INNER), bottomY,
+    (int16_t)(MOUTH_X - MOUTH_INNER), bottomY,
+  };
+  rasterPolygon(points, 6, color);
+}
+
+// 하트: 위쪽 원 두 개 + 아래 삼각형 (size 0~255)
+static void drawHeart(uint8_t size) {
+  int16_t lobe = (int16_t)((uint32_t)RASTER_PX(2.9) * size >> 8);
+  int16_t offset = (int16_t)((uint32_t)RASTER_PX(2.6) * size >> 8);
+  int16_t lobeY = HEART_Y - (int16_t)((uint32_t)RASTER_PX(2) * size >> 8);
+  int16_t tipY = HEART_Y + (int16_t)((uint32_t)RASTER_PX(5.5) * size >> 8);
+  int16_t sideX = (int16_t)((uint32_t)RASTER_PX(5.3) * size >> 8);
+  int16_t sideY = lobeY + (int16_t)((uint32_t)RASTER_PX(1.2) * size >> 8);
+  rasterCircle(HEART_X - offset, lobeY, lobe, HEART_COLOR);
+  rasterCircle(HEART_X + offset, lobeY, lobe, HEART_COLOR);
+  int16_t points[6] = {
+    (int16_t)(HEART_X - sideX), sideY,
+    (int16_t)(HEART_X + sideX), sideY,
+    HEART_X, tipY,
+  };
+  rasterPolygon(points, 3, HEART_COLOR);
+}
+
+// ================= 표정 그리기 =================
+void drawFace(const FaceParams* face) {
+  clearMatrix();
+
+  if(face->blush > 0) {
+    uint32_t blush = scaleColor(BLUSH_COLOR, face->blush);
+    rasterEllipse(EYE_LEFT_X - RASTER_PX(2), BLUSH_Y, RASTER_PX(2.5), RASTER_PX(1.25), blush);
+    rasterEllipse(EYE_RIGHT_X + RASTER_PX(2), BLUSH_Y, RASTER_PX(2.5), RASTER_PX(1.25), blush);
+  }
+
+  // 하트가 커지는 만큼 눈/눈썹이 어두워지고, 고리/하트가 커지는 만큼 입이 어두워짐
+  uint8_t faceLevel = 255 - face->heart;
+  uint8_t mouthLevel = 255 - max(face->ring, face->heart);
+  if(faceLevel > 0) {
+    uint32_t eyeColor = scaleColor(EYE_COLOR, faceLevel);
+    uint32_t browColor = scaleColor(BROW_COLOR, faceLevel);
+    drawEye(EYE_LEFT_X, face, eyeColor);
+    drawEye(EYE_RIGHT_X, face, eyeColor);
+    drawBrow(EYE_LEFT_X, -1, face, browColor);
+    drawBrow(EYE_RIGHT_X, 1, face, browColor);
+  }
+  if(mouthLevel > 0) {
+    drawMouth(face, scaleColor(MOUTH_COLOR, mouthLevel));
+  }
+  if(face->ring > 0) {
+    int16_t rx = (int16_t)((uint32_t)RASTER_PX(3.5) * face->ring >> 8);
+    int16_t ry = (int16_t)((uint32_t)RASTER_PX(2.5) * face->ring >> 8);
+    rasterEllipseRing(MOUTH_X, MOUTH_Y + RASTER_PX(0.5), rx, ry, RASTER_PX(1), RING_COLOR);
+  }
+  if(face->heart > 0) {
+    drawHeart(face->heart);
+  }
+}
@@ -0,0 +1,33 @@
+// companion_face.h - 컴패니언 표정 (눈/눈썹/입/볼/아이콘) 헤더
+// 표정은 숫자 파라미터 묶음이고, 키프레임 사이를 보간해서 모양이 부드럽게 바뀜
+// 그리기는 모두 shape_raster (눈 = 둥근 사각형, 눈썹 = 선, 입 = 다각형, 볼 = 타원, 하트 = 원 + 다각형)
+
+#ifndef COMPANION_FACE_H
+#define COMPANION_FACE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ===== 표정 파라미터 (길이는 1/16 픽셀) =====
+struct FaceParams {
+  int16_t lookX;        // 눈 위치 이동 (가로)
+  int16_t lookY;        // 눈 위치 이동 (세로, 양수 = 아래)
+  int16_t browLift;     // 눈썹 높이 (양수 = 위로)
+  int16_t browTilt;     // 눈썹 기울기 (양수 = 안쪽이 내려감)
+  int16_t mouthCurve;   // 입꼬리 높이 (양수 = 웃음, 음수 = 찡그림)
+  uint8_t eyeOpen;      // 눈 높이 (0 = 감음, 255 = 최대)
+  uint8_t mouthOpen;    // 입 벌림 (0 = 다묾, 255 = 최대)
+  uint8_t blush;        // 볼 홍조 밝기
+  uint8_t ring;         // 듣는 중 표시 (입 자리 고리) 크기
+  uint8_t heart;        // 하트 아이콘 크기
+};
+
+// ===== 시퀀스 =====
+// 시작 기준 ms의 표정 (키프레임 보간 + 주기적인 눈 깜빡임)
+void faceParamsAt(unsigned long elapsedMs, FaceParams* face);
+unsigned long faceSequenceMs();
+
+// ===== 그리기 (화면을 지우고 표정 전체를 그림, 전송은 호출한 쪽에서) =====
+void drawFace(const FaceParams* face);
+
+#endif
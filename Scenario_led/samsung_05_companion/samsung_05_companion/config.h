@@ -0,0 +1,69 @@
+// config.h - 컴패니언 표정 매트릭스 설정 파일
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+// ================= 하드웨어 설정 =================
+// NeoPixel 핀 설정
+#define LED_PIN    6              // Arduino 디지털 핀 6번
+
+// NeoPixel 개수
+#define LED_COUNT  512            // 총 LED 개수 (32 x 16)
+
+// 매트릭스 크기 설정 (samsung_04_rain과 같은 세로 지그재그 배치)
+#define MATRIX_WIDTH  32          // 가로 32개
+#define MATRIX_HEIGHT 16          // 세로 16개
+
+// NeoPixel 타입 설정
+#define PIXEL_TYPE (NEO_GRB + NEO_KHZ800)  // WS2812B 타입
+
+// ================= 밝기 설정 =================
+#define DEFAULT_BRIGHTNESS 20     // 약 8% 밝기 (실내용)
+
+// ================= 전류 제한 설정 (power_strip.cpp) =================
+// 예산을 넘는 프레임만 밝기를 낮추고 이후 프레임마다 POWER_RELEASE_STEP씩 회복
+#ifndef POWER_LIMIT_MA
+#define POWER_LIMIT_MA 2500          // LED 전체 전류 예산 (mA), 0이면 제한 안 함
+#endif
+#define LED_CHANNEL_MA 20            // 채널 하나 최대 전류 (전송 값 255 기준)
+#define LED_IDLE_MA 1                // LED 하나 대기 전류
+#define POWER_RELEASE_STEP 2         // 프레임당 밝기 회복량
+
+// ================= 래스터라이저 설정 (shape_raster.cpp) =================
+#define RASTER_SUBROWS 4             // 채우기 도형의 행당 부분 스캔라인 수 (세로 안티에일리어싱 단계)
+#define RASTER_MAX_POLY_POINTS 8     // 다각형 최대 꼭짓점 수
+
+// ================= 표정 설정 (companion_face.cpp) =================
+#define FACE_BLINK_PERIOD_MS 3200    // 눈 깜빡임 간격
+#define FACE_BLINK_MS 160            // 눈 깜빡임 길이 (감았다 뜨는 전체)
+#define FACE_FRAME_BUDGET_US 33333   // 프레임 예산 (30fps, 전송 시간 포함)
+
+// ================= 글자 스크롤 설정 (text_scroller.cpp) =================
+// 열 캐시는 화면 폭 + 글자 하나만 담고 스크롤하면서 새 글자 열을 채움 (메시지 길이 제한 없음)
+// ATmega328 SRAM 2048B 예산: 픽셀 버퍼 1536B (힙) + 열 캐시 96B + 행 색 64B + 래스터 행 덮임 64B
+//   + 나머지 전역 약 40B → 약 1800B, 스택에 약 250B (textDraw는 행 단위라 큰 스택 표 없음)
+#define TEXT_CACHE_COLUMNS 48        // 열 캐시 크기 (열당 2바이트 RAM, 화면 폭 + 가장 넓은 글자 열 이상)
+#define TEXT_FONT_TOP 4              // 5x7 글꼴 첫 행 위치 (대문자 4~10행, 내림 획 11행)
+#define TEXT_GLYPH_SPACING 1         // 글자 사이 빈 열
+#define TEXT_SPACE_WIDTH 3           // 공백 폭
+#define TEXT_SCROLL_SPEED 18         // 스크롤 속도 (픽셀/초, 30fps에서 프레임당 약 0.6픽셀)
+#define TEXT_TOP_COLOR    0xFFD23CUL   // 글자 맨 위 행 색 (255, 210, 60)
+#define TEXT_BOTTOM_COLOR 0xFF3C8CUL   // 글자 맨 아래 행 색 (255, 60, 140)
+
+// ================= 벤치마크 설정 (raster_bench.cpp) =================
+// #define RASTER_BENCH_MODE        // 주석 해제시 시퀀스 대신 도형별 그리기 시간을 시리얼로 출력
+#define RASTER_BENCH_BAUDRATE 115200
+#define RASTER_BENCH_REPEAT 50       // 도형마다 반복 횟수
+
+// ================= 디버깅 설정 =================
+// #define DEBUG_MODE               // 주석 해제시 시리얼 디버그 메시지 출력
+#ifdef DEBUG_MODE
+  #define DEBUG_PRINT(x)    Serial.print(x)
+  #define DEBUG_PRINTLN(x)  Serial.println(x)
+  #define DEBUG_BAUDRATE    115200
+#else
+  #define DEBUG_PRINT(x)
+  #define DEBUG_PRINTLN(x)
+#endif
+
+#endif // CONFIG_H
@@ -0,0 +1,49 @@
+// control.cpp - 기본 LED 제어 함수만 포함
+
+#include "control.h"
+
+//================= NeoPixel 객체 =================
+PowerStrip strip(LED_COUNT, LED_PIN, PIXEL_TYPE);
+
+//================= 초기화 함수 =================
+void initNeoPixel() {
+  strip.begin();                         // NeoPixel 스트립 초기화
+  strip.show();                          // 모든 픽셀 끄기
+  strip.setBrightness(DEFAULT_BRIGHTNESS); // 기본 밝기 설정
+}
+
+//================= 매트릭스 제어 함수 =================
+
+// 2D 좌표를 1D 인덱스로 변환
+// 세로 지그재그: 짝수 열은 위→아래, 홀수 열은 아래→위
+int getPixelIndex(int x, int y) {
+  if(x < 0 || x >= MATRIX_WIDTH || y < 0 || y >= MATRIX_HEIGHT) {
+    return -1; // 범위 벗어남
+  }
+
+  if(x % 2 == 0) {
+    return x * MATRIX_HEIGHT + y;
+  } else {
+    return x * MATRIX_HEIGHT + (MATRIX_HEIGHT - 1 - y);
+  }
+}
+
+// 특정 좌표의 픽셀 색상 설정
+void setPixel(int x, int y, int red, int green, int blue) {
+  int index = getPixelIndex(x, y);
+  if(index >= 0 && index < LED_COUNT) {
+    strip.setPixelColor(index, strip.Color(red, green, blue));
+  }
+}
+
+// 특정 좌표의 현재 색상 (안티에일리어싱 가장자리 섞기용)
+uint32_t getPixel(int x, int y) {
+  int index = getPixelIndex(x, y);
+  if(index < 0) return 0;
+  return strip.getPixelColor(index);
+}
+
+// 매트릭스 전체 지우기
+void clearMatrix() {
+  strip.clear();
+}
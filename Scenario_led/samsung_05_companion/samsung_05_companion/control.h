@@ -0,0 +1,22 @@
+// control.h - 메인 제어 헤더 파일
+
+#ifndef CONTROL_H
+#define CONTROL_H
+
+#include <Adafruit_NeoPixel.h>
+#include "config.h"
+#include "power_strip.h"
+
+// ===== 초기화 함수 =====
+void initNeoPixel();
+
+// ===== 매트릭스 제어 함수 =====
+int getPixelIndex(int x, int y);
+void setPixel(int x, int y, int red, int green, int blue);
+uint32_t getPixel(int x, int y);     // 밝기 역스케일한 색 (범위 밖이면 0)
+void clearMatrix();
+
+// ===== 전역 변수 선언 (extern) =====
+extern PowerStrip strip;
+
+#endif
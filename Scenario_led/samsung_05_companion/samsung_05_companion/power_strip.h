@@ -0,0 +1,70 @@
+// power_strip.h - 전류 추정/제한이 포함된 NeoPixel 스트립
+// setPixelColor()마다 이전 값과의 차이만 더해 프레임 전류를 유지 (버퍼 재검사 없음)
+// show() 직전 예산을 넘으면 출력 배율을 즉시 낮추고, 여유가 생기면 프레임마다 조금씩 회복
+// 제한은 전송할 때만 적용하고 저장된 픽셀은 그대로 둠 (일부만 다시 그리는 프레임도 색이 깎이지 않음)
+
+#ifndef POWER_STRIP_H
+#define POWER_STRIP_H
+
+#include <Adafruit_NeoPixel.h>
+#include "config.h"
+
+// WS2812B 전송 시간 계산값 (픽셀당 24비트 × 1.25us + 래치), 스케치는 wireTimeUs()로만 씀
+#define STRIP_WIRE_US_PER_PIXEL 30
+#define STRIP_LATCH_US          300
+
+class PowerStrip : public Adafruit_NeoPixel {
+ public:
+  PowerStrip(uint16_t n, int16_t pin, neoPixelType type);
+  ~PowerStrip();
+
+  // ===== 픽셀 쓰기 (전류 합계 갱신) =====
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+  void setPixelColor(uint16_t n, uint32_t c);
+  void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0);
+  void clear();
+#ifdef NEO_OVERLAY_COLOR
+  void overlayColor(uint8_t r, uint8_t g, uint8_t b, float alpha);   // 호스트 합성 커널 (라이브러리 확장)
+#endif
+
+  // 전송 버퍼 바이트 하나를 밝기 스케일 없이 씀 (후처리용, offset = 픽셀 * 3 + 채널)
+  void setWireByte(uint16_t offset, uint8_t value);
+
+  // ===== 밝기 / 출력 =====
+  void setBrightness(uint8_t b);   // 기본 밝기 (라이브러리 밝기, 제한 배율은 이 값 위에 곱함)
+  void show();
+
+  // ===== 비동기 출력 =====
+  // beginShow(): 현재 버퍼로 전송을 시작하고 바로 반환 (이전 전송 중이면 끝날 때까지 대기)
+  // 전송이 시작되면 그리기 버퍼는 보낸 프레임 내용을 유지한 채 다음 프레임용으로 쓸 수 있음
+  // 라이브러리에 비동기 전송이 없으면(AVR은 전송 중 인터럽트 금지) 블로킹 show()와 같음
+  void beginShow();
+  bool isBusy() const;
+
+  // ===== 시간 기준 =====
+  // AVR의 블로킹 show()는 인터럽트를 꺼서 micros()가 전송 시간 대부분을 놓침 (512픽셀 15.7ms 중 1ms 남짓)
+  // nowUs() = micros() + 블로킹 전송마다 (계산한 전송 시간 - 전송 중 micros() 증가분)을 모은 값
+  // micros()가 전송 중에도 흐르는 플랫폼/호스트에서는 더하는 값이 0이라 micros()와 같음
+  static unsigned long nowUs();
+  uint32_t wireTimeUs() const;     // 한 프레임 전송 시간 계산값 (전송 중 시간은 잴 수 없어 측정 대신 사용)
+
+  // ===== 상태 =====
+  uint32_t estimatedMilliamps() const;     // 현재 버퍼를 지금 제한 배율로 보낼 때의 추정 전류
+  uint8_t limitedBrightness() const { return (uint8_t)((getBrightness() * outputScale) >> 8); }
+  uint32_t limitedFrames() const { return limitedFrameCount; }
+
+ private:
+  void recountChannels();   // 버퍼 전체를 다시 읽어 합계 계산
+  void limitPower();
+  void transmit(bool async);
+  void blockingShow();
+
+  static unsigned long stalledUs;   // micros()가 놓친 전송 시간 누적
+
+  uint32_t channelSum;         // 저장된 값(기본 밝기 적용 후) R+G+B 합계
+  uint16_t outputScale;        // 전류 제한 출력 배율 (256 = 제한 없음)
+  uint32_t limitedFrameCount;
+  uint8_t* savedPixels;        // 제한된 프레임 전송 중 원래 버퍼 보관 (AVR은 0: SRAM 부족, 역스케일로 복원)
+};
+
+#endif
@@ -0,0 +1,196 @@
+// raster_bench.cpp - 도형별 그리기 비용 측정 구현
+
+#include "raster_bench.h"
+#include "control.h"
+#include "shape_raster.h"
+#include "companion_face.h"
+#include "text_scroller.h"
+
+#define BENCH_WHITE 0xFFFFFFUL
+
+// ================= 측정 항목 =================
+enum RasterBenchCase {
+  BENCH_LINE_SHORT = 0,
+  BENCH_LINE_LONG,
+  BENCH_CIRCLE_SMALL,
+  BENCH_CIRCLE_LARGE,
+  BENCH_ELLIPSE,
+  BENCH_RING,
+  BENCH_ROUND_RECT,
+  BENCH_TRIANGLE,
+  BENCH_HEXAGON,
+  BENCH_CIRCLE_CLIPPED,
+  BENCH_TEXT_SET,
+  BENCH_TEXT_SHORT,
+  BENCH_TEXT_LONG,
+  BENCH_FACE_NEUTRAL,
+  BENCH_FACE_HAPPY,
+  BENCH_FACE_HEART,
+  BENCH_CASE_COUNT
+};
+
+static const char* const benchNames[BENCH_CASE_COUNT] = {
+  "line_5px", "line_diagonal", "circle_r3", "circle_r7", "ellipse_10x5", "ring_10x5",
+  "round_rect_24x10", "triangle", "hexagon", "circle_clipped",
+  "text_set_long", "text_frame_short", "text_frame_long",
+  "face_neutral", "face_happy", "face_heart",
+};
+
+static const int16_t trianglePoints[6] = {
+  RASTER_PX(4), RASTER_PX(14), RASTER_PX(16), RASTER_PX(1.5), RASTER_PX(28), RASTER_PX(14),
+};
+
+static const int16_t hexagonPoints[12] = {
+  RASTER_PX(8), RASTER_PX(8), RASTER_PX(12), RASTER_PX(4), RASTER_PX(20), RASTER_PX(4),
+  RASTER_PX(24), RASTER_PX(8), RASTER_PX(20), RASTER_PX(12), RASTER_PX(12), RASTER_PX(12),
+};
+
+// 글자 스크롤 항목: 프레임 비용은 메시지 길이와 무관해야 함 (메시지 설정은 열 수 세기만)
+static const char shortMessage[] PROGMEM = "Hi";
+static const char longMessage[] PROGMEM =
+  "Nice to meet you! " TEXT_HEART " See you soon " TEXT_SMILE " " TEXT_STAR " " TEXT_NOTE;
+#define TEXT_BENCH_POSITION (int32_t)(-12 * 256 + 100)   // 소수부가 있는 위치 (두 열 섞기)
+
+// 표정 항목의 시퀀스 시각 (깜빡임 구간 밖)
+static unsigned long faceBenchMs(uint8_t index) {
+  if(index == BENCH_FACE_HAPPY) return 6000;
+  if(index == BENCH_FACE_HEART) return 14000;
+  return 3500;
+}
+
+uint8_t rasterBenchCount() {
+  return BENCH_CASE_COUNT;
+}
+
+const char* rasterBenchName(uint8_t index) {
+  return index < BENCH_CASE_COUNT ? benchNames[index] : "";
+}
+
+void rasterBenchPrepare(uint8_t index) {
+  if(index == BENCH_TEXT_SHORT) textSetMessage(shortMessage);
+  else if(index == BENCH_TEXT_LONG) textSetMessage(longMessage);
+  textSetGradient(0xFFFFFFUL, 0xFFFFFFUL);
+}
+
+bool rasterBenchIsFace(uint8_t index) {
+  return index >= BENCH_FACE_NEUTRAL && index < BENCH_CASE_COUNT;
+}
+
+void rasterBenchDraw(uint8_t index) {
+  switch(index) {
+    case BENCH_LINE_SHORT:
+      rasterLine(RASTER_CENTER(4), RASTER_CENTER(3), RASTER_CENTER(9), RASTER_CENTER(5), BENCH_WHITE);
+      break;
+    case BENCH_LINE_LONG:
+      rasterLine(RASTER_CENTER(0), RASTER_CENTER(0), RASTER_CENTER(31), RASTER_CENTER(15), BENCH_WHITE);
+      break;
+    case BENCH_CIRCLE_SMALL:
+      rasterCircle(RASTER_PX(8), RASTER_PX(8), RASTER_PX(3), BENCH_WHITE);
+      break;
+    case BENCH_CIRCLE_LARGE:
+      rasterCircle(RASTER_PX(16), RASTER_PX(8), RASTER_PX(7), BENCH_WHITE);
+      break;
+    case BENCH_ELLIPSE:
+      rasterEllipse(RASTER_PX(16), RASTER_PX(8), RASTER_PX(10), RASTER_PX(5), BENCH_WHITE);
+      break;
+    case BENCH_RING:
+      rasterEllipseRing(RASTER_PX(16), RASTER_PX(8), RASTER_PX(10), RASTER_PX(5), RASTER_PX(1.5), BENCH_WHITE);
+      break;
+    case BENCH_ROUND_RECT:
+      rasterRoundRect(RASTER_PX(4), RASTER_PX(3), RASTER_PX(28), RASTER_PX(13), RASTER_PX(3), BENCH_WHITE);
+      break;
+    case BENCH_TRIANGLE:
+      rasterPolygon(trianglePoints, 3, BENCH_WHITE);
+      break;
+    case BENCH_HEXAGON:
+      rasterPolygon(hexagonPoints, 6, BENCH_WHITE);
+      break;
+    case BENCH_CIRCLE_CLIPPED:
+      rasterCircle(RASTER_PX(1), RASTER_PX(1), RASTER_PX(6), BENCH_WHITE);
+      break;
+    case BENCH_TEXT_SET:
+      textSetMessage(longMessage);
+      break;
+    case BENCH_TEXT_SHORT:
+    case BENCH_TEXT_LONG:
+      textDraw(TEXT_BENCH_POSITION);
+      break;
+    default:
+      if(rasterBenchIsFace(index)) {
+        FaceParams face;
+        faceParamsAt(faceBenchMs(index), &face);
+        drawFace(&face);
+      }
+      break;
+  }
+}
+
+// ================= 검증용 면적 (1/256 픽셀) =================
+static uint32_t polygonArea(const int16_t* points, uint8_t count) {
+  int32_t twice = 0;
+  for(uint8_t i = 0; i < count; i++) {
+    uint8_t j = (i + 1 < count) ? i + 1 : 0;
+    twice += (int32_t)points[i * 2] * points[j * 2 + 1] - (int32_t)points[j * 2] * points[i * 2 + 1];
+  }
+  return (uint32_t)(abs(twice) / 2);
+}
+
+uint32_t rasterBenchArea(uint8_t index) {
+  switch(index) {
+    case BENCH_CIRCLE_SMALL: return (uint32_t)(PI * RASTER_PX(3) * RASTER_PX(3));
+    case BENCH_CIRCLE_LARGE: return (uint32_t)(PI * RASTER_PX(7) * RASTER_PX(7));
+    case BENCH_ELLIPSE:      return (uint32_t)(PI * RASTER_PX(10) * RASTER_PX(5));
+    case BENCH_RING:
+      return (uint32_t)(PI * ((float)RASTER_PX(10) * RASTER_PX(5) - (float)RASTER_PX(8.5) * RASTER_PX(3.5)));
+    case BENCH_ROUND_RECT:
+      return (uint32_t)((float)RASTER_PX(24) * RASTER_PX(10) - (4 - PI) * RASTER_PX(3) * RASTER_PX(3));
+    case BENCH_TRIANGLE:     return polygonArea(trianglePoints, 3);
+    case BENCH_HEXAGON:      return polygonArea(hexagonPoints, 6);
+    default:                 return 0;
+  }
+}
+
+#ifdef RASTER_BENCH_MODE
+// ================= MCU 측정 =================
+// micros() 해상도(16MHz AVR에서 4us) 때문에 여러 번 그린 평균을 씀
+void runRasterBench() {
+  Serial.begin(RASTER_BENCH_BAUDRATE);
+  Serial.println("shape us_per_draw");
+
+  uint32_t worstFaceUs = 0;
+  uint32_t textFrameUs[2] = { 0, 0 };   // 짧은 / 긴 메시지 한 프레임
+  for(uint8_t i = 0; i < BENCH_CASE_COUNT; i++) {
+    clearMatrix();
+    rasterBenchPrepare(i);
+    unsigned long start = micros();
+    for(uint16_t n = 0; n < RASTER_BENCH_REPEAT; n++) {
+      rasterBenchDraw(i);
+    }
+    uint32_t perDraw = (micros() - start) / RASTER_BENCH_REPEAT;
+    if(rasterBenchIsFace(i) && perDraw > worstFaceUs) worstFaceUs = perDraw;
+    if(i == BENCH_TEXT_SHORT) textFrameUs[0] = perDraw;
+    if(i == BENCH_TEXT_LONG) textFrameUs[1] = perDraw;
+
+    Serial.print(rasterBenchName(i));
+    Serial.print(' ');
+    Serial.println(perDraw);
+  }
+
+  Serial.print("text frame ");
+  Serial.print(textFrameUs[0]);
+  Serial.print(" us (short) / ");
+  Serial.print(textFrameUs[1]);
+  Serial.println(" us (long)");
+
+  // AVR의 show()는 블로킹이므로 그리기에 남는 시간 = 예산 - 전송 시간
+  uint32_t drawBudget = FACE_FRAME_BUDGET_US - strip.wireTimeUs();
+  Serial.print("face worst ");
+  Serial.print(worstFaceUs);
+  Serial.print(" us, draw budget ");
+  Serial.print(drawBudget);
+  Serial.println(worstFaceUs <= drawBudget ? " us: ok" : " us: OVER");
+
+  clearMatrix();
+  strip.show();
+}
+#endif
@@ -0,0 +1,25 @@
+// raster_bench.h - 도형별 그리기 비용 측정 (AVR: RASTER_BENCH_MODE, 호스트: host/preview/raster_bench)
+// 같은 도형 목록을 MCU와 호스트에서 그려서 도형 하나 / 글자 스크롤 한 프레임 / 표정 전체 그리기 시간을 비교
+
+#ifndef RASTER_BENCH_H
+#define RASTER_BENCH_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ===== 측정 항목 =====
+uint8_t rasterBenchCount();
+const char* rasterBenchName(uint8_t index);
+void rasterBenchDraw(uint8_t index);        // 항목 하나를 한 번 그림 (표정 항목은 지우기 포함)
+void rasterBenchPrepare(uint8_t index);     // 측정 전 준비 (글자 항목의 메시지 설정)
+bool rasterBenchIsFace(uint8_t index);      // 표정 전체 항목 (프레임 예산과 비교)
+
+// 채우기 도형의 면적 (1/256 픽셀 단위, 검증용, 선/표정은 0)
+uint32_t rasterBenchArea(uint8_t index);
+
+#ifdef RASTER_BENCH_MODE
+// 항목마다 RASTER_BENCH_REPEAT번 그린 평균 시간과 표정의 프레임 예산 여유를 시리얼로 출력
+void runRasterBench();
+#endif
+
+#endif
@@ -0,0 +1,76 @@
+// samsung_05_companion.ino - 메인 프로그램 (컴패니언 표정 시퀀스)
+// 깨어남 → 두리번 → 웃음 → 놀람 → 졸림 → 듣는 중 → 하트 → 인사 메시지 스크롤 → 종료
+// 표정은 매 프레임 키프레임 보간으로 다시 그림 (안티에일리어싱 도형, shape_raster.cpp)
+// 메시지는 보이는 구간만 캐시한 글자 열을 옮겨 그림 (text_scroller.cpp)
+
+#include "control.h"
+#include "companion_face.h"
+#include "text_scroller.h"
+#include "raster_bench.h"
+
+// 표정 시퀀스 뒤에 흘려 보내는 메시지
+const char greetingMessage[] PROGMEM = "Nice to meet you! " TEXT_HEART "  See you soon " TEXT_SMILE;
+
+unsigned long programStartMs = 0;   // 전체 프로그램 시작 시간
+unsigned long lastFrameUs = 0;      // 마지막 프레임 시작 시각
+bool sequenceComplete = false;      // 시퀀스 종료 후 화면을 끈 상태
+
+void setup() {
+  // 기본 초기화
+  initNeoPixel();
+
+#ifdef DEBUG_MODE
+  Serial.begin(DEBUG_BAUDRATE);
+#endif
+
+#ifdef RASTER_BENCH_MODE
+  // 벤치마크 모드: 도형별 그리기 시간만 출력하고 꺼진 상태로 대기
+  runRasterBench();
+  sequenceComplete = true;
+#endif
+
+  // 메시지 설정 (열 캐시는 스크롤하면서 채움)
+  textSetMessage(greetingMessage);
+  textSetGradient(TEXT_TOP_COLOR, TEXT_BOTTOM_COLOR);
+
+  // 프로그램 시작 시간 기록
+  programStartMs = millis();
+  lastFrameUs = micros();
+}
+
+void loop() {
+  if (sequenceComplete) {
+    return;
+  }
+
+  unsigned long programElapsed = millis() - programStartMs;
+  unsigned long faceMs = faceSequenceMs();
+
+  // 표정과 메시지가 끝나면 화면 끄고 종료
+  if (programElapsed >= faceMs + textScrollMs()) {
+    clearMatrix();
+    strip.show();
+    sequenceComplete = true;
+    DEBUG_PRINTLN("sequence complete");
+    return;
+  }
+
+  // 30fps 간격 유지 (그리기 + 전송이 FACE_FRAME_BUDGET_US 안에 끝나야 함)
+  unsigned long nowUs = micros();
+  if (nowUs - lastFrameUs < FACE_FRAME_BUDGET_US) {
+    delay(1);
+    return;
+  }
+  // 다음 프레임은 예정 시각 기준 (대기 오차가 쌓이지 않게), 한 프레임 넘게 밀리면 지금부터 다시
+  lastFrameUs += FACE_FRAME_BUDGET_US;
+  if (nowUs - lastFrameUs >= FACE_FRAME_BUDGET_US) lastFrameUs = nowUs;
+
+  if (programElapsed < faceMs) {
+    FaceParams face;
+    faceParamsAt(programElapsed, &face);
+    drawFace(&face);
+  } else {
+    textDraw(textScrollPosition(programElapsed - faceMs));
+  }
+  strip.beginShow();
+}
@@ -0,0 +1,285 @@
+// shape_raster.cpp - 고정소수점 안티에일리어싱 도형 래스터라이저 구현
+// 나눗셈은 도형마다(다각형 변 기울기, 타원 비율) 또는 부분 스캔라인마다 한 번, 픽셀 루프에는 없음
+
+#include "shape_raster.h"
+#include "control.h"
+
+#if RASTER_ONE % RASTER_SUBROWS != 0
+#error "RASTER_SUBROWS must divide RASTER_ONE"
+#endif
+
+#define SUBROW_STEP (RASTER_ONE / RASTER_SUBROWS)   // 부분 스캔라인 간격 (1/16 픽셀)
+#define SUBROW_FULL (256 / RASTER_SUBROWS)          // 부분 스캔라인 하나가 픽셀 폭 전체를 덮을 때 덮임
+#define RASTER_WIDTH_FIXED ((int16_t)MATRIX_WIDTH * RASTER_ONE)
+#define RASTER_HEIGHT_FIXED ((int16_t)MATRIX_HEIGHT * RASTER_ONE)
+
+// ================= 행 덮임 버퍼 =================
+static uint16_t rowCover[MATRIX_WIDTH];
+static int8_t coverLeft = MATRIX_WIDTH;   // 이번 행에서 덮인 열 범위
+static int8_t coverRight = -1;
+
+// 부분 스캔라인 구간 [left, right) (1/16 픽셀)을 열별 덮임에 더함 (화면 밖은 잘라냄)
+static void coverSpan(int16_t left, int16_t right) {
+  if(left < 0) left = 0;
+  if(right > RASTER_WIDTH_FIXED) right = RASTER_WIDTH_FIXED;
+  if(left >= right) return;
+
+  int8_t first = left >> RASTER_SHIFT;
+  int8_t last = (right - 1) >> RASTER_SHIFT;
+  if(first < coverLeft) coverLeft = first;
+  if(last > coverRight) coverRight = last;
+
+  if(first == last) {
+    rowCover[first] += (uint16_t)(right - left) * SUBROW_FULL >> RASTER_SHIFT;
+    return;
+  }
+  rowCover[first] += (uint16_t)(RASTER_ONE - (left & (RASTER_ONE - 1))) * SUBROW_FULL >> RASTER_SHIFT;
+  for(int8_t x = first + 1; x < last; x++) {
+    rowCover[x] += SUBROW_FULL;
+  }
+  rowCover[last] += (uint16_t)(right - ((int16_t)last << RASTER_SHIFT)) * SUBROW_FULL >> RASTER_SHIFT;
+}
+
+// 누적한 행을 섞어서 쓰고 버퍼 비움
+static void flushRow(int8_t y, uint32_t color) {
+  for(int8_t x = coverLeft; x <= coverRight; x++) {
+    uint16_t coverage = rowCover[x];
+    if(coverage) {
+      rasterBlendPixel(x, y, color, coverage > 256 ? 256 : coverage);
+      rowCover[x] = 0;
+    }
+  }
+  coverLeft = MATRIX_WIDTH;
+  coverRight = -1;
+}
+
+// ================= 채우기 공통 루프 =================
+// 세로 범위 [top, bottom) 안의 행마다 부분 스캔라인 중심 sy에서 spans(sy)가 coverSpan으로 구간을 더함
+typedef void (*SpanFunction)(int16_t sy, const void* shape);
+
+static void fillShape(int16_t top, int16_t bottom, uint32_t color, SpanFunction spans, const void* shape) {
+  if(top < 0) top = 0;
+  if(bottom > RASTER_HEIGHT_FIXED) bottom = RASTER_HEIGHT_FIXED;
+  if(top >= bottom) return;
+
+  int8_t firstRow = top >> RASTER_SHIFT;
+  int8_t lastRow = (bottom - 1) >> RASTER_SHIFT;
+  for(int8_t y = firstRow; y <= lastRow; y++) {
+    int16_t sy = ((int16_t)y << RASTER_SHIFT) + SUBROW_STEP / 2;
+    for(uint8_t k = 0; k < RASTER_SUBROWS; k++, sy += SUBROW_STEP) {
+      spans(sy, shape);
+    }
+    flushRow(y, color);
+  }
+}
+
+// 정수 제곱근 (비트 단위, 곱셈/나눗셈 없음)
+static uint16_t isqrt32(uint32_t value) {
+  uint32_t result = 0;
+  uint32_t bit = 1UL << 30;
+  while(bit > value) bit >>= 2;
+  while(bit) {
+    if(value >= result + bit) {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    } else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint16_t)result;
+}
+
+// ================= 픽셀 섞기 =================
+static uint8_t blendChannel(uint8_t from, uint8_t to, uint16_t coverage) {
+  return (uint8_t)(((uint16_t)from * (256 - coverage) + (uint16_t)to * coverage) >> 8);
+}
+
+void rasterBlendPixel(int x, int y, uint32_t color, uint16_t coverage) {
+  if(coverage == 0 || x < 0 || x >= MATRIX_WIDTH || y < 0 || y >= MATRIX_HEIGHT) return;
+
+  uint8_t r = color >> 16;
+  uint8_t g = color >> 8;
+  uint8_t b = color;
+  if(coverage < 256) {
+    uint32_t old = getPixel(x, y);
+    r = blendChannel(old >> 16, r, coverage);
+    g = blendChannel(old >> 8, g, coverage);
+    b = blendChannel(old, b, coverage);
+  }
+  setPixel(x, y, r, g, b);
+}
+
+// ================= 선 (Wu) =================
+void rasterLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint32_t color) {
+  // 기울기가 1보다 크면 x/y를 바꿔 주축을 따라 한 칸씩 진행
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  int16_t t;
+  if(steep) {
+    t = x0; x0 = y0; y0 = t;
+    t = x1; x1 = y1; y1 = t;
+  }
+  if(x0 > x1) {
+    t = x0; x0 = x1; x1 = t;
+    t = y0; y0 = y1; y1 = t;
+  }
+
+  int16_t dx = x1 - x0;
+  int32_t gradient = dx ? ((int32_t)(y1 - y0) << 8) / dx : 0;   // 주축 1당 부축 변화 (Q8)
+
+  // 양 끝을 반 픽셀씩 늘림 (끝점이 픽셀 중심이면 그 칸을 온전히 칠함)
+  int16_t start = x0 - RASTER_ONE / 2;
+  int16_t end = x1 + RASTER_ONE / 2;
+  int16_t majorCells = steep ? MATRIX_HEIGHT : MATRIX_WIDTH;
+  int16_t first = start >> RASTER_SHIFT;
+  int16_t last = (end - 1) >> RASTER_SHIFT;
+  if(first < 0) first = 0;
+  if(last >= majorCells) last = majorCells - 1;
+
+  for(int16_t i = first; i <= last; i++) {
+    int16_t cellLeft = i << RASTER_SHIFT;
+    int16_t overlap = min((int16_t)(cellLeft + RASTER_ONE), end) - max(cellLeft, start);   // 1 ~ 16
+    int16_t center = cellLeft + RASTER_ONE / 2;
+    int16_t minor = y0 + (int16_t)(((int32_t)(center - x0) * gradient) >> 8) - RASTER_ONE / 2;
+    int16_t cell = minor >> RASTER_SHIFT;
+    uint8_t fraction = minor & (RASTER_ONE - 1);
+
+    uint16_t weight = (uint16_t)overlap << (8 - RASTER_SHIFT);        // 0 ~ 256
+    uint16_t nearCover = (uint16_t)(RASTER_ONE - fraction) * weight >> RASTER_SHIFT;
+    uint16_t farCover = (uint16_t)fraction * weight >> RASTER_SHIFT;
+    if(steep) {
+      rasterBlendPixel(cell, i, color, nearCover);
+      rasterBlendPixel(cell + 1, i, color, farCover);
+    } else {
+      rasterBlendPixel(i, cell, color, nearCover);
+      rasterBlendPixel(i, cell + 1, color, farCover);
+    }
+  }
+}
+
+// ================= 원 / 타원 =================
+struct EllipseShape {
+  int16_t cx, cy;
+  int16_t rx, ry;
+  int16_t innerRx, innerRy;   // 0이면 채움
+};
+
+// 중심에서 세로 dy 떨어진 곳의 반폭 (밖이면 -1)
+static int16_t ellipseHalfWidth(int16_t rx, int16_t ry, int16_t dy) {
+  if(dy < 0) dy = -dy;
+  if(dy >= ry) return -1;
+  uint16_t root = isqrt32((uint32_t)ry * ry - (uint32_t)dy * dy);
+  if(rx == ry) return root;
+  return (int16_t)((uint32_t)rx * root / ry);
+}
+
+static void ellipseSpans(int16_t sy, const void* shape) {
+  const EllipseShape* e = (const EllipseShape*)shape;
+  int16_t dy = sy - e->cy;
+  int16_t half = ellipseHalfWidth(e->rx, e->ry, dy);
+  if(half < 0) return;
+
+  int16_t inner = (e->innerRy > 0 && e->innerRx > 0) ? ellipseHalfWidth(e->innerRx, e->innerRy, dy) : -1;
+  if(inner < 0) {
+    coverSpan(e->cx - half, e->cx + half);
+  } else {
+    coverSpan(e->cx - half, e->cx - inner);
+    coverSpan(e->cx + inner, e->cx + half);
+  }
+}
+
+void rasterEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint32_t color) {
+  if(rx <= 0 || ry <= 0) return;
+  EllipseShape e = { cx, cy, rx, ry, 0, 0 };
+  fillShape(cy - ry, cy + ry, color, ellipseSpans, &e);
+}
+
+void rasterCircle(int16_t cx, int16_t cy, int16_t radius, uint32_t color) {
+  rasterEllipse(cx, cy, radius, radius, color);
+}
+
+void rasterEllipseRing(int16_t cx, int16_t cy, int16_t rx, int16_t ry, int16_t thickness, uint32_t color) {
+  if(rx <= 0 || ry <= 0) return;
+  EllipseShape e = { cx, cy, rx, ry, (int16_t)(rx - thickness), (int16_t)(ry - thickness) };
+  fillShape(cy - ry, cy + ry, color, ellipseSpans, &e);
+}
+
+// ================= 둥근 사각형 =================
+struct RoundRectShape {
+  int16_t x0, y0, x1, y1;
+  int16_t radius;
+};
+
+static void roundRectSpans(int16_t sy, const void* shape) {
+  const RoundRectShape* r = (const RoundRectShape*)shape;
+  if(sy < r->y0 || sy >= r->y1) return;
+
+  // 모서리 구간이면 원호만큼 안쪽으로
+  int16_t dy = 0;
+  if(sy < r->y0 + r->radius) dy = r->y0 + r->radius - sy;
+  else if(sy >= r->y1 - r->radius) dy = sy - (r->y1 - r->radius);
+  int16_t inset = 0;
+  if(dy > 0) {
+    inset = r->radius - isqrt32((uint32_t)r->radius * r->radius - (uint32_t)dy * dy);
+  }
+  coverSpan(r->x0 + inset, r->x1 - inset);
+}
+
+void rasterRoundRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t radius, uint32_t color) {
+  if(x1 <= x0 || y1 <= y0) return;
+  int16_t limit = min((int16_t)(x1 - x0), (int16_t)(y1 - y0)) / 2;
+  if(radius > limit) radius = limit;
+  if(radius < 0) radius = 0;
+  RoundRectShape r = { x0, y0, x1, y1, radius };
+  fillShape(y0, y1, color, roundRectSpans, &r);
+}
+
+// ================= 다각형 =================
+struct PolygonShape {
+  const int16_t* points;
+  uint8_t count;
+  int32_t slope[RASTER_MAX_POLY_POINTS];   // 변마다 세로 1당 가로 변화 (Q8, 도형마다 한 번 계산)
+};
+
+static void polygonSpans(int16_t sy, const void* shape) {
+  const PolygonShape* p = (const PolygonShape*)shape;
+  int16_t crossings[RASTER_MAX_POLY_POINTS];
+  uint8_t n = 0;
+
+  for(uint8_t i = 0; i < p->count; i++) {
+    uint8_t j = (i + 1 < p->count) ? i + 1 : 0;
+    int16_t xa = p->points[i * 2], ya = p->points[i * 2 + 1];
+    int16_t yb = p->points[j * 2 + 1];
+    if((ya <= sy) == (yb <= sy)) continue;   // 이 스캔라인을 지나지 않는 변 (수평 변 포함)
+
+    int16_t x = xa + (int16_t)(((int32_t)(sy - ya) * p->slope[i]) >> 8);
+    // 삽입 정렬 (교차점은 최대 꼭짓점 수)
+    uint8_t k = n++;
+    while(k > 0 && crossings[k - 1] > x) {
+      crossings[k] = crossings[k - 1];
+      k--;
+    }
+    crossings[k] = x;
+  }
+
+  for(uint8_t k = 0; k + 1 < n; k += 2) {
+    coverSpan(crossings[k], crossings[k + 1]);
+  }
+}
+
+void rasterPolygon(const int16_t* points, uint8_t count, uint32_t color) {
+  if(count < 3 || count > RASTER_MAX_POLY_POINTS) return;
+
+  PolygonShape p;
+  p.points = points;
+  p.count = count;
+  int16_t top = points[1], bottom = points[1];
+  for(uint8_t i = 0; i < count; i++) {
+    uint8_t j = (i + 1 < count) ? i + 1 : 0;
+    int16_t dy = points[j * 2 + 1] - points[i * 2 + 1];
+    p.slope[i] = dy ? ((int32_t)(points[j * 2] - points[i * 2]) << 8) / dy : 0;
+    if(points[i * 2 + 1] < top) top = points[i * 2 + 1];
+    if(points[i * 2 + 1] > bottom) bottom = points[i * 2 + 1];
+  }
+  fillShape(top, bottom, color, polygonSpans, &p);
+}
@@ -0,0 +1,40 @@
+// shape_raster.h - 고정소수점 안티에일리어싱 도형 래스터라이저 (32x16 매트릭스)
+// 좌표/길이는 1/16 픽셀 단위 정수 (RASTER_PX(3) = 3픽셀, 픽셀 (x, y)의 중심은 RASTER_CENTER(x))
+// 채우기 도형: 행마다 RASTER_SUBROWS개의 부분 스캔라인에서 구간 [왼쪽, 오른쪽)을 구하고
+//              열별 덮임 버퍼(0~256)에 누적한 뒤 행 단위로 한 번에 섞어서 setPixel로 씀
+//              (완전히 덮인 픽셀은 바로 덮어쓰고, 가장자리만 현재 색을 읽어 섞음)
+// 선: Wu 방식, 주축 한 칸마다 부축 방향 두 픽셀에 거리 비율로 나눠 칠함 (굵기 1픽셀)
+// 모든 도형은 매트릭스 밖을 잘라냄 (밖의 행/열은 계산하지 않음)
+// 색은 밝기 적용 전 값 (strip.Color 형식)
+
+#ifndef SHAPE_RASTER_H
+#define SHAPE_RASTER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ===== 고정소수점 좌표 =====
+#define RASTER_SHIFT 4
+#define RASTER_ONE (1 << RASTER_SHIFT)
+#define RASTER_PX(p) ((int16_t)((p) * RASTER_ONE))                     // 픽셀 → 1/16 픽셀
+#define RASTER_CENTER(p) ((int16_t)((p) * RASTER_ONE + RASTER_ONE / 2)) // 픽셀 중심
+
+// ===== 선 =====
+void rasterLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint32_t color);
+
+// ===== 원 / 타원 (중심, 반지름) =====
+void rasterCircle(int16_t cx, int16_t cy, int16_t radius, uint32_t color);
+void rasterEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint32_t color);
+// 테두리만 (바깥 반지름에서 안쪽으로 thickness 두께)
+void rasterEllipseRing(int16_t cx, int16_t cy, int16_t rx, int16_t ry, int16_t thickness, uint32_t color);
+
+// ===== 둥근 사각형 (왼쪽 위 포함, 오른쪽 아래 제외) =====
+void rasterRoundRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t radius, uint32_t color);
+
+// ===== 다각형 (x, y 쌍 count개, 짝홀 규칙, 최대 RASTER_MAX_POLY_POINTS) =====
+void rasterPolygon(const int16_t* points, uint8_t count, uint32_t color);
+
+// ===== 픽셀 섞기 (coverage 0~256, 256이면 덮어씀) =====
+void rasterBlendPixel(int x, int y, uint32_t color, uint16_t coverage);
+
+#endif
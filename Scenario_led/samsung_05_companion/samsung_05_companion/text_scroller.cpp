@@ -0,0 +1,292 @@
+// text_scroller.cpp - 비트맵 글자/이모지 스크롤 구현
+
+#include "text_scroller.h"
+#include "control.h"
+
+// ================= 글꼴 (5x7 + 내림 획, 열 단위, 비트 0 = 맨 위) =================
+#define FONT_FIRST ' '
+#define FONT_LAST  '~'
+#define FONT_WIDTH 5
+
+static const uint8_t font5x7[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  0x00, 0x00, 0x5F, 0x00, 0x00,  // !
+  0x00, 0x07, 0x00, 0x07, 0x00,  // "
+  0x14, 0x7F, 0x14, 0x7F, 0x14,  // #
+  0x24, 0x2A, 0x7F, 0x2A, 0x12,  // $
+  0x23, 0x13, 0x08, 0x64, 0x62,  // %
+  0x36, 0x49, 0x56, 0x20, 0x50,  // &
+  0x00, 0x08, 0x07, 0x03, 0x00,  // '
+  0x00, 0x1C, 0x22, 0x41, 0x00,  // (
+  0x00, 0x41, 0x22, 0x1C, 0x00,  // )
+  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  // *
+  0x08, 0x08, 0x3E, 0x08, 0x08,  // +
+  0x00, 0x80, 0x70, 0x30, 0x00,  // ,
+  0x08, 0x08, 0x08, 0x08, 0x08,  // -
+  0x00, 0x00, 0x60, 0x60, 0x00,  // .
+  0x20, 0x10, 0x08, 0x04, 0x02,  // /
+  0x3E, 0x51, 0x49, 0x45, 0x3E,  // 0
+  0x00, 0x42, 0x7F, 0x40, 0x00,  // 1
+  0x72, 0x49, 0x49, 0x49, 0x46,  // 2
+  0x21, 0x41, 0x49, 0x4D, 0x33,  // 3
+  0x18, 0x14, 0x12, 0x7F, 0x10,  // 4
+  0x27, 0x45, 0x45, 0x45, 0x39,  // 5
+  0x3C, 0x4A, 0x49, 0x49, 0x31,  // 6
+  0x41, 0x21, 0x11, 0x09, 0x07,  // 7
+  0x36, 0x49, 0x49, 0x49, 0x36,  // 8
+  0x46, 0x49, 0x49, 0x29, 0x1E,  // 9
+  0x00, 0x00, 0x14, 0x00, 0x00,  // :
+  0x00, 0x40, 0x34, 0x00, 0x00,  // ;
+  0x00, 0x08, 0x14, 0x22, 0x41,  // <
+  0x14, 0x14, 0x14, 0x14, 0x14,  // =
+  0x00, 0x41, 0x22, 0x14, 0x08,  // >
+  0x02, 0x01, 0x59, 0x09, 0x06,  // ?
+  0x3E, 0x41, 0x5D, 0x59, 0x4E,  // @
+  0x7C, 0x12, 0x11, 0x12, 0x7C,  // A
+  0x7F, 0x49, 0x49, 0x49, 0x36,  // B
+  0x3E, 0x41, 0x41, 0x41, 0x22,  // C
+  0x7F, 0x41, 0x41, 0x41, 0x3E,  // D
+  0x7F, 0x49, 0x49, 0x49, 0x41,  // E
+  0x7F, 0x09, 0x09, 0x09, 0x01,  // F
+  0x3E, 0x41, 0x41, 0x51, 0x73,  // G
+  0x7F, 0x08, 0x08, 0x08, 0x7F,  // H
+  0x00, 0x41, 0x7F, 0x41, 0x00,  // I
+  0x20, 0x40, 0x41, 0x3F, 0x01,  // J
+  0x7F, 0x08, 0x14, 0x22, 0x41,  // K
+  0x7F, 0x40, 0x40, 0x40, 0x40,  // L
+  0x7F, 0x02, 0x1C, 0x02, 0x7F,  // M
+  0x7F, 0x04, 0x08, 0x10, 0x7F,  // N
+  0x3E, 0x41, 0x41, 0x41, 0x3E,  // O
+  0x7F, 0x09, 0x09, 0x09, 0x06,  // P
+  0x3E, 0x41, 0x51, 0x21, 0x5E,  // Q
+  0x7F, 0x09, 0x19, 0x29, 0x46,  // R
+  0x26, 0x49, 0x49, 0x49, 0x32,  // S
+  0x03, 0x01, 0x7F, 0x01, 0x03,  // T
+  0x3F, 0x40, 0x40, 0x40, 0x3F,  // U
+  0x1F, 0x20, 0x40, 0x20, 0x1F,  // V
+  0x3F, 0x40, 0x38, 0x40, 0x3F,  // W
+  0x63, 0x14, 0x08, 0x14, 0x63,  // X
+  0x03, 0x04, 0x78, 0x04, 0x03,  // Y
+  0x61, 0x59, 0x49, 0x4D, 0x43,  // Z
+  0x00, 0x7F, 0x41, 0x41, 0x41,  // [
+  0x02, 0x04, 0x08, 0x10, 0x20,  // '\'
+  0x00, 0x41, 0x41, 0x41, 0x7F,  // ]
+  0x04, 0x02, 0x01, 0x02, 0x04,  // ^
+  0x40, 0x40, 0x40, 0x40, 0x40,  // _
+  0x00, 0x03, 0x07, 0x08, 0x00,  // `
+  0x20, 0x54, 0x54, 0x78, 0x40,  // a
+  0x7F, 0x28, 0x44, 0x44, 0x38,  // b
+  0x38, 0x44, 0x44, 0x44, 0x28,  // c
+  0x38, 0x44, 0x44, 0x28, 0x7F,  // d
+  0x38, 0x54, 0x54, 0x54, 0x18,  // e
+  0x00, 0x08, 0x7E, 0x09, 0x02,  // f
+  0x18, 0xA4, 0xA4, 0x9C, 0x78,  // g
+  0x7F, 0x08, 0x04, 0x04, 0x78,  // h
+  0x00, 0x44, 0x7D, 0x40, 0x00,  // i
+  0x20, 0x40, 0x40, 0x3D, 0x00,  // j
+  0x7F, 0x10, 0x28, 0x44, 0x00,  // k
+  0x00, 0x41, 0x7F, 0x40, 0x00,  // l
+  0x7C, 0x04, 0x78, 0x04, 0x78,  // m
+  0x7C, 0x08, 0x04, 0x04, 0x78,  // n
+  0x38, 0x44, 0x44, 0x44, 0x38,  // o
+  0xFC, 0x18, 0x24, 0x24, 0x18,  // p
+  0x18, 0x24, 0x24, 0x18, 0xFC,  // q
+  0x7C, 0x08, 0x04, 0x04, 0x08,  // r
+  0x48, 0x54, 0x54, 0x54, 0x24,  // s
+  0x04, 0x04, 0x3F, 0x44, 0x24,  // t
+  0x3C, 0x40, 0x40, 0x20, 0x7C,  // u
+  0x1C, 0x20, 0x40, 0x20, 0x1C,  // v
+  0x3C, 0x40, 0x30, 0x40, 0x3C,  // w
+  0x44, 0x28, 0x10, 0x28, 0x44,  // x
+  0x4C, 0x90, 0x90, 0x90, 0x7C,  // y
+  0x44, 0x64, 0x54, 0x4C, 0x44,  // z
+  0x00, 0x08, 0x36, 0x41, 0x00,  // {
+  0x00, 0x00, 0x77, 0x00, 0x00,  // |
+  0x00, 0x41, 0x36, 0x08, 0x00,  // }
+  0x02, 0x01, 0x02, 0x04, 0x02,  // ~
+};
+
+// ================= 이모지 (열 단위, 비트 = 화면 행, 2~12행) =================
+#define EMOJI_FIRST 0x80
+
+static const uint16_t emojiColumns[] PROGMEM = {
+  // 하트 (11열)
+  0x0078, 0x00FC, 0x01FC, 0x03FC, 0x07F8, 0x0FF0, 0x07F8, 0x03FC, 0x01FC, 0x00FC, 0x0078,
+  // 웃는 얼굴 (11열)
+  0x03E0, 0x0410, 0x0908, 0x1224, 0x1404, 0x1404, 0x1404, 0x1224, 0x0908, 0x0410, 0x03E0,
+  // 별 (11열)
+  0x0020, 0x1060, 0x0CE0, 0x07E0, 0x03F0, 0x01FC, 0x03F0, 0x07E0, 0x0CE0, 0x1060, 0x0020,
+  // 음표 (9열)
+  0x0C00, 0x1E00, 0x1E00, 0x0FFC, 0x000C, 0x0C0C, 0x1E0C, 0x1E0C, 0x0FFC,
+};
+
+struct EmojiGlyph {
+  uint8_t offset;   // emojiColumns 시작 열
+  uint8_t width;
+};
+
+static const EmojiGlyph emojiGlyphs[] PROGMEM = {
+  {  0, 11 },   // TEXT_HEART
+  { 11, 11 },   // TEXT_SMILE
+  { 22, 11 },   // TEXT_STAR
+  { 33,  9 },   // TEXT_NOTE
+};
+#define EMOJI_COUNT (uint8_t)(sizeof(emojiGlyphs) / sizeof(emojiGlyphs[0]))
+
+// ================= 메시지 캐시 =================
+// 캐시는 메시지 [cacheStart, cacheStart + cacheCount) 열, 글자 단위로 뒤에 붙이고 앞은 버림
+#define TEXT_MAX_GLYPH_COLUMNS (11 + TEXT_GLYPH_SPACING)   // 가장 넓은 글자 (이모지 11열 + 간격)
+
+#if TEXT_CACHE_COLUMNS < MATRIX_WIDTH + TEXT_MAX_GLYPH_COLUMNS
+#error "TEXT_CACHE_COLUMNS must hold the visible columns plus one glyph"
+#endif
+
+static const char* message = 0;     // PROGMEM 문자열
+static const char* nextChar = 0;    // 다음에 캐시할 글자
+static uint16_t messageColumns[TEXT_CACHE_COLUMNS];   // 열 마스크 (비트 y = 화면 y행)
+static uint16_t cacheStart = 0;
+static uint8_t cacheCount = 0;
+static uint16_t messageLength = 0;
+static uint32_t rowColors[MATRIX_HEIGHT];
+
+// 글자 하나의 열 (글꼴 글자는 양쪽 빈 열을 잘라 비례 폭으로, 뒤에 간격 열), out이 0이면 폭만 셈
+static uint8_t glyphColumns(uint8_t c, uint16_t* out) {
+  uint8_t count = 0;
+  if(c == ' ') {
+    for(uint8_t i = 0; i < TEXT_SPACE_WIDTH; i++) {
+      if(out) out[count] = 0;
+      count++;
+    }
+    return count;
+  }
+
+  if(c >= EMOJI_FIRST && c < EMOJI_FIRST + EMOJI_COUNT) {
+    uint8_t offset = pgm_read_byte(&emojiGlyphs[c - EMOJI_FIRST].offset);
+    uint8_t width = pgm_read_byte(&emojiGlyphs[c - EMOJI_FIRST].width);
+    for(uint8_t i = 0; i < width; i++) {
+      if(out) out[count] = pgm_read_word(&emojiColumns[offset + i]);
+      count++;
+    }
+  } else {
+    if(c < FONT_FIRST || c > FONT_LAST) c = '?';
+    const uint8_t* glyph = font5x7 + (uint16_t)(c - FONT_FIRST) * FONT_WIDTH;
+    uint8_t first = 0;
+    uint8_t last = FONT_WIDTH - 1;
+    while(first < last && !pgm_read_byte(glyph + first)) first++;
+    while(last > first && !pgm_read_byte(glyph + last)) last--;
+    for(uint8_t i = first; i <= last; i++) {
+      if(out) out[count] = (uint16_t)pgm_read_byte(glyph + i) << TEXT_FONT_TOP;
+      count++;
+    }
+  }
+
+  for(uint8_t i = 0; i < TEXT_GLYPH_SPACING; i++) {
+    if(out) out[count] = 0;
+    count++;
+  }
+  return count;
+}
+
+static void rewindCache() {
+  nextChar = message;
+  cacheStart = 0;
+  cacheCount = 0;
+}
+
+// 메시지 [first, first + count) 열이 캐시에 있게 함 (뒤로 가면 처음부터 다시)
+static void fillCache(int16_t first, uint8_t count) {
+  if(first < 0) first = 0;
+  if((uint16_t)first < cacheStart) rewindCache();
+  while(true) {
+    // 화면 왼쪽 밖으로 나간 열 버림
+    uint16_t drop = (uint16_t)first - cacheStart;
+    if(drop >= cacheCount) {
+      cacheStart += cacheCount;
+      cacheCount = 0;
+    } else if(drop > 0) {
+      memmove(messageColumns, messageColumns + drop, (cacheCount - drop) * sizeof(uint16_t));
+      cacheStart += drop;
+      cacheCount -= drop;
+    }
+    if(cacheStart + cacheCount >= (uint16_t)first + count) return;
+
+    uint8_t c = message ? pgm_read_byte(nextChar) : 0;
+    if(c == 0) return;
+    nextChar++;
+    cacheCount += glyphColumns(c, messageColumns + cacheCount);
+  }
+}
+
+void textSetMessage(const char* messageP) {
+  message = messageP;
+  messageLength = 0;
+  for(const char* p = messageP; ; p++) {
+    uint8_t c = pgm_read_byte(p);
+    if(c == 0) break;
+    messageLength += glyphColumns(c, 0);
+  }
+  rewindCache();
+}
+
+uint16_t textColumnCount() {
+  return messageLength;
+}
+
+// ================= 색상 =================
+// level 0~256 (256 = 원래 색)
+static uint32_t levelColor(uint32_t color, uint16_t level) {
+  uint8_t r = (uint8_t)(((uint16_t)(uint8_t)(color >> 16) * level) >> 8);
+  uint8_t g = (uint8_t)(((uint16_t)(uint8_t)(color >> 8) * level) >> 8);
+  uint8_t b = (uint8_t)(((uint16_t)(uint8_t)color * level) >> 8);
+  return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+void textSetGradient(uint32_t topColor, uint32_t bottomColor) {
+  for(uint8_t y = 0; y < MATRIX_HEIGHT; y++) {
+    uint16_t t = (uint16_t)y * 256 / (MATRIX_HEIGHT - 1);
+    rowColors[y] = levelColor(topColor, 256 - t) + levelColor(bottomColor, t);
+  }
+}
+
+// ================= 그리기 =================
+static uint16_t columnAt(int16_t index) {
+  if(index < (int16_t)cacheStart || index >= (int16_t)(cacheStart + cacheCount)) return 0;
+  return messageColumns[index - cacheStart];
+}
+
+// 화면 x열 = 메시지 (first + x)열 × (256 - fraction) + (first + x + 1)열 × fraction
+// 각 픽셀은 두 열의 비트 조합 4가지 중 하나이므로 행마다 부분 밝기 색을 한 번만 계산 (행 단위로 그림)
+void textDraw(int32_t position) {
+  int16_t first = (int16_t)(position >> 8);
+  uint8_t fraction = (uint8_t)(position & 0xFF);
+  fillCache(first, MATRIX_WIDTH + 1);
+
+  for(uint8_t y = 0; y < MATRIX_HEIGHT; y++) {
+    uint32_t full = rowColors[y];
+    uint32_t leftOnly = levelColor(full, 256 - fraction);   // 왼쪽 열만 켜진 픽셀
+    uint32_t rightOnly = levelColor(full, fraction);        // 오른쪽 열만 켜진 픽셀
+    uint16_t bit = (uint16_t)1 << y;
+
+    bool right = columnAt(first) & bit;
+    for(uint8_t x = 0; x < MATRIX_WIDTH; x++) {
+      bool left = right;
+      right = columnAt(first + x + 1) & bit;
+
+      // getPixelIndex와 같은 세로 지그재그
+      uint16_t index = (uint16_t)x * MATRIX_HEIGHT + ((x & 1) ? MATRIX_HEIGHT - 1 - y : y);
+      uint32_t color;
+      if(left) color = right ? full : leftOnly;
+      else color = right ? rightOnly : 0;
+      strip.setPixelColor(index, color);
+    }
+  }
+}
+
+// ================= 스크롤 =================
+int32_t textScrollPosition(unsigned long elapsedMs) {
+  return (int32_t)((uint32_t)elapsedMs * TEXT_SCROLL_SPEED * 256 / 1000) - (int32_t)MATRIX_WIDTH * 256;
+}
+
+unsigned long textScrollMs() {
+  return (unsigned long)(messageLength + MATRIX_WIDTH) * 1000 / TEXT_SCROLL_SPEED;
+}
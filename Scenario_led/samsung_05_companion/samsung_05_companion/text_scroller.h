@@ -0,0 +1,37 @@
+// text_scroller.h - 비트맵 글자/이모지 스크롤 헤더
+// 글자마다 열 마스크(비트 = 화면 행)를 만들어 화면에 보이는 구간만 캐시하고 (TEXT_CACHE_COLUMNS)
+// 스크롤하면서 오른쪽에 새로 들어오는 글자만 추가 (글꼴 조회는 글자당 한 번, 비용은 메시지 길이와 무관)
+// 스크롤 위치는 1/256 열 단위, 소수부는 이웃한 두 열을 섞어 부드럽게 이동
+
+#ifndef TEXT_SCROLLER_H
+#define TEXT_SCROLLER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ===== 이모지 (메시지 안에 문자열 이어 붙이기로 사용: "HI " TEXT_HEART) =====
+#define TEXT_HEART  "\x80"
+#define TEXT_SMILE  "\x81"
+#define TEXT_STAR   "\x82"
+#define TEXT_NOTE   "\x83"
+
+// ===== 메시지 =====
+// PROGMEM 문자열 설정 (비례 폭, 글자 사이 TEXT_GLYPH_SPACING 열), 전체 열 수만 세고 캐시는 비움
+// 문자열은 스크롤이 끝날 때까지 유지되어야 함 (그리면서 읽음)
+void textSetMessage(const char* messageP);
+uint16_t textColumnCount();
+
+// 행별 세로 그라데이션 (맨 위 행 → 맨 아래 행)
+void textSetGradient(uint32_t topColor, uint32_t bottomColor);
+
+// ===== 그리기 =====
+// position: 화면 왼쪽 끝에 오는 메시지 열 (1/256 열, 음수면 메시지가 오른쪽에서 들어오는 중)
+// 화면 전체를 덮어씀 (지우기 불필요), 전송은 호출한 쪽에서
+void textDraw(int32_t position);
+
+// ===== 스크롤 =====
+// 시작 기준 ms의 위치 (TEXT_SCROLL_SPEED 픽셀/초, 오른쪽 밖에서 들어와 왼쪽 밖으로 나감)
+int32_t textScrollPosition(unsigned long elapsedMs);
+unsigned long textScrollMs();     // 메시지가 완전히 지나가는 시간
+
+#endif
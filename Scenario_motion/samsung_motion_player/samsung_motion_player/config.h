@@ -0,0 +1,65 @@
+// config.h - 다이나믹셀 모션 플레이어 설정 파일
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+// ================= 하드웨어 설정 =================
+// 다이나믹셀 버스 (TTL 반이중, 방향 제어 핀 사용)
+#define DXL_SERIAL      Serial1       // 다이나믹셀 전용 하드웨어 시리얼
+#define DXL_DIR_PIN     2             // 송수신 방향 제어 핀 (HIGH = 송신)
+#define DXL_BAUDRATE    1000000       // 1Mbps (파이썬 컨트롤러와 동일)
+
+// ================= 모터 설정 =================
+#ifndef DXL_MAX_MOTORS
+#define DXL_MAX_MOTORS      8         // 한 트랙이 제어할 수 있는 최대 모터 수
+#endif
+#define DXL_PROFILE_VELOCITY 1023     // 기본 프로파일 속도 (최고 속도)
+#define DXL_OPERATING_MODE  4         // 확장 위치 제어 모드
+#define DXL_POSITION_LIMIT  256000    // 확장 위치 모드 범위 제한 (±)
+
+// ================= 제어 주기 설정 =================
+// 0 = 작성된 프레임(24fps) 그대로 전송, 100/200 등 = 재생 중 보간해서 전송
+#define MOTION_CONTROL_RATE_HZ  100
+#define MOTION_RESAMPLE_MODE    RESAMPLE_MONOTONE   // LINEAR / HERMITE / MONOTONE
+
+// ================= 트랙 형식 설정 =================
+// #define MOTION_USE_KEYFRAMES     // 주석 해제시 motion_keyframes_track.h(감축 트랙) 재생
+
+// ================= 컨트롤 테이블 주소 (XH540, 프로토콜 2.0) =================
+#define ADDR_OPERATING_MODE    11
+#define ADDR_TORQUE_ENABLE     64
+#define ADDR_PROFILE_ACCELERATION 108
+#define ADDR_PROFILE_VELOCITY  112
+#define ADDR_GOAL_POSITION     116
+#define ADDR_PRESENT_POSITION  132
+#define LEN_GOAL_POSITION      4
+#define LEN_PROFILE_GOAL       12     // 프로파일 가속도 + 프로파일 속도 + 목표 위치 (108~119 연속)
+#define LEN_PRESENT_POSITION   4
+
+// ================= 위치 읽기 설정 (dxl_pipeline.cpp) =================
+// 0 = 싱크 라이트만 전송, k > 0 = k번째 싱크 라이트마다 바로 뒤에 현재 위치 읽기 요청
+// 응답은 loop()에서 dxlPipelinePoll()로 받으며, 받는 동안 들어온 쓰기는 버스가 비면 보냄
+#define DXL_READ_EVERY         0
+#define DXL_FAST_SYNC_READ     1      // 1: Fast Sync Read (응답 패킷 1개), 0: Sync Read (서보마다 응답)
+#define DXL_RETURN_DELAY_US    500    // 서보 응답 지연 (Return Delay Time 기본값 250 × 2us)
+#define DXL_STATUS_MARGIN_US   300    // 예상 응답 끝 이후 더 기다리는 시간 (넘으면 시간 초과)
+
+// ================= 패킷 버퍼 설정 =================
+// 헤더(7) + 명령(1) + 주소/길이(4) + 모터당 (ID 1 + 데이터 최대 12) + CRC(2)
+// 데이터 12바이트는 프로파일이 있는 트랙 (가속도/속도/목표를 한 패킷으로), 바이트 스터핑 여유분 포함
+#define DXL_TX_BUFFER_SIZE  (14 + DXL_MAX_MOTORS * (1 + LEN_PROFILE_GOAL) + 16)
+// 응답: 헤더(7) + 명령(1) + 모터당 (오류 1 + ID 1 + 데이터 4 + CRC 2) + 스터핑 여유분
+#define DXL_RX_BUFFER_SIZE  (8 + DXL_MAX_MOTORS * 8 + 16)
+
+// ================= 디버깅 설정 =================
+// #define DEBUG_MODE               // 주석 해제시 프레임별 통계 출력
+#ifdef DEBUG_MODE
+  #define DEBUG_PRINT(x)    Serial.print(x)
+  #define DEBUG_PRINTLN(x)  Serial.println(x)
+  #define DEBUG_BAUDRATE    115200
+#else
+  #define DEBUG_PRINT(x)
+  #define DEBUG_PRINTLN(x)
+#endif
+
+#endif // CONFIG_H
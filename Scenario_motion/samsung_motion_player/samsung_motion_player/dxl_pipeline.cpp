@@ -0,0 +1,279 @@
+// dxl_pipeline.cpp - 싱크 라이트 / 위치 읽기 파이프라인 구현
+// 읽기 응답 형식 (상태 패킷, 명령 0x55)
+//   Sync Read:      서보마다 패킷 1개 [오류][데이터 4] (ID 순서, 서보마다 응답 지연)
+//   Fast Sync Read: 브로드캐스트 ID 패킷 1개, 서보마다 [오류][ID][데이터 4][CRC 2]를 이어 붙임
+//                   (마지막 서보의 CRC가 패킷 CRC, 중간 CRC는 건너뜀)
+
+#include "dxl_pipeline.h"
+
+// ================= 버스 상태 =================
+static uint8_t readIds[DXL_MAX_MOTORS];
+static uint8_t readCount = 0;
+static DxlTxHandler wireHandler = 0;
+static DxlRxHandler rxHandler = 0;
+static uint8_t readInterval = 0;       // k번째 쓰기마다 읽기 (0 = 읽지 않음)
+static bool useFastRead = true;
+static uint8_t writesSinceRead = 0;
+
+static bool readPending = false;
+static uint8_t responsesLeft = 0;      // 아직 받지 못한 응답 패킷 수
+static unsigned long readStartUs = 0;
+static unsigned long readDeadlineUs = 0;
+static unsigned long busFreeUs = 0;    // 단일 명령 상태 응답이 끝나는 시각
+
+// 응답 중에 들어온 쓰기 (최신 프레임 하나만 보관)
+static uint8_t pendingTx[DXL_TX_BUFFER_SIZE];
+static uint16_t pendingLength = 0;
+static unsigned long pendingSinceUs = 0;
+
+// 읽은 위치
+static int32_t positions[DXL_MAX_MOTORS];
+static uint32_t positionMask = 0;      // 이번 읽기에서 받은 서보
+static uint32_t validMask = 0;         // 한 번이라도 받은 서보
+static unsigned long positionUs[DXL_MAX_MOTORS];
+
+// 수신 패킷 버퍼
+static uint8_t rxBuffer[DXL_RX_BUFFER_SIZE];
+static uint16_t rxLength = 0;
+static uint16_t rxTotal = 0;           // 헤더 포함 전체 길이 (길이 필드를 받은 뒤)
+
+static DxlPipelineStats pipelineStats;
+
+static void handlePacket();
+
+//================= 초기화 함수 =================
+void dxlPipelineBegin(const uint8_t* ids, uint8_t count, DxlTxHandler wire, DxlRxHandler rx,
+                      uint8_t readEvery, bool fastRead) {
+  readCount = (count < DXL_MAX_MOTORS) ? count : DXL_MAX_MOTORS;
+  memcpy(readIds, ids, readCount);
+  wireHandler = wire;
+  rxHandler = rx;
+  readInterval = readEvery;
+  useFastRead = fastRead;
+  writesSinceRead = 0;
+  readPending = false;
+  responsesLeft = 0;
+  busFreeUs = micros();
+  pendingLength = 0;
+  positionMask = 0;
+  validMask = 0;
+  rxLength = 0;
+  rxTotal = 0;
+  memset(&pipelineStats, 0, sizeof(pipelineStats));
+}
+
+//================= 응답 시간 =================
+// Sync Read: 서보마다 (응답 지연 + 상태 패킷 15바이트)
+// Fast Sync Read: 응답 지연 한 번 + 헤더(8) + 서보마다 8바이트
+uint32_t dxlPipelineResponseUs(uint8_t count, bool fastRead) {
+  if(fastRead) {
+    return DXL_RETURN_DELAY_US + dxlWireTimeUs(8 + (uint16_t)count * (4 + LEN_PRESENT_POSITION));
+  }
+  return (uint32_t)count * (DXL_RETURN_DELAY_US + dxlWireTimeUs(11 + LEN_PRESENT_POSITION));
+}
+
+//================= 송신 =================
+static bool busBusy() {
+  return readPending || (long)(micros() - busFreeUs) < 0;
+}
+
+// 읽기 요청 (주소/길이/ID 목록에는 스터핑이 생길 수 없음)
+static void sendReadRequest() {
+  uint8_t packet[14 + DXL_MAX_MOTORS];
+  uint16_t n = 0;
+  uint16_t length = 3 + 4 + readCount;
+
+  packet[n++] = 0xFF;
+  packet[n++] = 0xFF;
+  packet[n++] = 0xFD;
+  packet[n++] = 0x00;
+  packet[n++] = DXL_BROADCAST_ID;
+  packet[n++] = length & 0xFF;
+  packet[n++] = length >> 8;
+  packet[n++] = useFastRead ? DXL_INST_FAST_SYNC_READ : DXL_INST_SYNC_READ;
+  packet[n++] = ADDR_PRESENT_POSITION & 0xFF;
+  packet[n++] = ADDR_PRESENT_POSITION >> 8;
+  packet[n++] = LEN_PRESENT_POSITION;
+  packet[n++] = 0;
+  for(uint8_t i = 0; i < readCount; i++) {
+    packet[n++] = readIds[i];
+  }
+  uint16_t crc = dxlUpdateCRC(0, packet, n);
+  packet[n++] = crc & 0xFF;
+  packet[n++] = crc >> 8;
+
+  wireHandler(packet, n);
+  readPending = true;
+  responsesLeft = useFastRead ? 1 : readCount;
+  positionMask = 0;
+  readStartUs = micros();
+  readDeadlineUs = readStartUs + dxlPipelineResponseUs(readCount, useFastRead) + DXL_STATUS_MARGIN_US;
+  rxLength = 0;
+  rxTotal = 0;
+  pipelineStats.reads++;
+}
+
+// 버스로 바로 전송 (싱크 라이트면 읽기 주기 확인, 단일 명령이면 상태 응답 시간만큼 비워 둠)
+static void sendNow(const uint8_t* data, uint16_t length) {
+  wireHandler(data, length);
+
+  if(length > 7 && data[7] == DXL_INST_SYNC_WRITE) {
+    pipelineStats.writes++;
+    if(readInterval > 0 && readCount > 0 && ++writesSinceRead >= readInterval) {
+      writesSinceRead = 0;
+      sendReadRequest();
+    }
+  } else if(length > 4 && data[4] != DXL_BROADCAST_ID) {
+    busFreeUs = micros() + DXL_RETURN_DELAY_US + dxlWireTimeUs(11) + DXL_STATUS_MARGIN_US;
+  }
+}
+
+void dxlPipelineWrite(const uint8_t* data, uint16_t length) {
+  if(wireHandler == 0 || length > DXL_TX_BUFFER_SIZE) return;
+
+  if(!busBusy() && pendingLength == 0) {
+    sendNow(data, length);
+    return;
+  }
+
+  if(pendingLength > 0) {
+    pipelineStats.replacedWrites++;
+  } else {
+    pendingSinceUs = micros();
+  }
+  memcpy(pendingTx, data, length);
+  pendingLength = length;
+}
+
+//================= 수신 =================
+static void resetReceiver() {
+  rxLength = 0;
+  rxTotal = 0;
+}
+
+// 헤더(FF FF FD 00)를 찾은 뒤 길이 필드만큼 모아서 처리
+static void receiveByte(uint8_t c) {
+  static const uint8_t header[4] = { 0xFF, 0xFF, 0xFD, 0x00 };
+
+  if(rxLength < 4) {
+    if(c == header[rxLength]) {
+      rxBuffer[rxLength++] = c;
+    } else if(c == 0xFF) {
+      rxLength = (rxLength == 2) ? 2 : 1;    // FF FF FF ... 는 헤더 앞부분 유지
+    } else {
+      rxLength = 0;
+    }
+    return;
+  }
+
+  rxBuffer[rxLength++] = c;
+  if(rxLength == 7) {
+    uint16_t length = rxBuffer[5] | (rxBuffer[6] << 8);
+    rxTotal = 7 + length;
+    if(length < 3 || rxTotal > DXL_RX_BUFFER_SIZE) resetReceiver();
+  } else if(rxLength > 7 && rxLength == rxTotal) {
+    handlePacket();
+    resetReceiver();
+  }
+}
+
+static void storePosition(uint8_t id, uint8_t error, const uint8_t* data) {
+  if(error & 0x7F) return;    // 비트 7(하드웨어 경고)만 있으면 데이터는 유효
+  for(uint8_t i = 0; i < readCount; i++) {
+    if(readIds[i] != id) continue;
+    positions[i] = (int32_t)((uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+                             ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24));
+    positionUs[i] = micros();
+    positionMask |= 1UL << i;
+    validMask |= 1UL << i;
+    return;
+  }
+}
+
+static void finishRead() {
+  readPending = false;
+  uint32_t readUs = micros() - readStartUs;
+  pipelineStats.lastReadUs = readUs;
+  if(readUs > pipelineStats.maxReadUs) pipelineStats.maxReadUs = readUs;
+  if(positionMask == (readCount >= 32 ? 0xFFFFFFFFUL : (1UL << readCount) - 1)) {
+    pipelineStats.readsComplete++;
+  } else {
+    pipelineStats.readTimeouts++;
+  }
+}
+
+// 완성된 패킷: CRC 확인, 파라미터 스터핑 제거 후 위치 저장
+static void handlePacket() {
+  uint16_t crc = rxBuffer[rxTotal - 2] | (rxBuffer[rxTotal - 1] << 8);
+  if(dxlUpdateCRC(0, rxBuffer, rxTotal - 2) != crc) {
+    pipelineStats.crcErrors++;
+    return;
+  }
+  if(rxBuffer[7] != DXL_INST_STATUS || !readPending) return;
+
+  // 파라미터 (rxBuffer[8] ~ CRC 앞) 제자리 스터핑 제거: FF FF FD 뒤의 FD 삭제
+  uint8_t* params = rxBuffer + 8;
+  uint16_t rawLength = rxTotal - 10;
+  uint16_t count = 0;
+  for(uint16_t i = 0; i < rawLength; i++) {
+    params[count++] = params[i];
+    if(count >= 3 && params[count - 3] == 0xFF && params[count - 2] == 0xFF && params[count - 1] == 0xFD &&
+       i + 1 < rawLength && params[i + 1] == 0xFD) {
+      i++;
+    }
+  }
+
+  uint8_t id = rxBuffer[4];
+  if(id == DXL_BROADCAST_ID) {
+    // Fast Sync Read: 블록 [오류][ID][데이터][CRC 2], 마지막 블록의 CRC는 패킷 CRC
+    const uint16_t block = 4 + LEN_PRESENT_POSITION;
+    for(uint16_t p = 0; p + 2 + LEN_PRESENT_POSITION <= count; p += block) {
+      storePosition(params[p + 1], params[p], params + p + 2);
+    }
+  } else if(count >= 1 + LEN_PRESENT_POSITION) {
+    storePosition(id, params[0], params + 1);
+  }
+
+  if(responsesLeft > 0 && --responsesLeft == 0) finishRead();
+}
+
+//================= 폴링 =================
+void dxlPipelinePoll() {
+  if(rxHandler) {
+    int c;
+    while((c = rxHandler()) >= 0) {
+      receiveByte((uint8_t)c);
+    }
+  }
+
+  if(readPending && (long)(micros() - readDeadlineUs) > 0) {
+    finishRead();
+    resetReceiver();
+  }
+
+  // 버스가 비면 미룬 쓰기 전송
+  if(pendingLength > 0 && !busBusy()) {
+    uint32_t deferUs = micros() - pendingSinceUs;
+    if(deferUs > pipelineStats.maxDeferUs) pipelineStats.maxDeferUs = deferUs;
+    pipelineStats.deferredWrites++;
+    uint16_t length = pendingLength;
+    pendingLength = 0;
+    sendNow(pendingTx, length);
+  }
+}
+
+bool dxlPipelineBusy() {
+  return busBusy() || pendingLength > 0;
+}
+
+//================= 결과 조회 =================
+bool dxlPipelinePosition(uint8_t index, int32_t* position, unsigned long* readUs) {
+  if(index >= readCount || !(validMask & (1UL << index))) return false;
+  *position = positions[index];
+  if(readUs) *readUs = positionUs[index];
+  return true;
+}
+
+const DxlPipelineStats& dxlPipelineStats() {
+  return pipelineStats;
+}
@@ -0,0 +1,52 @@
+// dxl_pipeline.h - 싱크 라이트 / 위치 읽기 파이프라인 헤더
+// dxlBegin()에 dxlPipelineWrite를 넘기면 플레이어의 싱크 라이트가 이 모듈을 거쳐 나감
+// k번째 쓰기마다 바로 뒤에 (Fast) Sync Read 요청을 붙이고, 응답은 기다리지 않고 반환
+// 응답 바이트는 loop()의 dxlPipelinePoll()이 도착하는 대로 파싱 (그 사이 다음 프레임 계산)
+// 반이중 버스라 응답을 받는 중에 들어온 쓰기는 버퍼에 두었다가 응답이 끝나면 바로 전송
+// (그 사이 더 새로운 프레임이 오면 최신 것만 보냄)
+
+#ifndef DXL_PIPELINE_H
+#define DXL_PIPELINE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "dxl_protocol.h"
+
+// ===== 수신 함수 타입 (받은 바이트 하나, 없으면 -1) =====
+typedef int (*DxlRxHandler)();
+
+// ===== 통계 =====
+struct DxlPipelineStats {
+  uint32_t writes;           // 보낸 싱크 라이트
+  uint32_t deferredWrites;   // 응답 수신 중이라 미뤘다 보낸 쓰기
+  uint32_t replacedWrites;   // 미뤄 둔 쓰기가 보내기 전에 새 프레임으로 바뀜
+  uint32_t reads;            // 보낸 읽기 요청
+  uint32_t readsComplete;    // 모든 서보 응답을 받은 읽기
+  uint32_t readTimeouts;     // 응답이 모자란 채로 시간 초과
+  uint32_t crcErrors;        // CRC가 틀린 응답 패킷
+  uint32_t lastReadUs;       // 마지막 읽기: 요청 ~ 응답 완료
+  uint32_t maxReadUs;
+  uint32_t maxDeferUs;       // 쓰기를 미룬 최대 시간
+};
+
+// ===== 초기화 함수 =====
+// ids: 읽을 서보 ID (RAM, 최대 DXL_MAX_MOTORS), wire: 실제 버스 송신, rx: 버스 수신
+void dxlPipelineBegin(const uint8_t* ids, uint8_t count, DxlTxHandler wire, DxlRxHandler rx,
+                      uint8_t readEvery, bool fastRead);
+
+// ===== 송신 (DxlTxHandler 호환) =====
+void dxlPipelineWrite(const uint8_t* data, uint16_t length);
+
+// ===== 수신 / 미룬 쓰기 처리 (loop()마다 호출, 블로킹 없음) =====
+void dxlPipelinePoll();
+bool dxlPipelineBusy();      // 응답 대기 중이거나 미룬 쓰기가 있음
+
+// ===== 결과 조회 =====
+// 마지막으로 읽은 현재 위치와 그 읽기가 끝난 시각 (micros), 읽은 적 없으면 false
+bool dxlPipelinePosition(uint8_t index, int32_t* position, unsigned long* readUs);
+const DxlPipelineStats& dxlPipelineStats();
+
+// 응답 예상 시간 (us, 요청 송신 끝부터 마지막 바이트까지)
+uint32_t dxlPipelineResponseUs(uint8_t count, bool fastRead);
+
+#endif
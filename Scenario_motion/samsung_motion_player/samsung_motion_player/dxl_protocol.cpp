@@ -0,0 +1,200 @@
+// dxl_protocol.cpp - 다이나믹셀 프로토콜 2.0 패킷 생성 구현
+// 헤더(FF FF FD 00) + ID + 길이 + 명령 + 파라미터 + CRC16
+
+#include "dxl_protocol.h"
+
+// ================= CRC16 테이블 (다항식 0x8005) =================
+const uint16_t dxlCrcTable[256] PROGMEM = {
+  0x0000, 0x8005, 0x800F, 0x000A, 0x801B, 0x001E, 0x0014, 0x8011,
+  0x8033, 0x0036, 0x003C, 0x8039, 0x0028, 0x802D, 0x8027, 0x0022,
+  0x8063, 0x0066, 0x006C, 0x8069, 0x0078, 0x807D, 0x8077, 0x0072,
+  0x0050, 0x8055, 0x805F, 0x005A, 0x804B, 0x004E, 0x0044, 0x8041,
+  0x80C3, 0x00C6, 0x00CC, 0x80C9, 0x00D8, 0x80DD, 0x80D7, 0x00D2,
+  0x00F0, 0x80F5, 0x80FF, 0x00FA, 0x80EB, 0x00EE, 0x00E4, 0x80E1,
+  0x00A0, 0x80A5, 0x80AF, 0x00AA, 0x80BB, 0x00BE, 0x00B4, 0x80B1,
+  0x8093, 0x0096, 0x009C, 0x8099, 0x0088, 0x808D, 0x8087, 0x0082,
+  0x8183, 0x0186, 0x018C, 0x8189, 0x0198, 0x819D, 0x8197, 0x0192,
+  0x01B0, 0x81B5, 0x81BF, 0x01BA, 0x81AB, 0x01AE, 0x01A4, 0x81A1,
+  0x01E0, 0x81E5, 0x81EF, 0x01EA, 0x81FB, 0x01FE, 0x01F4, 0x81F1,
+  0x81D3, 0x01D6, 0x01DC, 0x81D9, 0x01C8, 0x81CD, 0x81C7, 0x01C2,
+  0x0140, 0x8145, 0x814F, 0x014A, 0x815B, 0x015E, 0x0154, 0x8151,
+  0x8173, 0x0176, 0x017C, 0x8179, 0x0168, 0x816D, 0x8167, 0x0162,
+  0x8123, 0x0126, 0x012C, 0x8129, 0x0138, 0x813D, 0x8137, 0x0132,
+  0x0110, 0x8115, 0x811F, 0x011A, 0x810B, 0x010E, 0x0104, 0x8101,
+  0x8303, 0x0306, 0x030C, 0x8309, 0x0318, 0x831D, 0x8317, 0x0312,
+  0x0330, 0x8335, 0x833F, 0x033A, 0x832B, 0x032E, 0x0324, 0x8321,
+  0x0360, 0x8365, 0x836F, 0x036A, 0x837B, 0x037E, 0x0374, 0x8371,
+  0x8353, 0x0356, 0x035C, 0x8359, 0x0348, 0x834D, 0x8347, 0x0342,
+  0x03C0, 0x83C5, 0x83CF, 0x03CA, 0x83DB, 0x03DE, 0x03D4, 0x83D1,
+  0x83F3, 0x03F6, 0x03FC, 0x83F9, 0x03E8, 0x83ED, 0x83E7, 0x03E2,
+  0x83A3, 0x03A6, 0x03AC, 0x83A9, 0x03B8, 0x83BD, 0x83B7, 0x03B2,
+  0x0390, 0x8395, 0x839F, 0x039A, 0x838B, 0x038E, 0x0384, 0x8381,
+  0x0280, 0x8285, 0x828F, 0x028A, 0x829B, 0x029E, 0x0294, 0x8291,
+  0x82B3, 0x02B6, 0x02BC, 0x82B9, 0x02A8, 0x82AD, 0x82A7, 0x02A2,
+  0x82E3, 0x02E6, 0x02EC, 0x82E9, 0x02F8, 0x82FD, 0x82F7, 0x02F2,
+  0x02D0, 0x82D5, 0x82DF, 0x02DA, 0x82CB, 0x02CE, 0x02C4, 0x82C1,
+  0x8243, 0x0246, 0x024C, 0x8249, 0x0258, 0x825D, 0x8257, 0x0252,
+  0x0270, 0x8275, 0x827F, 0x027A, 0x826B, 0x026E, 0x0264, 0x8261,
+  0x0220, 0x8225, 0x822F, 0x022A, 0x823B, 0x023E, 0x0234, 0x8231,
+  0x8213, 0x0216, 0x021C, 0x8219, 0x0208, 0x820D, 0x8207, 0x0202,
+};
+
+// ================= 패킷 버퍼 =================
+static uint8_t txBuffer[DXL_TX_BUFFER_SIZE];
+static uint16_t txLength = 0;
+static bool txOverflow = false;
+static uint8_t stuffMatch = 0;     // 스터핑 패턴(FF FF FD) 일치 개수
+static DxlTxHandler txHandler = 0;
+
+// 패킷 헤더 이후 위치 (ID=4, 길이=5~6, 명령=7)
+#define DXL_PKT_LENGTH_L  5
+#define DXL_PKT_LENGTH_H  6
+#define DXL_PKT_HEADER    7
+
+//================= 초기화 함수 =================
+void dxlBegin(DxlTxHandler handler) {
+  txHandler = handler;
+  txLength = 0;
+}
+
+//================= CRC 함수 =================
+uint16_t dxlUpdateCRC(uint16_t crc, const uint8_t* data, uint16_t length) {
+  for(uint16_t i = 0; i < length; i++) {
+    uint8_t index = ((uint8_t)(crc >> 8) ^ data[i]) & 0xFF;
+    crc = (crc << 8) ^ pgm_read_word(&dxlCrcTable[index]);
+  }
+  return crc;
+}
+
+//================= 패킷 생성 함수 =================
+
+// 버퍼에 한 바이트 기록 (범위 초과시 오버플로 표시)
+static void putByte(uint8_t value) {
+  if(txLength < DXL_TX_BUFFER_SIZE) {
+    txBuffer[txLength++] = value;
+  } else {
+    txOverflow = true;
+  }
+}
+
+// 패킷 시작: 헤더, ID, 길이 자리, 명령 기록
+void dxlBeginPacket(uint8_t id, uint8_t instruction) {
+  txLength = 0;
+  txOverflow = false;
+  stuffMatch = 0;
+
+  putByte(0xFF);
+  putByte(0xFF);
+  putByte(0xFD);
+  putByte(0x00);
+  putByte(id);
+  putByte(0);             // 길이 L (dxlFinishPacket에서 채움)
+  putByte(0);             // 길이 H
+  putByte(instruction);
+}
+
+// 파라미터 추가 (FF FF FD 패턴 뒤에 FD를 삽입하는 바이트 스터핑 포함)
+void dxlPushParam(uint8_t value) {
+  putByte(value);
+
+  if(stuffMatch == 2 && value == 0xFD) {
+    putByte(0xFD);        // 스터핑 바이트
+    stuffMatch = 0;
+  } else if(value == 0xFF) {
+    stuffMatch = (stuffMatch < 2) ? stuffMatch + 1 : 2;
+  } else {
+    stuffMatch = 0;
+  }
+}
+
+void dxlPushParam16(uint16_t value) {
+  dxlPushParam(value & 0xFF);
+  dxlPushParam((value >> 8) & 0xFF);
+}
+
+void dxlPushParam32(int32_t value) {
+  uint32_t v = (uint32_t)value;
+  dxlPushParam(v & 0xFF);
+  dxlPushParam((v >> 8) & 0xFF);
+  dxlPushParam((v >> 16) & 0xFF);
+  dxlPushParam((v >> 24) & 0xFF);
+}
+
+// 패킷 마무리: 길이 필드 기록 후 CRC 추가
+bool dxlFinishPacket() {
+  // 길이 = 명령 + 파라미터(스터핑 후) + CRC(2)
+  uint16_t length = txLength - DXL_PKT_HEADER + 2;
+  if(txLength + 2 > DXL_TX_BUFFER_SIZE) {
+    txOverflow = true;
+  }
+  if(txOverflow) {
+    txLength = 0;
+    return false;
+  }
+
+  txBuffer[DXL_PKT_LENGTH_L] = length & 0xFF;
+  txBuffer[DXL_PKT_LENGTH_H] = (length >> 8) & 0xFF;
+
+  uint16_t crc = dxlUpdateCRC(0, txBuffer, txLength);
+  txBuffer[txLength++] = crc & 0xFF;
+  txBuffer[txLength++] = (crc >> 8) & 0xFF;
+  return true;
+}
+
+//================= 싱크 라이트 함수 =================
+
+// 싱크 라이트 시작 (브로드캐스트, 시작 주소 + 모터당 데이터 길이)
+void dxlBeginSyncWrite(uint16_t address, uint16_t dataLength) {
+  dxlBeginPacket(DXL_BROADCAST_ID, DXL_INST_SYNC_WRITE);
+  dxlPushParam16(address);
+  dxlPushParam16(dataLength);
+}
+
+// 모터 한 개의 4바이트 데이터 추가 (리틀 엔디안)
+void dxlSyncWriteAdd32(uint8_t id, int32_t value) {
+  dxlPushParam(id);
+  dxlPushParam32(value);
+}
+
+// 모터 한 개의 프로파일 가속도 + 프로파일 속도 + 목표 위치 (주소 108부터 12바이트)
+void dxlSyncWriteAddProfile(uint8_t id, uint32_t acceleration, uint32_t velocity, int32_t position) {
+  dxlPushParam(id);
+  dxlPushParam32((int32_t)acceleration);
+  dxlPushParam32((int32_t)velocity);
+  dxlPushParam32(position);
+}
+
+//================= 단일 쓰기 함수 =================
+bool dxlWrite1(uint8_t id, uint16_t address, uint8_t value) {
+  dxlBeginPacket(id, DXL_INST_WRITE);
+  dxlPushParam16(address);
+  dxlPushParam(value);
+  return dxlFinishPacket() && dxlTransmit();
+}
+
+bool dxlWrite4(uint8_t id, uint16_t address, int32_t value) {
+  dxlBeginPacket(id, DXL_INST_WRITE);
+  dxlPushParam16(address);
+  dxlPushParam32(value);
+  return dxlFinishPacket() && dxlTransmit();
+}
+
+//================= 전송 함수 =================
+bool dxlTransmit() {
+  if(txHandler == 0 || txLength == 0) return false;
+  txHandler(txBuffer, txLength);
+  return true;
+}
+
+//================= 버퍼 조회 함수 =================
+const uint8_t* dxlPacketData() {
+  return txBuffer;
+}
+
+uint16_t dxlPacketLength() {
+  return txLength;
+}
+
+uint32_t dxlWireTimeUs(uint16_t bytes) {
+  return (uint32_t)bytes * 100000UL / (DXL_BAUDRATE / 100UL);
+}
@@ -0,0 +1,54 @@
+// dxl_protocol.h - 다이나믹셀 프로토콜 2.0 패킷 생성 헤더
+
+#ifndef DXL_PROTOCOL_H
+#define DXL_PROTOCOL_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ===== 프로토콜 2.0 상수 =====
+#define DXL_BROADCAST_ID        0xFE
+#define DXL_INST_PING           0x01
+#define DXL_INST_READ           0x02
+#define DXL_INST_WRITE          0x03
+#define DXL_INST_STATUS         0x55
+#define DXL_INST_SYNC_READ      0x82
+#define DXL_INST_SYNC_WRITE     0x83
+#define DXL_INST_FAST_SYNC_READ 0x8A
+
+// ===== 송신 함수 타입 (펌웨어: 시리얼, 호스트: 시뮬레이션 버스) =====
+typedef void (*DxlTxHandler)(const uint8_t* data, uint16_t length);
+
+// ===== 초기화 함수 =====
+void dxlBegin(DxlTxHandler handler);
+
+// ===== CRC 함수 =====
+uint16_t dxlUpdateCRC(uint16_t crc, const uint8_t* data, uint16_t length);
+
+// ===== 패킷 생성 함수 (정적 버퍼 사용, 동적 할당 없음) =====
+void dxlBeginPacket(uint8_t id, uint8_t instruction);
+void dxlPushParam(uint8_t value);
+void dxlPushParam16(uint16_t value);
+void dxlPushParam32(int32_t value);
+bool dxlFinishPacket();
+
+// ===== 싱크 라이트 함수 =====
+void dxlBeginSyncWrite(uint16_t address, uint16_t dataLength);
+void dxlSyncWriteAdd32(uint8_t id, int32_t value);
+void dxlSyncWriteAddProfile(uint8_t id, uint32_t acceleration, uint32_t velocity, int32_t position);
+
+// ===== 단일 쓰기 함수 (모터 설정용) =====
+bool dxlWrite1(uint8_t id, uint16_t address, uint8_t value);
+bool dxlWrite4(uint8_t id, uint16_t address, int32_t value);
+
+// ===== 전송 함수 =====
+bool dxlTransmit();
+
+// ===== 버퍼 조회 함수 =====
+const uint8_t* dxlPacketData();
+uint16_t dxlPacketLength();
+
+// 패킷 한 개의 전송 시간 (us, 1바이트 = 10비트)
+uint32_t dxlWireTimeUs(uint16_t bytes);
+
+#endif
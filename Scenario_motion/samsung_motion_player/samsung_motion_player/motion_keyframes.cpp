@@ -0,0 +1,68 @@
+// motion_keyframes.cpp - 키프레임(감축) 모션 트랙 구현
+
+#include "motion_keyframes.h"
+
+static uint32_t keyTimeUs(const KeyframeTrack& track, uint16_t key) {
+  return (uint32_t)pgm_read_word(&track.keyFrames[key]) * track.frameIntervalUs;
+}
+
+static int32_t keyValue(const KeyframeTrack& track, uint16_t key) {
+  return (int32_t)pgm_read_dword(&track.keyValues[key]);
+}
+
+// 반올림 나눗셈 (음수 포함)
+static int32_t divRound(int64_t num, int32_t den) {
+  if(num >= 0) return (int32_t)((num + den / 2) / den);
+  return -(int32_t)((-num + den / 2) / den);
+}
+
+//================= 키프레임 함수 =================
+void initKeyframeCursor(const KeyframeTrack& track, KeyframeCursor& cursor) {
+  for(uint8_t m = 0; m < track.motorCount && m < DXL_MAX_MOTORS; m++) {
+    cursor.key[m] = pgm_read_word(&track.channelStart[m]);
+  }
+}
+
+uint32_t keyframeDurationUs(const KeyframeTrack& track) {
+  if(track.frameCount == 0) return 0;
+  return (uint32_t)(track.frameCount - 1) * track.frameIntervalUs;
+}
+
+// timeUs 시점의 모든 모터 위치 복원 (움직이는 모터가 있으면 true)
+// 재생은 앞으로만 진행하므로 커서는 틱당 거의 한 칸 이하로 이동
+bool sampleKeyframes(const KeyframeTrack& track, KeyframeCursor& cursor, uint32_t timeUs, int32_t* out) {
+  bool moving = false;
+
+  for(uint8_t m = 0; m < track.motorCount; m++) {
+    uint16_t first = pgm_read_word(&track.channelStart[m]);
+    uint16_t end = pgm_read_word(&track.channelStart[m + 1]);
+    uint16_t k = cursor.key[m];
+
+    // 되감기 (처음부터 다시 찾기)
+    if(k < first || k >= end || keyTimeUs(track, k) > timeUs) {
+      k = first;
+    }
+    while(k + 1 < end && keyTimeUs(track, k + 1) <= timeUs) {
+      k++;
+    }
+    cursor.key[m] = k;
+
+    int32_t v0 = keyValue(track, k);
+    if(k + 1 >= end) {
+      out[m] = v0;                     // 마지막 키 이후 유지
+      continue;
+    }
+
+    int32_t v1 = keyValue(track, k + 1);
+    if(v0 == v1) {
+      out[m] = v0;                     // 정지 구간
+      continue;
+    }
+
+    uint32_t t0 = keyTimeUs(track, k);
+    uint32_t t1 = keyTimeUs(track, k + 1);
+    out[m] = v0 + divRound((int64_t)(v1 - v0) * (int32_t)(timeUs - t0), (int32_t)(t1 - t0));
+    moving = true;
+  }
+  return moving;
+}
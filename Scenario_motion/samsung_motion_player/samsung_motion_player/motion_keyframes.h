@@ -0,0 +1,33 @@
+// motion_keyframes.h - 키프레임(감축) 모션 트랙 헤더
+// 모터별 키프레임 사이를 선형 보간, 모터마다 커서를 두어 틱당 O(1)로 위치 복원
+
+#ifndef MOTION_KEYFRAMES_H
+#define MOTION_KEYFRAMES_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ===== 키프레임 트랙 구조체 (데이터는 모두 PROGMEM) =====
+// 모터 m의 키프레임은 keyFrames/keyValues의 [channelStart[m], channelStart[m + 1]) 구간
+// 각 모터의 첫 키는 프레임 0, 마지막 키는 마지막 프레임
+struct KeyframeTrack {
+  uint8_t motorCount;          // 모터 개수
+  uint16_t frameCount;         // 원래 프레임 개수
+  uint32_t frameIntervalUs;    // 원래 프레임 간격
+  const uint8_t* motorIds;     // 모터 ID 목록 (PROGMEM)
+  const uint16_t* channelStart;// 모터별 키 시작 인덱스, motorCount + 1개 (PROGMEM)
+  const uint16_t* keyFrames;   // 키 프레임 번호 (PROGMEM)
+  const int32_t* keyValues;    // 키 상대 위치 (PROGMEM)
+};
+
+// ===== 재생 커서 (모터별 현재 구간의 시작 키) =====
+struct KeyframeCursor {
+  uint16_t key[DXL_MAX_MOTORS];
+};
+
+// ===== 키프레임 함수 =====
+void initKeyframeCursor(const KeyframeTrack& track, KeyframeCursor& cursor);
+bool sampleKeyframes(const KeyframeTrack& track, KeyframeCursor& cursor, uint32_t timeUs, int32_t* out);
+uint32_t keyframeDurationUs(const KeyframeTrack& track);
+
+#endif
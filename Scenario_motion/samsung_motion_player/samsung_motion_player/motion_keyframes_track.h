@@ -0,0 +1,37 @@
+// motion_keyframes_track.h - PROGMEM 키프레임 트랙 (track_decimate로 생성, 직접 수정 금지)
+// 원본: 0827_breathing_1.json (575 프레임 -> 키 49개, 허용 오차 2 units)
+
+#ifndef MOTION_KEYFRAMES_TRACK_H
+#define MOTION_KEYFRAMES_TRACK_H
+
+#include "motion_keyframes.h"
+
+#define MOTION_KEY_MOTORS 1
+#define MOTION_KEY_COUNT 49
+
+const uint8_t motionKeyIds[MOTION_KEY_MOTORS] PROGMEM = {1};
+
+const uint16_t motionKeyChannelStart[MOTION_KEY_MOTORS + 1] PROGMEM = {0, 49};
+
+const uint16_t motionKeyFrames[MOTION_KEY_COUNT] PROGMEM = {
+  0, 9, 20, 48, 58, 68, 75, 78, 87, 117, 128, 139,
+  145, 147, 157, 191, 203, 211, 218, 220, 228, 260, 272, 283,
+  290, 296, 307, 335, 345, 355, 362, 365, 374, 404, 415, 426,
+  432, 434, 444, 478, 490, 498, 505, 507, 516, 542, 557, 567,
+  574,
+};
+
+const int32_t motionKeyValues[MOTION_KEY_COUNT] PROGMEM = {
+  0, -9, -42, -168, -205, -225, -225, -219, -189, -60, -23, -1,
+  -1, -3, -33, -175, -212, -225, -225, -221, -198, -63, -23, -1,
+  -1, -9, -42, -168, -205, -225, -225, -219, -189, -60, -23, -1,
+  -1, -3, -33, -175, -212, -225, -225, -221, -194, -83, -28, -5,
+  0,
+};
+
+const KeyframeTrack motionKeyframes = {
+  MOTION_KEY_MOTORS, 575, 41667UL,
+  motionKeyIds, motionKeyChannelStart, motionKeyFrames, motionKeyValues
+};
+
+#endif
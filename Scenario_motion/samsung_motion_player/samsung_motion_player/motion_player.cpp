@@ -0,0 +1,282 @@
+// motion_player.cpp - PROGMEM 모션 트랙 재생 구현
+// 파이썬 play_simultaneous_relative와 같은 상대 위치 + 싱크 라이트 방식
+
+#include "motion_player.h"
+#include "dxl_protocol.h"
+#include "motion_resampler.h"
+
+// ================= 재생 상태 =================
+static const MotionTrack* currentTrack = 0;    // 프레임 트랙
+static const KeyframeTrack* keyTrack = 0;      // 키프레임 트랙 (둘 중 하나만 사용)
+static int32_t basePositions[DXL_MAX_MOTORS];  // 각 모터의 기준 위치
+static uint8_t reverseMask = 0;                // 역방향 모터 비트마스크
+static unsigned long playbackStartUs = 0;
+static int32_t lastSentFrame = -1;
+static bool playbackActive = false;
+static MotionFrameStats frameStats;
+
+// 제어 주기 리샘플링 상태 (controlIntervalUs = 0 이면 사용 안 함)
+static uint32_t controlIntervalUs = 0;
+static MotionResampler resampler;
+static int32_t resampled[RESAMPLE_LANES];
+
+// 키프레임 재생 상태 (정지 구간 전송 생략용으로 마지막 전송 값 보관)
+static KeyframeCursor keyCursor;
+static int32_t keyOffsets[DXL_MAX_MOTORS];
+static int32_t lastSentOffsets[DXL_MAX_MOTORS];
+static bool lastSentValid = false;
+
+static bool sendResampledTick(uint16_t tick);
+static bool sendKeyframeTick(uint16_t tick, uint32_t intervalUs);
+
+// ================= 트랙 공통 정보 =================
+static uint8_t trackMotorCount() {
+  if(currentTrack) return currentTrack->motorCount;
+  if(keyTrack) return keyTrack->motorCount;
+  return 0;
+}
+
+static uint8_t trackMotorId(uint8_t motor) {
+  const uint8_t* ids = currentTrack ? currentTrack->motorIds : keyTrack->motorIds;
+  return pgm_read_byte(&ids[motor]);
+}
+
+static uint32_t trackIntervalUs() {
+  return currentTrack ? currentTrack->frameIntervalUs : keyTrack->frameIntervalUs;
+}
+
+// 구간 프로파일 사용 여부 (프레임 트랙에만 있음)
+static bool trackHasProfiles() {
+  return currentTrack != 0 && currentTrack->profiles != 0;
+}
+
+// 구간 segment의 프로파일 행 (모터 순서대로 [가속도, 속도], 트랙 끝을 넘으면 마지막 행)
+static const uint16_t* profileRow(uint32_t segment) {
+  if(segment >= currentTrack->frameCount) segment = currentTrack->frameCount - 1;
+  return currentTrack->profiles + segment * currentTrack->motorCount * 2;
+}
+
+//================= 초기화 함수 =================
+void initMotionPlayer(const MotionTrack* track) {
+  currentTrack = track;
+  keyTrack = 0;
+  reverseMask = 0;
+  controlIntervalUs = 0;
+  lastSentFrame = -1;
+  playbackActive = false;
+  memset(basePositions, 0, sizeof(basePositions));
+  memset(&frameStats, 0, sizeof(frameStats));
+}
+
+// 키프레임 트랙으로 초기화 (위치는 재생 중 키 사이를 선형 보간)
+void initMotionPlayerKeyframes(const KeyframeTrack* track) {
+  initMotionPlayer(0);
+  keyTrack = track;
+}
+
+// 현재 모터 위치를 기준점으로 설정
+void setMotionBasePosition(uint8_t motorIndex, int32_t position) {
+  if(motorIndex < DXL_MAX_MOTORS) {
+    basePositions[motorIndex] = position;
+  }
+}
+
+// 모터 회전 방향 설정 (오프셋에만 적용)
+void setMotionDirection(uint8_t motorIndex, bool reverse) {
+  if(motorIndex >= DXL_MAX_MOTORS) return;
+  if(reverse) {
+    reverseMask |= (1 << motorIndex);
+  } else {
+    reverseMask &= ~(1 << motorIndex);
+  }
+}
+
+// 모터 초기 설정 (토크 OFF → 확장 위치 모드 → 프로파일 속도 → 토크 ON)
+void setupMotionMotors(uint16_t profileVelocity) {
+  for(uint8_t m = 0; m < trackMotorCount(); m++) {
+    uint8_t id = trackMotorId(m);
+    dxlWrite1(id, ADDR_TORQUE_ENABLE, 0);
+    dxlWrite1(id, ADDR_OPERATING_MODE, DXL_OPERATING_MODE);
+    dxlWrite4(id, ADDR_PROFILE_VELOCITY, profileVelocity);
+    dxlWrite1(id, ADDR_TORQUE_ENABLE, 1);
+  }
+}
+
+// 제어 주기 설정 (작성된 fps와 다른 주기로 보간해서 전송)
+// 키프레임 트랙은 항상 선형 보간이므로 resampleMode는 무시
+void setMotionControlRate(uint16_t rateHz, uint8_t resampleMode) {
+  if(rateHz == 0) {
+    controlIntervalUs = 0;
+    return;
+  }
+  controlIntervalUs = 1000000UL / rateHz;
+  if(currentTrack) {
+    initResampler(resampler, currentTrack, resampleMode);
+  }
+}
+
+//================= 재생 함수 =================
+void startMotionPlayback() {
+  playbackStartUs = micros();
+  lastSentFrame = -1;
+  lastSentValid = false;
+  playbackActive = (currentTrack != 0 && currentTrack->frameCount > 0) ||
+                   (keyTrack != 0 && keyTrack->frameCount > 0);
+  frameStats.skippedFrames = 0;
+  frameStats.heldFrames = 0;
+  if(keyTrack) {
+    initKeyframeCursor(*keyTrack, keyCursor);
+  }
+}
+
+// 시간에 맞춰 현재 프레임 전송 (전송했으면 true)
+bool updateMotionPlayback() {
+  if(!playbackActive) return false;
+
+  unsigned long elapsed = micros() - playbackStartUs;
+  uint32_t interval = controlIntervalUs ? controlIntervalUs : trackIntervalUs();
+  uint32_t frame = elapsed / interval;
+  uint32_t lastFrame;
+  if(keyTrack) {
+    lastFrame = keyframeDurationUs(*keyTrack) / interval;
+  } else if(controlIntervalUs) {
+    lastFrame = resampleDurationUs(currentTrack) / interval;
+  } else {
+    lastFrame = currentTrack->frameCount - 1;
+  }
+
+  if(frame > lastFrame) {
+    playbackActive = false;
+    return false;
+  }
+  if((int32_t)frame <= lastSentFrame) return false;
+
+  // 루프가 늦어 밀린 프레임은 건너뛰고 현재 프레임만 전송
+  if(lastSentFrame >= 0 && (int32_t)frame > lastSentFrame + 1) {
+    frameStats.skippedFrames += frame - lastSentFrame - 1;
+  }
+  lastSentFrame = frame;
+
+  if(keyTrack) {
+    return sendKeyframeTick(frame, interval);
+  }
+  if(controlIntervalUs) {
+    return sendResampledTick(frame);
+  }
+  return sendMotionFrame(frame);
+}
+
+// 싱크 라이트 시작 (프로파일이 있으면 가속도부터 목표까지 12바이트, 없으면 목표 위치만)
+static void beginGoalWrite() {
+  if(trackHasProfiles()) {
+    dxlBeginSyncWrite(ADDR_PROFILE_ACCELERATION, LEN_PROFILE_GOAL);
+  } else {
+    dxlBeginSyncWrite(ADDR_GOAL_POSITION, LEN_GOAL_POSITION);
+  }
+}
+
+// 모터별 상대 위치를 절대 위치로 바꿔 싱크 라이트에 추가 (profile = 구간 프로파일 행, 0 = 위치만)
+static void addGoalPosition(uint8_t motor, int32_t offset, const uint16_t* profile) {
+  uint8_t id = trackMotorId(motor);
+  if(reverseMask & (1 << motor)) {
+    offset = -offset;
+  }
+
+  int32_t position = basePositions[motor] + offset;
+  position = constrain(position, -DXL_POSITION_LIMIT, DXL_POSITION_LIMIT);
+  if(profile) {
+    dxlSyncWriteAddProfile(id, pgm_read_word(&profile[motor * 2]), pgm_read_word(&profile[motor * 2 + 1]), position);
+  } else {
+    dxlSyncWriteAdd32(id, position);
+  }
+}
+
+// 생성이 끝난 패킷의 통계 기록 후 전송
+static bool transmitFrame(uint16_t frame, unsigned long buildStart, bool built, uint32_t intervalUs) {
+  unsigned long buildUs = micros() - buildStart;
+  if(!built) return false;
+
+  uint16_t bytes = dxlPacketLength();
+  uint32_t wireUs = dxlWireTimeUs(bytes);
+  frameStats.frame = frame;
+  frameStats.packetBytes = bytes;
+  frameStats.buildUs = buildUs;
+  frameStats.wireUs = wireUs;
+  frameStats.busLoadPermille = wireUs * 1000UL / intervalUs;
+
+  return dxlTransmit();
+}
+
+// 프레임 한 개를 싱크 라이트 패킷으로 생성 후 전송
+// 프로파일이 있으면 구간 끝(다음 프레임)을 목표로, 구간 속도로 프레임 간격 동안 따라가게 함
+bool sendMotionFrame(uint16_t frame) {
+  if(currentTrack == 0 || frame >= currentTrack->frameCount) return false;
+
+  unsigned long buildStart = micros();
+
+  // PROGMEM에서 바로 읽어 패킷 버퍼에 기록 (중간 배열 없음)
+  const uint16_t* profile = 0;
+  uint16_t goalFrame = frame;
+  if(trackHasProfiles()) {
+    profile = profileRow(frame);
+    if(goalFrame + 1 < currentTrack->frameCount) goalFrame++;
+  }
+  const int32_t* row = currentTrack->offsets + (uint32_t)goalFrame * currentTrack->motorCount;
+  beginGoalWrite();
+  for(uint8_t m = 0; m < currentTrack->motorCount; m++) {
+    addGoalPosition(m, (int32_t)pgm_read_dword(&row[m]), profile);
+  }
+
+  return transmitFrame(frame, buildStart, dxlFinishPacket(), currentTrack->frameIntervalUs);
+}
+
+// 제어 주기 틱 한 개를 보간해서 전송
+// 프로파일이 있으면 다음 틱 위치를 목표로, 그 시각이 속한 작성 구간의 프로파일과 함께 보냄
+static bool sendResampledTick(uint16_t tick) {
+  unsigned long buildStart = micros();
+
+  uint32_t goalUs = (uint32_t)tick * controlIntervalUs;
+  const uint16_t* profile = 0;
+  if(trackHasProfiles()) {
+    goalUs += controlIntervalUs;
+    profile = profileRow((goalUs - 1) / currentTrack->frameIntervalUs);
+  }
+  resampleAt(resampler, goalUs, resampled);
+  beginGoalWrite();
+  for(uint8_t m = 0; m < currentTrack->motorCount; m++) {
+    addGoalPosition(m, resampled[m], profile);
+  }
+
+  return transmitFrame(tick, buildStart, dxlFinishPacket(), controlIntervalUs);
+}
+
+// 키프레임 트랙 틱 전송 (모든 모터가 정지 구간이고 값이 같으면 전송 생략)
+static bool sendKeyframeTick(uint16_t tick, uint32_t intervalUs) {
+  unsigned long buildStart = micros();
+  uint8_t motors = keyTrack->motorCount;
+
+  bool moving = sampleKeyframes(*keyTrack, keyCursor, (uint32_t)tick * intervalUs, keyOffsets);
+  if(!moving && lastSentValid &&
+     memcmp(keyOffsets, lastSentOffsets, motors * sizeof(int32_t)) == 0) {
+    frameStats.heldFrames++;
+    return false;
+  }
+
+  dxlBeginSyncWrite(ADDR_GOAL_POSITION, LEN_GOAL_POSITION);
+  for(uint8_t m = 0; m < motors; m++) {
+    addGoalPosition(m, keyOffsets[m], 0);
+  }
+  memcpy(lastSentOffsets, keyOffsets, motors * sizeof(int32_t));
+  lastSentValid = true;
+
+  return transmitFrame(tick, buildStart, dxlFinishPacket(), intervalUs);
+}
+
+bool isMotionPlaybackComplete() {
+  return !playbackActive;
+}
+
+//================= 통계 조회 함수 =================
+const MotionFrameStats& getMotionFrameStats() {
+  return frameStats;
+}
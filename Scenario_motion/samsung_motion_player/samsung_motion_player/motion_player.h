@@ -0,0 +1,55 @@
+// motion_player.h - PROGMEM 모션 트랙 재생 헤더
+
+#ifndef MOTION_PLAYER_H
+#define MOTION_PLAYER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "motion_keyframes.h"
+
+// ===== 모션 트랙 구조체 (데이터는 모두 PROGMEM) =====
+// offsets는 프레임 우선 배열: offsets[frame * motorCount + motor]
+// 값은 첫 프레임 대비 상대 위치 (파이썬 상대 모드와 동일)
+// profiles는 구간(프레임 k → k+1)별 [프로파일 가속도, 프로파일 속도] 쌍 (track_export --profiles로 생성)
+//   profiles[(frame * motorCount + motor) * 2 + 0/1], 있으면 목표를 한 프레임 앞서 보내고
+//   가속도/속도/목표를 한 싱크 라이트(주소 108~119)로 전송
+struct MotionTrack {
+  uint8_t motorCount;        // 모터 개수
+  uint16_t frameCount;       // 프레임 개수
+  uint32_t frameIntervalUs;  // 프레임 간격 (24fps = 41667us)
+  const uint8_t* motorIds;   // 모터 ID 목록 (PROGMEM)
+  const int32_t* offsets;    // 상대 위치 (PROGMEM)
+  const uint16_t* profiles;  // 구간별 프로파일 (PROGMEM, 0 = 없음: setupMotionMotors의 속도 고정)
+};
+
+// ===== 프레임별 통계 구조체 =====
+struct MotionFrameStats {
+  uint16_t frame;            // 마지막으로 전송한 프레임 (제어 주기 사용시 틱) 번호
+  uint16_t skippedFrames;    // 늦어서 건너뛴 프레임 수 (누적)
+  uint16_t packetBytes;      // 싱크 라이트 패킷 크기 (바이트)
+  uint16_t buildUs;          // 패킷 생성 시간 (us)
+  uint16_t wireUs;           // 패킷 전송 시간 (us)
+  uint16_t busLoadPermille;  // 전송 간격 대비 버스 점유율 (‰)
+  uint16_t heldFrames;       // 정지 구간이라 전송을 생략한 틱 수 (누적, 키프레임 트랙)
+};
+
+// ===== 초기화 함수 =====
+void initMotionPlayer(const MotionTrack* track);
+void initMotionPlayerKeyframes(const KeyframeTrack* track);
+void setMotionBasePosition(uint8_t motorIndex, int32_t position);
+void setMotionDirection(uint8_t motorIndex, bool reverse);
+void setupMotionMotors(uint16_t profileVelocity);
+
+// 제어 주기 설정 (0 = 작성된 프레임 그대로, 예: 100/200Hz + 보간 모드)
+void setMotionControlRate(uint16_t rateHz, uint8_t resampleMode);
+
+// ===== 재생 함수 =====
+void startMotionPlayback();
+bool updateMotionPlayback();
+bool sendMotionFrame(uint16_t frame);
+bool isMotionPlaybackComplete();
+
+// ===== 통계 조회 함수 =====
+const MotionFrameStats& getMotionFrameStats();
+
+#endif
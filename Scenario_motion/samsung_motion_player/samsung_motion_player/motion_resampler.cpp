@@ -0,0 +1,154 @@
+// motion_resampler.cpp - 모션 트랙 리샘플러 구현
+// 정수 연산만 사용 (AVR), 호스트에서는 모터 4개씩 SSE4.1로 처리
+// SSE4.1 함수만 target 속성으로 컴파일하고 실행 시 CPU를 확인해 선택 (빌드 옵션 불필요)
+
+#include "motion_resampler.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <smmintrin.h>
+#define RESAMPLE_SIMD 1
+#define SSE41_TARGET __attribute__((target("sse4.1")))
+#endif
+
+// 트랙에서 (frame, motor) 위치 읽기 (범위 밖 프레임은 끝 값으로 고정)
+static int32_t trackValue(const MotionTrack* track, int32_t frame, uint8_t motor) {
+  if(frame < 0) frame = 0;
+  if(frame >= (int32_t)track->frameCount) frame = track->frameCount - 1;
+  const int32_t* row = track->offsets + (uint32_t)frame * track->motorCount;
+  return (int32_t)pgm_read_dword(&row[motor]);
+}
+
+// 단조 접선: 양쪽 기울기 부호가 같을 때만 조화 평균 (Fritsch-Butland)
+static int32_t monotoneTangent(int32_t before, int32_t after) {
+  if((before > 0 && after > 0) || (before < 0 && after < 0)) {
+    int64_t num = 2 * (int64_t)before * after;
+    return (int32_t)(num / (before + after));
+  }
+  return 0;
+}
+
+// 구간 계수 계산 (구간이 바뀔 때만 호출)
+static void loadSegment(MotionResampler& r, int32_t segment) {
+  const MotionTrack* track = r.track;
+  r.segment = segment;
+
+  for(uint8_t m = 0; m < track->motorCount; m++) {
+    int32_t pa = trackValue(track, segment - 1, m);
+    int32_t p0 = trackValue(track, segment, m);
+    int32_t p1 = trackValue(track, segment + 1, m);
+    int32_t pb = trackValue(track, segment + 2, m);
+
+    r.p0[m] = p0;
+    r.d[m] = p1 - p0;
+
+    if(r.mode == RESAMPLE_HERMITE) {
+      r.m0[m] = (p1 - pa) / 2;
+      r.m1[m] = (pb - p0) / 2;
+    } else if(r.mode == RESAMPLE_MONOTONE) {
+      r.m0[m] = monotoneTangent(p0 - pa, p1 - p0);
+      r.m1[m] = monotoneTangent(p1 - p0, pb - p1);
+    } else {
+      r.m0[m] = 0;
+      r.m1[m] = 0;
+    }
+  }
+}
+
+#if defined(RESAMPLE_SIMD)
+//================= SSE4.1 경로 =================
+static bool simdEnabled = true;
+
+// 모터 4개를 한 번에: p0 + ((w1*d + w2*m0 + w3*m1 + round) >> 12), 처리한 모터 수 반환
+SSE41_TARGET static uint8_t resampleLanesSse41(const MotionResampler& r, uint8_t count,
+                                               int32_t w1, int32_t w2, int32_t w3, int32_t* out) {
+  __m128i vw1 = _mm_set1_epi32(w1);
+  __m128i vw2 = _mm_set1_epi32(w2);
+  __m128i vw3 = _mm_set1_epi32(w3);
+  __m128i vround = _mm_set1_epi32(1 << (RESAMPLE_WEIGHT_BITS - 1));
+  uint8_t m = 0;
+  for(; m + 4 <= count; m += 4) {
+    __m128i acc = _mm_mullo_epi32(vw1, _mm_loadu_si128((const __m128i*)&r.d[m]));
+    acc = _mm_add_epi32(acc, _mm_mullo_epi32(vw2, _mm_loadu_si128((const __m128i*)&r.m0[m])));
+    acc = _mm_add_epi32(acc, _mm_mullo_epi32(vw3, _mm_loadu_si128((const __m128i*)&r.m1[m])));
+    acc = _mm_srai_epi32(_mm_add_epi32(acc, vround), RESAMPLE_WEIGHT_BITS);
+    acc = _mm_add_epi32(acc, _mm_loadu_si128((const __m128i*)&r.p0[m]));
+    _mm_storeu_si128((__m128i*)&out[m], acc);
+  }
+  return m;
+}
+
+bool resampleSimdSupported() {
+  static int supported = -1;
+  if(supported < 0) supported = __builtin_cpu_supports("sse4.1") ? 1 : 0;
+  return supported == 1;
+}
+
+void resampleSetSimd(bool enabled) {
+  simdEnabled = enabled;
+}
+#endif
+
+//================= 리샘플러 함수 =================
+void initResampler(MotionResampler& r, const MotionTrack* track, uint8_t mode) {
+  memset(&r, 0, sizeof(r));
+  r.track = track;
+  r.mode = mode;
+  r.segment = -1;
+}
+
+// 마지막 프레임까지의 재생 시간
+uint32_t resampleDurationUs(const MotionTrack* track) {
+  if(track->frameCount == 0) return 0;
+  return (uint32_t)(track->frameCount - 1) * track->frameIntervalUs;
+}
+
+// timeUs 시점의 모든 모터 위치 계산
+void resampleAt(MotionResampler& r, uint32_t timeUs, int32_t* out) {
+  const MotionTrack* track = r.track;
+  uint32_t interval = track->frameIntervalUs;
+  int32_t segment = timeUs / interval;
+
+  // 마지막 프레임 이후는 끝 위치 유지
+  if(segment >= (int32_t)track->frameCount - 1) {
+    for(uint8_t m = 0; m < track->motorCount; m++) {
+      out[m] = trackValue(track, track->frameCount - 1, m);
+    }
+    return;
+  }
+
+  if(segment != r.segment) {
+    loadSegment(r, segment);
+  }
+
+  // 구간 내 위치 t (Q12, 0 ~ 4095)
+  int32_t t = ((timeUs - (uint32_t)segment * interval) << RESAMPLE_WEIGHT_BITS) / interval;
+
+  // 에르미트 기저 (Q12): h01 = 3t²-2t³, h10 = t³-2t²+t, h11 = t³-t²
+  int32_t w1, w2, w3;
+  if(r.mode == RESAMPLE_LINEAR) {
+    w1 = t;
+    w2 = 0;
+    w3 = 0;
+  } else {
+    int32_t t2 = (t * t) >> RESAMPLE_WEIGHT_BITS;
+    int32_t t3 = (t2 * t) >> RESAMPLE_WEIGHT_BITS;
+    w1 = 3 * t2 - 2 * t3;
+    w2 = t3 - 2 * t2 + t;
+    w3 = t3 - t2;
+  }
+
+  const int32_t round = 1 << (RESAMPLE_WEIGHT_BITS - 1);
+  uint8_t m = 0;
+
+#if defined(RESAMPLE_SIMD)
+  if(simdEnabled && resampleSimdSupported()) {
+    m = resampleLanesSse41(r, track->motorCount, w1, w2, w3, out);
+  }
+#endif
+
+  // 나머지 모터 (AVR은 전부): SSE4.1 경로와 같은 32비트 연산
+  for(; m < track->motorCount; m++) {
+    int32_t acc = w1 * r.d[m] + w2 * r.m0[m] + w3 * r.m1[m];
+    out[m] = r.p0[m] + ((acc + round) >> RESAMPLE_WEIGHT_BITS);
+  }
+}
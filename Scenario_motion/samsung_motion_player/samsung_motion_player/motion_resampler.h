@@ -0,0 +1,47 @@
+// motion_resampler.h - 모션 트랙 리샘플러 헤더 (24fps → 임의 제어 주기)
+
+#ifndef MOTION_RESAMPLER_H
+#define MOTION_RESAMPLER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "motion_player.h"
+
+// ===== 보간 모드 =====
+enum ResampleMode {
+  RESAMPLE_LINEAR = 0,     // 선형 보간
+  RESAMPLE_HERMITE,        // 큐빅 에르미트 (캣멀-롬 접선)
+  RESAMPLE_MONOTONE        // 단조 스플라인 (오버슈트 없음)
+};
+
+// 보간 가중치 고정소수점 자릿수 (Q12)
+#define RESAMPLE_WEIGHT_BITS 12
+
+// 모터 배열 길이 (벡터 연산을 위해 4의 배수로 맞춤)
+#define RESAMPLE_LANES ((DXL_MAX_MOTORS + 3) & ~3)
+
+// ===== 리샘플러 상태 =====
+// 구간(프레임 k → k+1)이 바뀔 때만 접선을 계산하고
+// 틱마다 가중치를 한 번 구한 뒤 모든 모터에 같은 가중치를 적용
+struct MotionResampler {
+  const MotionTrack* track;
+  uint8_t mode;
+  int32_t segment;                  // 현재 구간 시작 프레임 (-1 = 없음)
+  int32_t p0[RESAMPLE_LANES];       // 구간 시작 위치
+  int32_t d[RESAMPLE_LANES];        // 구간 변화량 (p1 - p0)
+  int32_t m0[RESAMPLE_LANES];       // 시작 접선 (프레임당 단위)
+  int32_t m1[RESAMPLE_LANES];       // 끝 접선
+};
+
+// ===== 리샘플러 함수 =====
+void initResampler(MotionResampler& r, const MotionTrack* track, uint8_t mode);
+void resampleAt(MotionResampler& r, uint32_t timeUs, int32_t* out);
+uint32_t resampleDurationUs(const MotionTrack* track);
+
+#if defined(__x86_64__) || defined(__i386__)
+// 호스트 전용: SSE4.1 경로 (실행 시 CPU 확인), resampleSetSimd(false)면 스칼라만 사용 (비교용)
+bool resampleSimdSupported();
+void resampleSetSimd(bool enabled);
+#endif
+
+#endif
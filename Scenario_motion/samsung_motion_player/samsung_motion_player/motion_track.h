@@ -0,0 +1,672 @@
+// motion_track.h - PROGMEM 모션 트랙 (track_export로 생성, 직접 수정 금지)
+// 원본: 0827_breathing_1.json (24.0 fps, profiles, 575 프레임, 모터 1개)
+
+#ifndef MOTION_TRACK_H
+#define MOTION_TRACK_H
+
+#include "motion_player.h"
+
+#define MOTION_TRACK_MOTORS 1
+#define MOTION_TRACK_FRAMES 575
+
+const uint8_t motionTrackIds[MOTION_TRACK_MOTORS] PROGMEM = {1};
+
+const int32_t motionTrackOffsets[MOTION_TRACK_FRAMES * MOTION_TRACK_MOTORS] PROGMEM = {
+  0, 0, 0, -1, -2, -3, -4, -6,
+  -7, -9, -11, -14, -16, -19, -22, -25,
+  -28, -32, -35, -39, -42, -46, -50, -54,
+  -58, -63, -67, -72, -76, -81, -85, -90,
+  -94, -99, -104, -109, -113, -118, -123, -127,
+  -132, -137, -141, -146, -151, -155, -159, -164,
+  -168, -172, -176, -180, -184, -188, -191, -195,
+  -198, -202, -205, -207, -210, -213, -215, -217,
+  -219, -221, -223, -224, -225, -226, -227, -227,
+  -227, -227, -226, -225, -223, -221, -219, -216,
+  -214, -211, -207, -204, -201, -197, -193, -189,
+  -185, -181, -177, -173, -169, -165, -160, -156,
+  -151, -147, -142, -138, -133, -129, -124, -120,
+  -116, -111, -107, -102, -98, -93, -89, -85,
+  -81, -76, -72, -68, -64, -60, -57, -53,
+  -49, -45, -42, -38, -35, -32, -29, -26,
+  -23, -20, -18, -15, -13, -11, -9, -7,
+  -5, -4, -3, -1, -1, 0, 0, 0,
+  0, -1, -2, -3, -5, -8, -10, -13,
+  -16, -19, -22, -25, -29, -33, -36, -40,
+  -44, -48, -52, -57, -61, -65, -69, -74,
+  -78, -82, -87, -91, -96, -100, -104, -109,
+  -113, -118, -122, -126, -131, -135, -139, -143,
+  -147, -151, -155, -159, -163, -167, -171, -175,
+  -178, -182, -185, -189, -192, -195, -198, -201,
+  -204, -207, -209, -212, -214, -216, -218, -220,
+  -221, -223, -224, -225, -226, -227, -227, -227,
+  -227, -226, -225, -223, -221, -219, -217, -214,
+  -211, -208, -204, -201, -198, -194, -190, -186,
+  -182, -178, -174, -170, -166, -161, -157, -153,
+  -148, -144, -140, -135, -131, -126, -122, -118,
+  -113, -109, -105, -100, -96, -92, -87, -83,
+  -79, -75, -71, -67, -63, -59, -56, -52,
+  -48, -45, -41, -38, -35, -31, -28, -26,
+  -23, -20, -17, -15, -13, -11, -9, -7,
+  -5, -4, -3, -1, -1, 0, 0, 0,
+  0, 0, -1, -2, -3, -4, -6, -7,
+  -9, -11, -14, -16, -19, -22, -25, -28,
+  -32, -35, -39, -42, -46, -50, -54, -58,
+  -63, -67, -72, -76, -81, -85, -90, -94,
+  -99, -104, -109, -113, -118, -123, -127, -132,
+  -137, -141, -146, -151, -155, -159, -164, -168,
+  -172, -176, -180, -184, -188, -191, -195, -198,
+  -202, -205, -207, -210, -213, -215, -217, -219,
+  -221, -223, -224, -225, -226, -227, -227, -227,
+  -227, -226, -225, -223, -221, -219, -216, -214,
+  -211, -207, -204, -201, -197, -193, -189, -185,
+  -181, -177, -173, -169, -165, -160, -156, -151,
+  -147, -142, -138, -133, -129, -124, -120, -116,
+  -111, -107, -102, -98, -93, -89, -85, -81,
+  -76, -72, -68, -64, -60, -57, -53, -49,
+  -45, -42, -38, -35, -32, -29, -26, -23,
+  -20, -18, -15, -13, -11, -9, -7, -5,
+  -4, -3, -1, -1, 0, 0, 0, 0,
+  -1, -2, -3, -5, -8, -10, -13, -16,
+  -19, -22, -25, -29, -33, -36, -40, -44,
+  -48, -52, -57, -61, -65, -69, -74, -78,
+  -82, -87, -91, -96, -100, -104, -109, -113,
+  -118, -122, -126, -131, -135, -139, -143, -147,
+  -151, -155, -159, -163, -167, -171, -175, -178,
+  -182, -185, -189, -192, -195, -198, -201, -204,
+  -207, -209, -212, -214, -216, -218, -220, -221,
+  -223, -224, -225, -226, -227, -227, -227, -227,
+  -226, -225, -223, -221, -219, -217, -214, -211,
+  -208, -204, -201, -198, -194, -190, -186, -182,
+  -178, -174, -170, -166, -161, -157, -153, -148,
+  -144, -140, -135, -131, -126, -122, -118, -113,
+  -109, -105, -100, -96, -92, -87, -83, -79,
+  -75, -71, -67, -63, -59, -56, -52, -48,
+  -45, -41, -38, -35, -31, -28, -26, -23,
+  -20, -17, -15, -13, -11, -9, -7, -5,
+  -4, -3, -1, -1, 0, 0, 0,
+};
+
+const uint16_t motionTrackProfiles[MOTION_TRACK_FRAMES * MOTION_TRACK_MOTORS * 2] PROGMEM = {
+  1, 1,
+  1, 1,
+  17, 2,
+  14, 2,
+  14, 2,
+  14, 2,
+  29, 4,
+  15, 2,
+  29, 4,
+  27, 4,
+  41, 6,
+  27, 4,
+  41, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  55, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  55, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  67, 9,
+  67, 9,
+  54, 7,
+  68, 9,
+  67, 9,
+  54, 7,
+  68, 9,
+  67, 9,
+  54, 7,
+  68, 9,
+  67, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  27, 4,
+  41, 6,
+  40, 6,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  15, 2,
+  14, 2,
+  14, 2,
+  14, 2,
+  12, 2,
+  1, 1,
+  1, 1,
+  17, 2,
+  14, 2,
+  29, 4,
+  27, 4,
+  27, 4,
+  41, 6,
+  27, 4,
+  41, 6,
+  55, 7,
+  41, 6,
+  40, 6,
+  55, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  54, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  27, 4,
+  41, 6,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  15, 2,
+  14, 2,
+  29, 4,
+  24, 4,
+  17, 2,
+  12, 2,
+  1, 1,
+  1, 1,
+  17, 2,
+  14, 2,
+  14, 2,
+  29, 4,
+  41, 6,
+  27, 4,
+  41, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  55, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  27, 4,
+  41, 6,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  15, 2,
+  29, 4,
+  15, 2,
+  14, 2,
+  14, 2,
+  14, 2,
+  12, 2,
+  1, 1,
+  1, 1,
+  17, 2,
+  14, 2,
+  29, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  41, 6,
+  40, 6,
+  40, 6,
+  55, 7,
+  41, 6,
+  40, 6,
+  55, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  40, 6,
+  55, 7,
+  41, 6,
+  27, 4,
+  41, 6,
+  40, 6,
+  40, 6,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  15, 2,
+  14, 2,
+  29, 4,
+  24, 4,
+  17, 2,
+  12, 2,
+  1, 1,
+  1, 1,
+  1, 1,
+  17, 2,
+  14, 2,
+  14, 2,
+  14, 2,
+  29, 4,
+  15, 2,
+  29, 4,
+  27, 4,
+  41, 6,
+  27, 4,
+  41, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  55, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  55, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  67, 9,
+  67, 9,
+  54, 7,
+  68, 9,
+  67, 9,
+  54, 7,
+  68, 9,
+  67, 9,
+  54, 7,
+  68, 9,
+  67, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  27, 4,
+  41, 6,
+  40, 6,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  15, 2,
+  14, 2,
+  14, 2,
+  14, 2,
+  12, 2,
+  1, 1,
+  1, 1,
+  17, 2,
+  14, 2,
+  29, 4,
+  27, 4,
+  27, 4,
+  41, 6,
+  27, 4,
+  41, 6,
+  55, 7,
+  41, 6,
+  40, 6,
+  55, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  54, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  27, 4,
+  41, 6,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  15, 2,
+  14, 2,
+  29, 4,
+  24, 4,
+  17, 2,
+  12, 2,
+  1, 1,
+  1, 1,
+  17, 2,
+  14, 2,
+  14, 2,
+  29, 4,
+  41, 6,
+  27, 4,
+  41, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  55, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  40, 6,
+  27, 4,
+  41, 6,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  15, 2,
+  29, 4,
+  15, 2,
+  14, 2,
+  14, 2,
+  14, 2,
+  12, 2,
+  1, 1,
+  1, 1,
+  17, 2,
+  14, 2,
+  29, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  41, 6,
+  40, 6,
+  40, 6,
+  55, 7,
+  41, 6,
+  40, 6,
+  55, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  68, 9,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  54, 7,
+  41, 6,
+  55, 7,
+  41, 6,
+  40, 6,
+  55, 7,
+  41, 6,
+  27, 4,
+  41, 6,
+  40, 6,
+  40, 6,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  27, 4,
+  15, 2,
+  14, 2,
+  29, 4,
+  24, 4,
+  17, 2,
+  12, 2,
+  1, 1,
+  1, 1,
+};
+
+const MotionTrack motionTrack = {
+  MOTION_TRACK_MOTORS, MOTION_TRACK_FRAMES, 41667UL,
+  motionTrackIds, motionTrackOffsets, motionTrackProfiles
+};
+
+#endif
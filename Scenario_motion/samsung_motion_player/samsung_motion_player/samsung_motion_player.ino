@@ -0,0 +1,132 @@
+// samsung_motion_player.ino - 다이나믹셀 모션 재생 (PC 없이 MCU 단독 실행)
+// motion_track.h의 PROGMEM 트랙을 프레임 시간에 맞춰 싱크 라이트(주소 116, 프로파일 트랙은 108~119)로 전송
+
+#include "dxl_protocol.h"
+#include "motion_player.h"
+#include "motion_resampler.h"
+#if DXL_READ_EVERY > 0
+#include "dxl_pipeline.h"
+#endif
+#ifdef MOTION_USE_KEYFRAMES
+#include "motion_keyframes_track.h"
+#else
+#include "motion_track.h"
+#endif
+
+// 반이중 TTL 버스로 패킷 전송 (전송 완료 후 수신 방향으로 전환)
+void dxlSerialWrite(const uint8_t* data, uint16_t length) {
+  digitalWrite(DXL_DIR_PIN, HIGH);
+  DXL_SERIAL.write(data, length);
+  DXL_SERIAL.flush();
+  digitalWrite(DXL_DIR_PIN, LOW);
+}
+
+#if DXL_READ_EVERY > 0
+// 수신 버퍼에서 바이트 하나 (없으면 -1)
+int dxlSerialRead() {
+  return DXL_SERIAL.read();
+}
+
+// 트랙의 모터 ID를 RAM으로 복사해 위치 읽기 파이프라인 시작
+void beginPositionReads(const uint8_t* motorIds, uint8_t motorCount) {
+  uint8_t ids[DXL_MAX_MOTORS];
+  if (motorCount > DXL_MAX_MOTORS) motorCount = DXL_MAX_MOTORS;
+  for (uint8_t i = 0; i < motorCount; i++) {
+    ids[i] = pgm_read_byte(&motorIds[i]);
+  }
+  dxlPipelineBegin(ids, motorCount, dxlSerialWrite, dxlSerialRead, DXL_READ_EVERY, DXL_FAST_SYNC_READ);
+}
+#endif
+
+void setup() {
+#ifdef DEBUG_MODE
+  Serial.begin(DEBUG_BAUDRATE);
+#endif
+
+  // 다이나믹셀 버스 초기화
+  pinMode(DXL_DIR_PIN, OUTPUT);
+  digitalWrite(DXL_DIR_PIN, LOW);
+  DXL_SERIAL.begin(DXL_BAUDRATE);
+  dxlBegin(dxlSerialWrite);
+
+  // 트랙 로드 및 모터 설정 (확장 위치 모드, 최고 속도)
+  // 기준 위치는 0 (setMotionBasePosition으로 변경 가능)
+#ifdef MOTION_USE_KEYFRAMES
+  initMotionPlayerKeyframes(&motionKeyframes);
+#else
+  initMotionPlayer(&motionTrack);
+#endif
+  setupMotionMotors(DXL_PROFILE_VELOCITY);
+  setMotionControlRate(MOTION_CONTROL_RATE_HZ, MOTION_RESAMPLE_MODE);
+  delay(100);
+
+  // 설정 명령은 직접 보낸 뒤, 재생 중 싱크 라이트만 파이프라인을 거치게 전환
+#if DXL_READ_EVERY > 0
+#ifdef MOTION_USE_KEYFRAMES
+  beginPositionReads(motionKeyframes.motorIds, motionKeyframes.motorCount);
+#else
+  beginPositionReads(motionTrack.motorIds, motionTrack.motorCount);
+#endif
+  dxlBegin(dxlPipelineWrite);
+#endif
+
+  startMotionPlayback();
+}
+
+void loop() {
+#if DXL_READ_EVERY > 0
+  // 위치 응답 수신 + 미룬 싱크 라이트 전송 (블로킹 없음)
+  dxlPipelinePoll();
+#endif
+
+  if (updateMotionPlayback()) {
+    // 프레임별 패킷 생성 시간 / 버스 점유율 출력
+    const MotionFrameStats& stats = getMotionFrameStats();
+    DEBUG_PRINT("F");
+    DEBUG_PRINT(stats.frame);
+    DEBUG_PRINT(" build=");
+    DEBUG_PRINT(stats.buildUs);
+    DEBUG_PRINT("us wire=");
+    DEBUG_PRINT(stats.wireUs);
+    DEBUG_PRINT("us load=");
+    DEBUG_PRINT(stats.busLoadPermille);
+    DEBUG_PRINTLN("permille");
+  }
+}
+
+/*
+=== 동작 ===
+- 24fps 트랙 (프레임 간격 41667us), 제어 틱마다 싱크 라이트 패킷 1개
+- MOTION_CONTROL_RATE_HZ > 0 이면 구간 계수를 프레임당 한 번 계산하고 틱마다 Q12 가중치로 보간
+- 미리 보간한 트랙이 필요하면 track_export --rate 로 베이크 (이때 MOTION_CONTROL_RATE_HZ = 0)
+- 루프가 늦으면 밀린 프레임은 건너뛰고 skippedFrames에 누적
+- 패킷은 정적 버퍼에 PROGMEM에서 바로 생성 (동적 할당 없음)
+
+=== 트랙 교체 ===
+host/motion/track_export로 모션 JSON을 motion_track.h로 변환
+
+=== 구간 프로파일 (track_export --profiles) ===
+- 기본은 setupMotionMotors로 프로파일 속도를 한 번만 설정 → 매 목표를 최고 속도로 쫓아가서 멈췄다 가는 움직임
+- 프로파일 트랙은 구간마다 오프라인으로 계산한 프로파일 가속도/속도를 목표와 함께 한 패킷으로 전송
+  (주소 108 가속도, 112 속도, 116 목표가 연속이라 모터당 12바이트, 패킷 수는 그대로)
+- 목표는 한 프레임(제어 주기 사용시 한 틱) 앞 위치라서 서보가 프레임 간격 동안 구간을 따라감
+- --vlimit은 서보의 Velocity Limit(44) 이하로 (넘는 프로파일 속도는 서보가 쓰기를 거부)
+- 효과는 host/motion/dxl_host_player --profiles로 확인 (추종 오차, 서보 가속도)
+
+=== 키프레임 트랙 ===
+host/motion/track_decimate로 허용 오차 안의 최소 키프레임만 남긴 트랙 생성 (플래시 절약)
+모터별 커서로 틱당 O(1) 복원, 모든 모터가 정지 구간이면 싱크 라이트 전송 생략
+
+=== 리타이밍 ===
+host/motion/track_retime으로 서보 속도/가속도 한계를 넘는 구간만 늘린 트랙 생성
+--csv로 작성 프레임별 재생 시각 표를 출력, LED 타임라인 큐는 이 표를 보고 옮김 (펌웨어는 변환하지 않음)
+
+=== 위치 읽기 (DXL_READ_EVERY > 0) ===
+- k번째 싱크 라이트 바로 뒤에 (Fast) Sync Read 요청, 응답은 다음 프레임 계산과 겹쳐서 수신
+- 결과는 dxlPipelinePosition(index, &position, &readUs), 통계는 dxlPipelineStats()
+- Fast Sync Read는 펌웨어 v45 이상 X 시리즈 필요 (아니면 DXL_FAST_SYNC_READ 0)
+- 버스 여유는 host/motion/pipeline_bench로 서보 수 / 제어 주기별 확인
+
+=== LED와 함께 사용 ===
+updateMotionPlayback()은 블로킹하지 않으므로 LED 효과 update 함수와 같은 loop()에서 호출 가능
+*/
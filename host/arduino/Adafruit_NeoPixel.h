@@ -0,0 +1,209 @@
+// Adafruit_NeoPixel.h - 호스트(리눅스) 빌드용 NeoPixel 시뮬레이션 스트립
+// 실제 라이브러리와 같은 밝기 스케일링 (setPixelColor에서 스케일, getPixelColor에서 역스케일)
+// show()는 전송 시간만큼 가상 시계를 진행하고 스레드별 훅으로 프레임을 넘김
+// beginShow()는 DMA 출력처럼 전송을 시작만 하고 반환 (전송 중에도 다음 프레임 계산 가능)
+// NEO_HOST_AVR_TIMING: AVR 라이브러리처럼 비동기 출력 없음 + show() 동안 인터럽트가 꺼진 것처럼
+//   micros()는 타이머0 오버플로 한 번(1024us)까지만 진행하고 나머지는 hostStalledUs로 (실제 시각만 진행)
+// NEO_HOST_COMPOSITE: fill() / 밝기 낮춤 / overlayColor()를 host/composite 커널(compositeBest())로 처리
+//   (렌더 데몬의 다중 패널용, composite_*.cpp 링크 필요), 결과는 픽셀 루프와 비트 단위로 같음
+
+#ifndef ADAFRUIT_NEOPIXEL_HOST_H
+#define ADAFRUIT_NEOPIXEL_HOST_H
+
+#include <Arduino.h>
+
+#ifdef NEO_HOST_COMPOSITE
+#include "../composite/composite.h"
+#define NEO_OVERLAY_COLOR   // overlayColor() 지원 (스케치는 이 매크로가 없으면 픽셀 루프)
+#endif
+
+typedef uint16_t neoPixelType;
+
+// 색상 순서 / 속도 (값은 실제 라이브러리와 동일, 호스트는 GRB만 사용)
+#define NEO_RGB     ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRB     ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_KHZ800  0x0000
+#define NEO_KHZ400  0x0100
+
+// WS2812B 전송 시간: 비트당 1.25us + 래치 300us
+#define NEO_HOST_BIT_NS    1250
+#define NEO_HOST_LATCH_US  300
+
+// beginShow()/isBusy() 지원 (스케치는 이 매크로가 없으면 블로킹 show()로 대체)
+#ifndef NEO_HOST_AVR_TIMING
+#define NEO_ASYNC_SHOW
+#endif
+
+// AVR 타이밍 모드에서 show() 동안 micros()가 세는 최대 시간 (대기 중인 오버플로 인터럽트 하나)
+#define NEO_HOST_AVR_COUNTED_US  1024
+
+class Adafruit_NeoPixel;
+
+// show() 훅 (프리뷰/시뮬레이션이 스레드별로 설정)
+typedef void (*HostShowHook)(const Adafruit_NeoPixel& strip, uint64_t timeUs, void* context);
+inline thread_local HostShowHook hostShowHook = 0;
+inline thread_local void* hostShowContext = 0;
+
+class Adafruit_NeoPixel {
+ public:
+  Adafruit_NeoPixel(uint16_t n, int16_t pin = 6, neoPixelType type = NEO_GRB + NEO_KHZ800)
+    : numLEDs(n), numBytes(n * 3), brightness(0), pixels(new uint8_t[n * 3]), busyUntilUs(0) {
+    (void)pin;
+    (void)type;
+    memset(pixels, 0, numBytes);
+  }
+  ~Adafruit_NeoPixel() { delete[] pixels; }
+
+  void begin() {}
+
+  // 전송 시간만큼 시계 진행 후 훅 호출 (훅은 전송 시작의 실제 시각을 받음)
+  void show() {
+    waitShow();
+    uint64_t startUs = hostRealMicros();
+#ifdef NEO_HOST_AVR_TIMING
+    uint32_t counted = std::min<uint32_t>(wireTimeUs(), NEO_HOST_AVR_COUNTED_US);
+    hostClockUs += counted;
+    hostStalledUs += wireTimeUs() - counted;
+#else
+    hostClockUs += wireTimeUs();
+#endif
+    if(hostShowHook) hostShowHook(*this, startUs, hostShowContext);
+  }
+
+  // 이전 전송이 끝날 때까지 시계를 진행한 뒤 현재 버퍼로 전송 시작 (시계는 그대로)
+  // 훅이 시작 시점 버퍼를 복사하므로 반환 후 그리기 버퍼를 고쳐도 전송 중인 프레임은 그대로
+  void beginShow() {
+    waitShow();
+    busyUntilUs = hostClockUs + wireTimeUs();
+    if(hostShowHook) hostShowHook(*this, hostClockUs, hostShowContext);
+  }
+
+  bool isBusy() const { return hostClockUs < busyUntilUs && busyUntilUs - hostClockUs <= wireTimeUs(); }
+
+  void waitShow() {
+    if(isBusy()) hostClockUs = busyUntilUs;
+  }
+
+  uint32_t wireTimeUs() const {
+    return (uint32_t)((uint64_t)numBytes * 8 * NEO_HOST_BIT_NS / 1000) + NEO_HOST_LATCH_US;
+  }
+
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    if(n >= numLEDs) return;
+    if(brightness) {
+      r = (r * brightness) >> 8;
+      g = (g * brightness) >> 8;
+      b = (b * brightness) >> 8;
+    }
+    uint8_t* p = &pixels[n * 3];
+    p[0] = g;
+    p[1] = r;
+    p[2] = b;
+  }
+
+  void setPixelColor(uint16_t n, uint32_t c) {
+    setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+  }
+
+  void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0) {
+    uint16_t end = (count == 0 || first + count > numLEDs) ? numLEDs : first + count;
+#ifdef NEO_HOST_COMPOSITE
+    if(first >= end) return;
+    uint8_t grb[3] = { scaled((uint8_t)(c >> 8)), scaled((uint8_t)(c >> 16)), scaled((uint8_t)c) };
+    compositeBest().fill(&pixels[first * 3], end - first, grb);
+#else
+    for(uint16_t i = first; i < end; i++) setPixelColor(i, c);
+#endif
+  }
+
+#ifdef NEO_HOST_COMPOSITE
+  // 전체 픽셀에 overlayColorAlpha와 같은 식 (out = old + (int)((target - old) * alpha))
+  // 밝기 스케일이 있으면 getPixelColor/setPixelColor처럼 역스케일 → 합성 → 재스케일 (바이트 표 두 개,
+  // setPixelColor로 쓴 값은 항상 밝기보다 작아 역스케일이 한 바이트에 들어감)
+  void overlayColor(uint8_t r, uint8_t g, uint8_t b, float alpha) {
+    const CompositeKernels& k = compositeBest();
+    uint8_t grb[3] = { g, r, b };
+    if(brightness) {
+      if(lutBrightness != brightness) {
+        for(int v = 0; v < 256; v++) {
+          descaleLut[v] = (uint8_t)((v << 8) / brightness);
+          rescaleLut[v] = (uint8_t)((v * brightness) >> 8);
+        }
+        lutBrightness = brightness;
+      }
+      k.gamma(pixels, numLEDs, descaleLut);
+      k.overColor(pixels, numLEDs, grb, alpha);
+      k.gamma(pixels, numLEDs, rescaleLut);
+    } else {
+      k.overColor(pixels, numLEDs, grb, alpha);
+    }
+  }
+#endif
+
+  void setBrightness(uint8_t b) {
+    uint8_t newBrightness = b + 1;
+    if(newBrightness != brightness) {
+      uint8_t oldBrightness = brightness - 1;
+      uint16_t scale;
+      if(oldBrightness == 0) scale = 0;
+      else if(b == 255) scale = 65535 / oldBrightness;
+      else scale = (((uint16_t)newBrightness << 8) - 1) / oldBrightness;
+      rescale(scale);
+      brightness = newBrightness;
+    }
+  }
+
+  void clear() { memset(pixels, 0, numBytes); }
+  bool canShow() const { return !isBusy(); }
+
+  uint8_t getBrightness() const { return brightness - 1; }
+  uint8_t* getPixels() const { return pixels; }
+  uint16_t numPixels() const { return numLEDs; }
+
+  uint32_t getPixelColor(uint16_t n) const {
+    if(n >= numLEDs) return 0;
+    const uint8_t* p = &pixels[n * 3];
+    if(brightness) {
+      return (((uint32_t)(p[1] << 8) / brightness) << 16) |
+             (((uint32_t)(p[0] << 8) / brightness) << 8) |
+             ((uint32_t)(p[2] << 8) / brightness);
+    }
+    return ((uint32_t)p[1] << 16) | ((uint32_t)p[0] << 8) | p[2];
+  }
+
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+ private:
+  Adafruit_NeoPixel(const Adafruit_NeoPixel&);
+  Adafruit_NeoPixel& operator=(const Adafruit_NeoPixel&);
+
+  uint8_t scaled(uint8_t v) const { return brightness ? (uint8_t)((v * brightness) >> 8) : v; }
+
+  // 저장된 전송 값 전체에 (값 * scale) >> 8
+  void rescale(uint16_t scale) {
+#ifdef NEO_HOST_COMPOSITE
+    if(scale <= 256) {   // 밝기 낮춤: fade 커널 (16비트 곱셈 범위)
+      compositeBest().fade(pixels, numLEDs, scale);
+      return;
+    }
+#endif
+    for(uint16_t i = 0; i < numBytes; i++) {
+      pixels[i] = (pixels[i] * scale) >> 8;
+    }
+  }
+
+  uint16_t numLEDs;
+  uint16_t numBytes;
+  uint8_t brightness;
+  uint8_t* pixels;    // GRB 순서, 밝기 스케일 적용된 전송 값
+  uint64_t busyUntilUs;   // beginShow() 전송 끝 시각 (시계가 되돌려지면 isBusy()가 무시)
+#ifdef NEO_HOST_COMPOSITE
+  uint8_t lutBrightness = 0;   // 아래 표를 만든 밝기 (0 = 없음)
+  uint8_t descaleLut[256];
+  uint8_t rescaleLut[256];
+#endif
+};
+
+#endif // ADAFRUIT_NEOPIXEL_HOST_H
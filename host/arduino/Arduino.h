@@ -0,0 +1,179 @@
+// Arduino.h - 호스트(리눅스) 빌드용 아두이노 API 대체 헤더
+// 스케치 소스를 그대로 컴파일하기 위한 최소 구현
+// 시간은 가상 시계로 동작하므로 delay()는 실제로 기다리지 않음 (스레드별 독립)
+// NEO_HOST_AVR_TIMING: AVR처럼 블로킹 show() 동안 micros()가 멈춤 (Adafruit_NeoPixel.h, 실제 시각은 hostRealMicros())
+
+#ifndef ARDUINO_HOST_H
+#define ARDUINO_HOST_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ================= PROGMEM (호스트에서는 일반 메모리) =================
+#define PROGMEM
+#define pgm_read_byte(addr)   (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)   (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr)  (*(const uint32_t*)(addr))
+#define memcpy_P(dest, src, n) memcpy((dest), (src), (n))
+
+// ================= 기본 상수/매크로 =================
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::min;
+using std::max;
+
+// ================= 가상 시계 =================
+// hostClockUs = micros()가 보는 시각, hostStalledUs = micros()가 놓친 시간 (AVR 타이밍 모드의 show() 중)
+inline thread_local uint64_t hostClockUs = 0;
+inline thread_local uint64_t hostStalledUs = 0;
+
+inline uint64_t hostRealMicros() { return hostClockUs + hostStalledUs; }
+
+inline unsigned long micros() { return (unsigned long)hostClockUs; }
+inline unsigned long millis() { return (unsigned long)(hostClockUs / 1000); }
+inline void delay(unsigned long ms) { hostClockUs += (uint64_t)ms * 1000; }
+inline void delayMicroseconds(unsigned int us) { hostClockUs += us; }
+
+// 시뮬레이션에서 시간을 직접 진행/설정
+inline void hostAdvanceMicros(uint64_t us) { hostClockUs += us; }
+inline void hostSetMicros(uint64_t us) {
+  hostClockUs = us;
+  hostStalledUs = 0;
+}
+
+// ================= 난수 (avr-libc random()과 같은 수열) =================
+#define RANDOM_MAX 0x7FFFFFFF
+
+inline thread_local unsigned long hostRandomState = 1;
+
+inline long hostRandom() {
+  long x = (long)hostRandomState;
+  if(x == 0) x = 123459876L;
+  long hi = x / 127773L;
+  long lo = x % 127773L;
+  x = 16807L * lo - 2836L * hi;
+  if(x < 0) x += 0x7FFFFFFFL;
+  hostRandomState = (unsigned long)x;
+  return x % ((unsigned long)RANDOM_MAX + 1);
+}
+
+inline void randomSeed(unsigned long seed) {
+  if(seed != 0) hostRandomState = seed;
+}
+
+inline long random(long howbig) {
+  if(howbig == 0) return 0;
+  return hostRandom() % howbig;
+}
+
+inline long random(long howsmall, long howbig) {
+  if(howsmall >= howbig) return howsmall;
+  return random(howbig - howsmall) + howsmall;
+}
+
+// ================= 아날로그/디지털 입출력 =================
+// analogRead(): hostAnalogSource가 있으면 (핀, 가상 시각)으로 값을 받고, 없으면 고정값 hostAnalogValue
+#define INPUT   0x0
+#define OUTPUT  0x1
+#define LOW     0x0
+#define HIGH    0x1
+
+#define A0  14
+#define A1  15
+#define A2  16
+#define A3  17
+#define A4  18
+#define A5  19
+
+typedef int (*HostAnalogSource)(uint8_t pin, uint64_t timeUs, void* context);
+inline thread_local int hostAnalogValue = 0;
+inline thread_local HostAnalogSource hostAnalogSource = 0;
+inline thread_local void* hostAnalogContext = 0;
+
+inline int analogRead(uint8_t pin) {
+  return hostAnalogSource ? hostAnalogSource(pin, hostRealMicros(), hostAnalogContext) : hostAnalogValue;
+}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+
+// ================= 시리얼 =================
+// 입력: hostSerialRx에 넣은 바이트를 available()/read()로 꺼냄
+//       hostSerialSchedule()로 넣은 바이트는 실제 시각(hostRealMicros)이 그 시각에 닿으면 hostSerialRx로 들어옴
+// 출력: hostSerialTx가 있으면 거기에 모으고, 없으면 hostSerialEcho가 true일 때만 stdout
+inline thread_local std::string hostSerialRx;
+inline thread_local std::string* hostSerialTx = 0;
+inline thread_local bool hostSerialEcho = false;
+inline thread_local std::vector<std::pair<uint64_t, std::string> > hostSerialTimed;   // 시각 순
+
+inline void hostSerialSchedule(uint64_t atUs, const std::string& bytes) {
+  size_t i = hostSerialTimed.size();
+  while(i > 0 && hostSerialTimed[i - 1].first > atUs) i--;
+  hostSerialTimed.insert(hostSerialTimed.begin() + i, std::make_pair(atUs, bytes));
+}
+
+inline void hostSerialDeliver() {
+  size_t due = 0;
+  while(due < hostSerialTimed.size() && hostSerialTimed[due].first <= hostRealMicros()) {
+    hostSerialRx += hostSerialTimed[due].second;
+    due++;
+  }
+  hostSerialTimed.erase(hostSerialTimed.begin(), hostSerialTimed.begin() + due);
+}
+
+class HostSerial {
+ public:
+  void begin(unsigned long) {}
+  void flush() { if(!hostSerialTx && hostSerialEcho) fflush(stdout); }
+  int available() {
+    hostSerialDeliver();
+    return (int)hostSerialRx.size();
+  }
+  int read() {
+    if(hostSerialRx.empty()) return -1;
+    uint8_t c = (uint8_t)hostSerialRx[0];
+    hostSerialRx.erase(0, 1);
+    return c;
+  }
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t write(const uint8_t* data, size_t length) {
+    if(hostSerialTx) hostSerialTx->append((const char*)data, length);
+    else if(hostSerialEcho) fwrite(data, 1, length, stdout);
+    return length;
+  }
+
+  void print(const char* s) { write((const uint8_t*)s, strlen(s)); }
+  void print(char c) { write((uint8_t)c); }
+  void print(int v) { printFormat("%d", v); }
+  void print(unsigned int v) { printFormat("%u", v); }
+  void print(long v) { printFormat("%ld", v); }
+  void print(unsigned long v) { printFormat("%lu", v); }
+  void print(double v) { printFormat("%.2f", v); }
+
+  template <typename T> void println(T v) { print(v); println(); }
+  void println() { print("\r\n"); }
+
+ private:
+  template <typename T> void printFormat(const char* format, T v) {
+    char text[32];
+    int n = snprintf(text, sizeof(text), format, v);
+    write((const uint8_t*)text, (size_t)n);
+  }
+};
+
+inline HostSerial Serial;
+inline HostSerial Serial1;
+
+#endif // ARDUINO_HOST_H
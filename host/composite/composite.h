@@ -0,0 +1,50 @@
+// composite.h - 호스트 렌더러 합성 커널 (스칼라 기준 + SSE2/AVX2, 실행 시 선택)
+// 버퍼는 스트립과 같은 픽셀당 3바이트(GRB) 연속 배열, 개수는 모두 픽셀 단위
+// 모든 변형은 스칼라 기준과 비트 단위로 같은 결과 (펌웨어/호스트 렌더 결과 호환)
+//
+// 정수 정의 (스칼라 기준):
+//   fill       dst = color
+//   lerp       dst = (a * (256 - t) + b * t) >> 8                 t: 0 ~ 256
+//   overColor  dst = dst + (int)((color - dst) * alpha)             alpha: float (0 이하면 그대로, 1 초과는 1)
+//              펌웨어 overlayColorAlpha와 같은 단정도 곱셈 + 0 방향 버림 (r=200, color=170, alpha=0.3 → 191)
+//   alphaOver  x = src * m + dst * (255 - m) + 128, dst = (x + (x >> 8)) >> 8   m: 픽셀당 알파
+//   add        dst = min(dst + src, 255)
+//   fade       dst = (dst * scale) >> 8                           scale = 밝기 + 1 (라이브러리와 같음)
+//   gamma      dst = lut[dst]
+
+#ifndef COMPOSITE_H
+#define COMPOSITE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum CompositeLevel {
+  COMPOSITE_SCALAR = 0,
+  COMPOSITE_SSE2,
+  COMPOSITE_AVX2,
+  COMPOSITE_LEVEL_COUNT
+};
+
+struct CompositeKernels {
+  CompositeLevel level;
+  const char* name;
+  void (*fill)(uint8_t* dst, size_t pixels, const uint8_t color[3]);
+  void (*lerp)(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t pixels, uint16_t t);
+  void (*overColor)(uint8_t* dst, size_t pixels, const uint8_t color[3], float alpha);
+  void (*alphaOver)(uint8_t* dst, const uint8_t* src, const uint8_t* mask, size_t pixels);
+  void (*add)(uint8_t* dst, const uint8_t* src, size_t pixels);
+  void (*fade)(uint8_t* dst, size_t pixels, uint16_t scale);
+  void (*gamma)(uint8_t* dst, size_t pixels, const uint8_t lut[256]);
+};
+
+// ===== 변형 선택 =====
+bool compositeSupported(CompositeLevel level);         // 이 CPU에서 실행 가능한지
+const CompositeKernels& compositeKernels(CompositeLevel level);   // 지원 안 하면 스칼라
+const CompositeKernels& compositeBest();               // 지원되는 가장 빠른 변형 (COMPOSITE_LEVEL 환경 변수로 낮출 수 있음, 스레드 안전)
+
+// ===== 변형별 테이블 (composite_*.cpp) =====
+extern const CompositeKernels compositeScalarKernels;
+extern const CompositeKernels compositeSse2Kernels;
+extern const CompositeKernels compositeAvx2Kernels;
+
+#endif
@@ -0,0 +1,170 @@
+// composite_avx2.cpp - 합성 커널 AVX2 변형 (32픽셀 = 96바이트 = 벡터 3개 단위, 꼬리는 스칼라)
+// 함수마다 target 속성을 붙여 이 파일만 AVX2로 컴파일 (빌드 옵션 없이 실행 시 선택)
+// 바이트 → 16비트 확장/축소는 128비트 레인 안에서 짝이 맞으므로 순서 그대로 복원됨
+// gamma는 스칼라: pshufb 16칸 표 16개 조합이 셔플 포트에 묶여 표 조회보다 느렸음 (0.8배)
+// overColor는 펌웨어와 같은 float 식: 16바이트씩 32비트 8개 두 묶음으로 넓혀 단정도 곱셈
+
+#include "composite.h"
+#include "composite_internal.h"
+
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__((target("avx2,ssse3")))
+#define AVX2_BLOCK_PIXELS 32
+
+AVX2_TARGET static inline __m256i combine(__m128i lo, __m128i hi) {
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+// 3바이트 색 반복 패턴 (96바이트 = 벡터 3개)
+AVX2_TARGET static void colorPattern(const uint8_t color[3], __m256i pattern[3]) {
+  uint8_t bytes[96];
+  for(int i = 0; i < 96; i++) bytes[i] = color[i % 3];
+  for(int k = 0; k < 3; k++) pattern[k] = _mm256_loadu_si256((const __m256i*)(bytes + k * 32));
+}
+
+// (a * wa + b * wb) >> 8, 바이트 32개
+AVX2_TARGET static inline __m256i weighted(__m256i a, __m256i b, __m256i wa, __m256i wb) {
+  __m256i zero = _mm256_setzero_si256();
+  __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), wa),
+                                _mm256_mullo_epi16(_mm256_unpacklo_epi8(b, zero), wb));
+  __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), wa),
+                                _mm256_mullo_epi16(_mm256_unpackhi_epi8(b, zero), wb));
+  return _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+}
+
+// dst + (int)((color - dst) * alpha), 바이트 16개 (color는 넓혀 둔 32비트 8개 두 묶음)
+AVX2_TARGET static inline __m128i overlayBytes(__m128i v, const __m256i color[2], __m256 alpha) {
+  __m256i lo = _mm256_cvtepu8_epi32(v);
+  __m256i hi = _mm256_cvtepu8_epi32(_mm_srli_si128(v, 8));
+  lo = _mm256_add_epi32(lo, _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(color[0], lo)), alpha)));
+  hi = _mm256_add_epi32(hi, _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(color[1], hi)), alpha)));
+  // packs는 128비트 레인 안에서 묶으므로 64비트 단위로 순서 복원
+  __m256i words = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+  return _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+}
+
+// ================= 커널 =================
+
+AVX2_TARGET static void fillAvx2(uint8_t* dst, size_t pixels, const uint8_t color[3]) {
+  __m256i pattern[3];
+  colorPattern(color, pattern);
+  size_t p = 0;
+  for(; p + AVX2_BLOCK_PIXELS <= pixels; p += AVX2_BLOCK_PIXELS) {
+    uint8_t* d = dst + p * 3;
+    for(int k = 0; k < 3; k++) _mm256_storeu_si256((__m256i*)(d + k * 32), pattern[k]);
+  }
+  compositeFillScalar(dst + p * 3, pixels - p, color);
+}
+
+AVX2_TARGET static void lerpAvx2(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t pixels, uint16_t t) {
+  __m256i wa = _mm256_set1_epi16((short)(256 - t));
+  __m256i wb = _mm256_set1_epi16((short)t);
+  size_t p = 0;
+  for(; p + AVX2_BLOCK_PIXELS <= pixels; p += AVX2_BLOCK_PIXELS) {
+    for(int k = 0; k < 3; k++) {
+      size_t i = p * 3 + k * 32;
+      __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+      __m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+      _mm256_storeu_si256((__m256i*)(dst + i), weighted(va, vb, wa, wb));
+    }
+  }
+  compositeLerpScalar(dst + p * 3, a + p * 3, b + p * 3, pixels - p, t);
+}
+
+AVX2_TARGET static void overColorAvx2(uint8_t* dst, size_t pixels, const uint8_t color[3], float alpha) {
+  if(alpha <= 0.0f) return;
+  if(alpha > 1.0f) alpha = 1.0f;
+  uint8_t bytes[96];
+  for(int i = 0; i < 96; i++) bytes[i] = color[i % 3];
+  __m256i wide[6][2];
+  for(int k = 0; k < 6; k++) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(bytes + k * 16));
+    wide[k][0] = _mm256_cvtepu8_epi32(v);
+    wide[k][1] = _mm256_cvtepu8_epi32(_mm_srli_si128(v, 8));
+  }
+  __m256 va = _mm256_set1_ps(alpha);
+  size_t p = 0;
+  for(; p + AVX2_BLOCK_PIXELS <= pixels; p += AVX2_BLOCK_PIXELS) {
+    for(int k = 0; k < 6; k++) {
+      uint8_t* d = dst + p * 3 + k * 16;
+      __m128i vd = _mm_loadu_si128((const __m128i*)d);
+      _mm_storeu_si128((__m128i*)d, overlayBytes(vd, wide[k], va));
+    }
+  }
+  compositeOverColorScalar(dst + p * 3, pixels - p, color, alpha);
+}
+
+// 픽셀당 알파 16개 → 채널 바이트 48개 (pshufb 3번)
+AVX2_TARGET static inline void expandMask(__m128i m, __m128i out[3]) {
+  const __m128i c0 = _mm_setr_epi8(0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5);
+  const __m128i c1 = _mm_setr_epi8(5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10);
+  const __m128i c2 = _mm_setr_epi8(10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15);
+  out[0] = _mm_shuffle_epi8(m, c0);
+  out[1] = _mm_shuffle_epi8(m, c1);
+  out[2] = _mm_shuffle_epi8(m, c2);
+}
+
+AVX2_TARGET static void alphaOverAvx2(uint8_t* dst, const uint8_t* src, const uint8_t* mask, size_t pixels) {
+  __m256i zero = _mm256_setzero_si256();
+  __m256i full = _mm256_set1_epi16(255);
+  __m256i half = _mm256_set1_epi16(128);
+  size_t p = 0;
+  for(; p + AVX2_BLOCK_PIXELS <= pixels; p += AVX2_BLOCK_PIXELS) {
+    __m128i e[6];
+    expandMask(_mm_loadu_si128((const __m128i*)(mask + p)), e);
+    expandMask(_mm_loadu_si128((const __m128i*)(mask + p + 16)), e + 3);
+
+    for(int k = 0; k < 3; k++) {
+      size_t i = p * 3 + k * 32;
+      __m256i vd = _mm256_loadu_si256((const __m256i*)(dst + i));
+      __m256i vs = _mm256_loadu_si256((const __m256i*)(src + i));
+      __m256i vm = combine(e[k * 2], e[k * 2 + 1]);
+      __m256i out[2];
+      for(int h = 0; h < 2; h++) {
+        __m256i d = h ? _mm256_unpackhi_epi8(vd, zero) : _mm256_unpacklo_epi8(vd, zero);
+        __m256i s = h ? _mm256_unpackhi_epi8(vs, zero) : _mm256_unpacklo_epi8(vs, zero);
+        __m256i m = h ? _mm256_unpackhi_epi8(vm, zero) : _mm256_unpacklo_epi8(vm, zero);
+        __m256i x = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(s, m),
+                                                      _mm256_mullo_epi16(d, _mm256_sub_epi16(full, m))), half);
+        out[h] = _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+      }
+      _mm256_storeu_si256((__m256i*)(dst + i), _mm256_packus_epi16(out[0], out[1]));
+    }
+  }
+  compositeAlphaOverScalar(dst + p * 3, src + p * 3, mask + p, pixels - p);
+}
+
+AVX2_TARGET static void addAvx2(uint8_t* dst, const uint8_t* src, size_t pixels) {
+  size_t p = 0;
+  for(; p + AVX2_BLOCK_PIXELS <= pixels; p += AVX2_BLOCK_PIXELS) {
+    for(int k = 0; k < 3; k++) {
+      size_t i = p * 3 + k * 32;
+      __m256i vd = _mm256_loadu_si256((const __m256i*)(dst + i));
+      __m256i vs = _mm256_loadu_si256((const __m256i*)(src + i));
+      _mm256_storeu_si256((__m256i*)(dst + i), _mm256_adds_epu8(vd, vs));
+    }
+  }
+  compositeAddScalar(dst + p * 3, src + p * 3, pixels - p);
+}
+
+AVX2_TARGET static void fadeAvx2(uint8_t* dst, size_t pixels, uint16_t scale) {
+  __m256i zero = _mm256_setzero_si256();
+  __m256i ws = _mm256_set1_epi16((short)scale);
+  size_t p = 0;
+  for(; p + AVX2_BLOCK_PIXELS <= pixels; p += AVX2_BLOCK_PIXELS) {
+    for(int k = 0; k < 3; k++) {
+      uint8_t* d = dst + p * 3 + k * 32;
+      __m256i v = _mm256_loadu_si256((const __m256i*)d);
+      __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(v, zero), ws), 8);
+      __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(v, zero), ws), 8);
+      _mm256_storeu_si256((__m256i*)d, _mm256_packus_epi16(lo, hi));
+    }
+  }
+  compositeFadeScalar(dst + p * 3, pixels - p, scale);
+}
+
+const CompositeKernels compositeAvx2Kernels = {
+  COMPOSITE_AVX2, "avx2",
+  fillAvx2, lerpAvx2, overColorAvx2, alphaOverAvx2, addAvx2, fadeAvx2, compositeGammaScalar,
+};
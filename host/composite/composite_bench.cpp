@@ -0,0 +1,214 @@
+// composite_bench.cpp - 합성 커널 검증/벤치마크
+// 1) 모든 변형이 스칼라 기준과 비트 단위로 같은지 확인 (무작위 입력 + 경계값, 꼬리 길이 포함)
+//    overColor는 펌웨어 overlayColorAlpha 식과도 비교 (채널 값 / 목표 값 전 조합 × 여러 알파)
+// 2) 픽셀 수 512 ~ 16384에서 커널별 ns/픽셀과 스칼라 대비 배율 출력
+//
+// 빌드:
+//   g++ -std=c++17 -O2 -o composite_bench composite_bench.cpp composite_scalar.cpp
+//       composite_sse2.cpp composite_avx2.cpp
+// 사용: ./composite_bench [--verify-only] [--ms N]
+//   --ms  커널/크기마다 측정 시간 (기본 50 ms)
+// 결과가 다르면 종료 코드 1
+
+#include "composite.h"
+#include "composite_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+
+enum KernelId { K_FILL, K_LERP, K_OVER_COLOR, K_ALPHA_OVER, K_ADD, K_FADE, K_GAMMA, KERNEL_COUNT };
+static const char* const kernelNames[KERNEL_COUNT] = {
+  "fill", "lerp", "overColor", "alphaOver", "add", "fade", "gamma"
+};
+
+// ===== 입력 버퍼 (커널 인자 포함) =====
+struct Inputs {
+  std::vector<uint8_t> a, b, mask;
+  uint8_t color[3];
+  uint16_t t, scale;
+  float alpha;
+  uint8_t lut[256];
+};
+
+static void makeInputs(Inputs& in, size_t pixels, std::mt19937& rng) {
+  in.a.resize(pixels * 3);
+  in.b.resize(pixels * 3);
+  in.mask.resize(pixels);
+  for(uint8_t& v : in.a) v = (uint8_t)rng();
+  for(uint8_t& v : in.b) v = (uint8_t)rng();
+  for(uint8_t& v : in.mask) v = (uint8_t)rng();
+  for(int c = 0; c < 3; c++) in.color[c] = (uint8_t)rng();
+  in.t = rng() % 257;
+  in.alpha = (int)(rng() % 1201) / 1000.0f - 0.1f;   // 범위 밖(0 이하, 1 초과)도 가끔
+  in.scale = rng() % 256 + 1;
+  for(int i = 0; i < 256; i++) in.lut[i] = (uint8_t)(pow(i / 255.0, 2.2) * 255 + 0.5);
+}
+
+// dst(= a 복사본)에 커널 하나 실행
+static void runKernel(const CompositeKernels& k, KernelId id, uint8_t* dst, const Inputs& in, size_t pixels) {
+  switch(id) {
+    case K_FILL:       k.fill(dst, pixels, in.color); break;
+    case K_LERP:       k.lerp(dst, in.a.data(), in.b.data(), pixels, in.t); break;
+    case K_OVER_COLOR: k.overColor(dst, pixels, in.color, in.alpha); break;
+    case K_ALPHA_OVER: k.alphaOver(dst, in.b.data(), in.mask.data(), pixels); break;
+    case K_ADD:        k.add(dst, in.b.data(), pixels); break;
+    case K_FADE:       k.fade(dst, pixels, in.scale); break;
+    case K_GAMMA:      k.gamma(dst, pixels, in.lut); break;
+    default: break;
+  }
+}
+
+//================= 검증 =================
+// 경계값: t/alpha 0·256, scale 1·256, 마스크 0·255, 채널 0·255
+static int verifyCase(const CompositeKernels& k, KernelId id, const Inputs& in, size_t pixels) {
+  std::vector<uint8_t> expect(in.a), got(in.a);
+  runKernel(compositeScalarKernels, id, expect.data(), in, pixels);
+  runKernel(k, id, got.data(), in, pixels);
+  for(size_t i = 0; i < pixels * 3; i++) {
+    if(expect[i] != got[i]) {
+      fprintf(stderr, "MISMATCH %s/%s pixels=%zu byte=%zu: expected %u, got %u\n",
+              k.name, kernelNames[id], pixels, i, expect[i], got[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int verifyLevel(const CompositeKernels& k, std::mt19937& rng) {
+  static const size_t lengths[] = { 0, 1, 15, 16, 17, 31, 32, 33, 63, 100, 512, 1000 };
+  int failures = 0;
+  Inputs in;
+  for(size_t pixels : lengths) {
+    for(int round = 0; round < 20; round++) {
+      makeInputs(in, pixels, rng);
+      // 라운드 0~3은 경계값으로 덮어씀
+      if(round < 4) {
+        uint8_t edge = (round & 1) ? 255 : 0;
+        for(size_t i = 0; i < in.a.size(); i += 2) in.a[i] = edge;
+        for(size_t i = 0; i < in.b.size(); i += 3) in.b[i] = 255 - edge;
+        for(size_t i = 0; i < in.mask.size(); i++) in.mask[i] = (i & 1) ? 255 : (round < 2 ? 0 : in.mask[i]);
+        in.t = (round & 1) ? 256 : 0;
+        in.alpha = (round & 1) ? 1.0f : 0.0f;
+        in.scale = (round & 1) ? 256 : 1;
+      }
+      for(int id = 0; id < KERNEL_COUNT; id++) {
+        failures += verifyCase(k, (KernelId)id, in, pixels);
+      }
+    }
+  }
+  return failures;
+}
+
+// 펌웨어 overlayColorAlpha의 채널 식 (control.cpp 그대로, 음수 float → uint8_t 캐스트 포함)
+static uint8_t firmwareOverlay(uint8_t old, uint8_t target, float alpha) {
+  return old + (uint8_t)((target - old) * alpha);
+}
+
+// 스칼라 overColor = 펌웨어 식인지 (알파 범위 [0, 1], 펌웨어 함수의 앞쪽 검사 통과 값)
+static int verifyFirmwareOverlay(std::mt19937& rng) {
+  std::vector<float> alphas = { 0.3f, 0.05f, 0.1f, 0.5f, 0.7f, 1.0f / 3.0f, 0.999f, 1.0f };
+  for(int i = 0; i < 24; i++) alphas.push_back((rng() % 100000 + 1) / 100000.0f);
+
+  std::vector<uint8_t> row(256 * 3);
+  for(float alpha : alphas) {
+    for(int target = 0; target < 256; target++) {
+      uint8_t color[3] = { (uint8_t)target, (uint8_t)target, (uint8_t)target };
+      for(int v = 0; v < 256; v++) row[v * 3] = row[v * 3 + 1] = row[v * 3 + 2] = (uint8_t)v;
+      compositeOverColorScalar(row.data(), 256, color, alpha);
+      for(int v = 0; v < 256; v++) {
+        uint8_t expect = firmwareOverlay((uint8_t)v, (uint8_t)target, alpha);
+        if(row[v * 3] != expect) {
+          fprintf(stderr, "MISMATCH firmware/overColor old=%d target=%d alpha=%.9g: expected %u, got %u\n",
+                  v, target, alpha, expect, row[v * 3]);
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+//================= 측정 =================
+static double measureNsPerPixel(const CompositeKernels& k, KernelId id, const Inputs& in, size_t pixels,
+                                double budgetMs) {
+  std::vector<uint8_t> dst(in.a);
+  for(int i = 0; i < 8; i++) runKernel(k, id, dst.data(), in, pixels);   // 캐시 예열
+
+  double best = 1e30;
+  auto start = std::chrono::steady_clock::now();
+  do {
+    const int reps = 64;
+    auto t0 = std::chrono::steady_clock::now();
+    for(int r = 0; r < reps; r++) {
+      runKernel(k, id, dst.data(), in, pixels);
+      asm volatile("" : : "r"(dst.data()) : "memory");
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    if(ns / reps < best) best = ns / reps;
+  } while(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() < budgetMs);
+  return best / pixels;
+}
+
+int main(int argc, char** argv) {
+  bool verifyOnly = false;
+  double budgetMs = 50;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--verify-only") == 0) verifyOnly = true;
+    else if(strcmp(argv[i], "--ms") == 0 && i + 1 < argc) budgetMs = atof(argv[++i]);
+    else {
+      fprintf(stderr, "Usage: %s [--verify-only] [--ms N]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  // ===== 지원 변형 =====
+  std::vector<const CompositeKernels*> levels;
+  for(int level = 0; level < COMPOSITE_LEVEL_COUNT; level++) {
+    if(compositeSupported((CompositeLevel)level)) levels.push_back(&compositeKernels((CompositeLevel)level));
+  }
+  printf("지원 변형:");
+  for(const CompositeKernels* k : levels) printf(" %s", k->name);
+  printf(" (기본 선택 %s)\n", compositeBest().name);
+
+  // ===== 비트 동일성 =====
+  std::mt19937 rng(12345);
+  int failures = verifyFirmwareOverlay(rng);
+  const uint8_t target[3] = { 170, 170, 170 };
+  uint8_t pixel[3] = { 200, 200, 200 };
+  compositeOverColorScalar(pixel, 1, target, 0.3f);   // 펌웨어 결과 191
+  if(pixel[0] != 191) failures++;
+  printf("검증 overlayColorAlpha %s (200 → 170, 알파 0.3: %u)\n", failures ? "실패" : "펌웨어와 동일", pixel[0]);
+  for(const CompositeKernels* k : levels) {
+    if(k->level == COMPOSITE_SCALAR) continue;
+    int f = verifyLevel(*k, rng);
+    printf("검증 %-6s %s\n", k->name, f ? "실패" : "스칼라와 동일");
+    failures += f;
+  }
+  if(failures || verifyOnly) return failures ? 1 : 0;
+
+  // ===== 크기별 ns/픽셀 =====
+  static const size_t sizes[] = { 512, 1024, 2048, 4096, 8192, 16384 };
+  printf("\n%-10s %7s", "kernel", "pixels");
+  for(const CompositeKernels* k : levels) printf(" %9s", k->name);
+  for(size_t l = 1; l < levels.size(); l++) printf(" %8s", (std::string("x") + levels[l]->name).c_str());
+  printf("   (ns/픽셀, 스칼라 대비 배율)\n");
+
+  Inputs in;
+  for(int id = 0; id < KERNEL_COUNT; id++) {
+    for(size_t pixels : sizes) {
+      makeInputs(in, pixels, rng);
+      std::vector<double> ns;
+      for(const CompositeKernels* k : levels) ns.push_back(measureNsPerPixel(*k, (KernelId)id, in, pixels, budgetMs));
+      printf("%-10s %7zu", kernelNames[id], pixels);
+      for(double v : ns) printf(" %9.3f", v);
+      for(size_t l = 1; l < ns.size(); l++) printf(" %8.1f", ns[0] / ns[l]);
+      printf("\n");
+    }
+  }
+  return 0;
+}
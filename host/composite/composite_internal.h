@@ -0,0 +1,16 @@
+// composite_internal.h - 합성 커널 변형 사이 공유 (스칼라 기준 = SIMD 꼬리 처리)
+
+#ifndef COMPOSITE_INTERNAL_H
+#define COMPOSITE_INTERNAL_H
+
+#include "composite.h"
+
+void compositeFillScalar(uint8_t* dst, size_t pixels, const uint8_t color[3]);
+void compositeLerpScalar(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t pixels, uint16_t t);
+void compositeOverColorScalar(uint8_t* dst, size_t pixels, const uint8_t color[3], float alpha);
+void compositeAlphaOverScalar(uint8_t* dst, const uint8_t* src, const uint8_t* mask, size_t pixels);
+void compositeAddScalar(uint8_t* dst, const uint8_t* src, size_t pixels);
+void compositeFadeScalar(uint8_t* dst, size_t pixels, uint16_t scale);
+void compositeGammaScalar(uint8_t* dst, size_t pixels, const uint8_t lut[256]);
+
+#endif
@@ -0,0 +1,109 @@
+// composite_scalar.cpp - 합성 커널 스칼라 기준 구현과 실행 시 변형 선택
+// SIMD 변형은 남는 꼬리 픽셀을 이 함수들로 처리
+
+#include "composite.h"
+#include "composite_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// ================= 스칼라 기준 =================
+
+void compositeFillScalar(uint8_t* dst, size_t pixels, const uint8_t color[3]) {
+  for(size_t i = 0; i < pixels; i++) {
+    dst[i * 3 + 0] = color[0];
+    dst[i * 3 + 1] = color[1];
+    dst[i * 3 + 2] = color[2];
+  }
+}
+
+void compositeLerpScalar(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t pixels, uint16_t t) {
+  uint16_t inv = 256 - t;
+  for(size_t i = 0; i < pixels * 3; i++) {
+    dst[i] = (uint8_t)((a[i] * inv + b[i] * t) >> 8);
+  }
+}
+
+// overlayColorAlpha의 채널 식 그대로 (음수 차이는 int로 버린 뒤 더함: 펌웨어의 uint8_t 캐스트와 같은 결과)
+void compositeOverColorScalar(uint8_t* dst, size_t pixels, const uint8_t color[3], float alpha) {
+  if(alpha <= 0.0f) return;
+  if(alpha > 1.0f) alpha = 1.0f;
+  for(size_t i = 0; i < pixels * 3; i++) {
+    dst[i] = (uint8_t)(dst[i] + (int)((color[i % 3] - dst[i]) * alpha));
+  }
+}
+
+void compositeAlphaOverScalar(uint8_t* dst, const uint8_t* src, const uint8_t* mask, size_t pixels) {
+  for(size_t p = 0; p < pixels; p++) {
+    uint16_t m = mask[p];
+    for(int c = 0; c < 3; c++) {
+      size_t i = p * 3 + c;
+      uint16_t x = src[i] * m + dst[i] * (255 - m) + 128;
+      dst[i] = (uint8_t)((x + (x >> 8)) >> 8);
+    }
+  }
+}
+
+void compositeAddScalar(uint8_t* dst, const uint8_t* src, size_t pixels) {
+  for(size_t i = 0; i < pixels * 3; i++) {
+    unsigned sum = dst[i] + src[i];
+    dst[i] = (uint8_t)(sum > 255 ? 255 : sum);
+  }
+}
+
+void compositeFadeScalar(uint8_t* dst, size_t pixels, uint16_t scale) {
+  for(size_t i = 0; i < pixels * 3; i++) {
+    dst[i] = (uint8_t)((dst[i] * scale) >> 8);
+  }
+}
+
+void compositeGammaScalar(uint8_t* dst, size_t pixels, const uint8_t lut[256]) {
+  for(size_t i = 0; i < pixels * 3; i++) {
+    dst[i] = lut[dst[i]];
+  }
+}
+
+const CompositeKernels compositeScalarKernels = {
+  COMPOSITE_SCALAR, "scalar",
+  compositeFillScalar, compositeLerpScalar, compositeOverColorScalar, compositeAlphaOverScalar,
+  compositeAddScalar, compositeFadeScalar, compositeGammaScalar,
+};
+
+// ================= 변형 선택 =================
+
+bool compositeSupported(CompositeLevel level) {
+  switch(level) {
+    case COMPOSITE_SCALAR: return true;
+    case COMPOSITE_SSE2:   return __builtin_cpu_supports("sse2");
+    case COMPOSITE_AVX2:   return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("ssse3");
+    default:               return false;
+  }
+}
+
+const CompositeKernels& compositeKernels(CompositeLevel level) {
+  if(!compositeSupported(level)) return compositeScalarKernels;
+  switch(level) {
+    case COMPOSITE_SSE2: return compositeSse2Kernels;
+    case COMPOSITE_AVX2: return compositeAvx2Kernels;
+    default:             return compositeScalarKernels;
+  }
+}
+
+// COMPOSITE_LEVEL=scalar|sse2|avx2 로 상한 지정 (비교/디버그용)
+static const CompositeKernels* pickBest() {
+  int limit = COMPOSITE_LEVEL_COUNT - 1;
+  const char* env = getenv("COMPOSITE_LEVEL");
+  if(env) {
+    if(!strcmp(env, "scalar")) limit = COMPOSITE_SCALAR;
+    else if(!strcmp(env, "sse2")) limit = COMPOSITE_SSE2;
+  }
+  int level = limit;
+  while(level > COMPOSITE_SCALAR && !compositeSupported((CompositeLevel)level)) level--;
+  return &compositeKernels((CompositeLevel)level);
+}
+
+// 데몬의 패널 렌더 스레드들이 동시에 부르므로 함수 정적 변수 초기화(한 번만, 잠금 포함)로 선택
+const CompositeKernels& compositeBest() {
+  static const CompositeKernels* best = pickBest();
+  return *best;
+}
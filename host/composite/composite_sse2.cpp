@@ -0,0 +1,162 @@
+// composite_sse2.cpp - 합성 커널 SSE2 변형 (16픽셀 = 48바이트 = 벡터 3개 단위, 꼬리는 스칼라)
+// 곱셈은 16비트로 넓혀서 계산 (최댓값 255 * 256 = 65280, 넘침 없음)
+// overColor는 펌웨어와 같은 float 식이라 32비트로 넓혀 단정도 곱셈 (cvttps = 0 방향 버림)
+// gamma는 SSE2에 바이트 셔플이 없어 스칼라 그대로 (256칸 표 조회가 가장 빠름)
+
+#include "composite.h"
+#include "composite_internal.h"
+
+#include <emmintrin.h>
+
+#define SSE2_BLOCK_PIXELS 16
+
+// 3바이트 색 반복 패턴 (48바이트 = 벡터 3개)
+static void colorPattern(const uint8_t color[3], __m128i pattern[3]) {
+  uint8_t bytes[48];
+  for(int i = 0; i < 48; i++) bytes[i] = color[i % 3];
+  for(int k = 0; k < 3; k++) pattern[k] = _mm_loadu_si128((const __m128i*)(bytes + k * 16));
+}
+
+// (a * wa + b * wb) >> 8, 바이트 16개
+static inline __m128i weighted(__m128i a, __m128i b, __m128i wa, __m128i wb) {
+  __m128i zero = _mm_setzero_si128();
+  __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), wa),
+                             _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), wb));
+  __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), wa),
+                             _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), wb));
+  return _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+}
+
+// 바이트 16개 → 32비트 4개씩 4묶음
+static inline void widen(__m128i v, __m128i out[4]) {
+  __m128i zero = _mm_setzero_si128();
+  __m128i lo = _mm_unpacklo_epi8(v, zero);
+  __m128i hi = _mm_unpackhi_epi8(v, zero);
+  out[0] = _mm_unpacklo_epi16(lo, zero);
+  out[1] = _mm_unpackhi_epi16(lo, zero);
+  out[2] = _mm_unpacklo_epi16(hi, zero);
+  out[3] = _mm_unpackhi_epi16(hi, zero);
+}
+
+// dst + (int)((color - dst) * alpha), 바이트 16개 (결과는 dst와 color 사이라 포화 묶기로 충분)
+static inline __m128i overlayBytes(__m128i v, const __m128i color[4], __m128 alpha) {
+  __m128i w[4];
+  widen(v, w);
+  for(int j = 0; j < 4; j++) {
+    __m128 diff = _mm_cvtepi32_ps(_mm_sub_epi32(color[j], w[j]));
+    w[j] = _mm_add_epi32(w[j], _mm_cvttps_epi32(_mm_mul_ps(diff, alpha)));
+  }
+  return _mm_packus_epi16(_mm_packs_epi32(w[0], w[1]), _mm_packs_epi32(w[2], w[3]));
+}
+
+// ================= 커널 =================
+
+static void fillSse2(uint8_t* dst, size_t pixels, const uint8_t color[3]) {
+  __m128i pattern[3];
+  colorPattern(color, pattern);
+  size_t p = 0;
+  for(; p + SSE2_BLOCK_PIXELS <= pixels; p += SSE2_BLOCK_PIXELS) {
+    uint8_t* d = dst + p * 3;
+    for(int k = 0; k < 3; k++) _mm_storeu_si128((__m128i*)(d + k * 16), pattern[k]);
+  }
+  compositeFillScalar(dst + p * 3, pixels - p, color);
+}
+
+static void lerpSse2(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t pixels, uint16_t t) {
+  __m128i wa = _mm_set1_epi16((short)(256 - t));
+  __m128i wb = _mm_set1_epi16((short)t);
+  size_t p = 0;
+  for(; p + SSE2_BLOCK_PIXELS <= pixels; p += SSE2_BLOCK_PIXELS) {
+    for(int k = 0; k < 3; k++) {
+      size_t i = p * 3 + k * 16;
+      __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+      __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+      _mm_storeu_si128((__m128i*)(dst + i), weighted(va, vb, wa, wb));
+    }
+  }
+  compositeLerpScalar(dst + p * 3, a + p * 3, b + p * 3, pixels - p, t);
+}
+
+static void overColorSse2(uint8_t* dst, size_t pixels, const uint8_t color[3], float alpha) {
+  if(alpha <= 0.0f) return;
+  if(alpha > 1.0f) alpha = 1.0f;
+  __m128i pattern[3];
+  colorPattern(color, pattern);
+  __m128i wide[3][4];
+  for(int k = 0; k < 3; k++) widen(pattern[k], wide[k]);
+  __m128 va = _mm_set1_ps(alpha);
+  size_t p = 0;
+  for(; p + SSE2_BLOCK_PIXELS <= pixels; p += SSE2_BLOCK_PIXELS) {
+    for(int k = 0; k < 3; k++) {
+      uint8_t* d = dst + p * 3 + k * 16;
+      __m128i vd = _mm_loadu_si128((const __m128i*)d);
+      _mm_storeu_si128((__m128i*)d, overlayBytes(vd, wide[k], va));
+    }
+  }
+  compositeOverColorScalar(dst + p * 3, pixels - p, color, alpha);
+}
+
+// 픽셀당 알파를 채널 3개로 펼침 (SSE2는 바이트 셔플이 없어 스칼라로 48바이트 준비)
+static void alphaOverSse2(uint8_t* dst, const uint8_t* src, const uint8_t* mask, size_t pixels) {
+  __m128i zero = _mm_setzero_si128();
+  __m128i full = _mm_set1_epi16(255);
+  __m128i half = _mm_set1_epi16(128);
+  uint8_t expanded[48];
+  size_t p = 0;
+  for(; p + SSE2_BLOCK_PIXELS <= pixels; p += SSE2_BLOCK_PIXELS) {
+    for(int j = 0; j < SSE2_BLOCK_PIXELS; j++) {
+      expanded[j * 3 + 0] = expanded[j * 3 + 1] = expanded[j * 3 + 2] = mask[p + j];
+    }
+    for(int k = 0; k < 3; k++) {
+      size_t i = p * 3 + k * 16;
+      __m128i vd = _mm_loadu_si128((const __m128i*)(dst + i));
+      __m128i vs = _mm_loadu_si128((const __m128i*)(src + i));
+      __m128i vm = _mm_loadu_si128((const __m128i*)(expanded + k * 16));
+      __m128i out[2];
+      for(int h = 0; h < 2; h++) {
+        __m128i d = h ? _mm_unpackhi_epi8(vd, zero) : _mm_unpacklo_epi8(vd, zero);
+        __m128i s = h ? _mm_unpackhi_epi8(vs, zero) : _mm_unpacklo_epi8(vs, zero);
+        __m128i m = h ? _mm_unpackhi_epi8(vm, zero) : _mm_unpacklo_epi8(vm, zero);
+        __m128i x = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(s, m),
+                                                _mm_mullo_epi16(d, _mm_sub_epi16(full, m))), half);
+        out[h] = _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+      }
+      _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(out[0], out[1]));
+    }
+  }
+  compositeAlphaOverScalar(dst + p * 3, src + p * 3, mask + p, pixels - p);
+}
+
+static void addSse2(uint8_t* dst, const uint8_t* src, size_t pixels) {
+  size_t p = 0;
+  for(; p + SSE2_BLOCK_PIXELS <= pixels; p += SSE2_BLOCK_PIXELS) {
+    for(int k = 0; k < 3; k++) {
+      size_t i = p * 3 + k * 16;
+      __m128i vd = _mm_loadu_si128((const __m128i*)(dst + i));
+      __m128i vs = _mm_loadu_si128((const __m128i*)(src + i));
+      _mm_storeu_si128((__m128i*)(dst + i), _mm_adds_epu8(vd, vs));
+    }
+  }
+  compositeAddScalar(dst + p * 3, src + p * 3, pixels - p);
+}
+
+static void fadeSse2(uint8_t* dst, size_t pixels, uint16_t scale) {
+  __m128i zero = _mm_setzero_si128();
+  __m128i ws = _mm_set1_epi16((short)scale);
+  size_t p = 0;
+  for(; p + SSE2_BLOCK_PIXELS <= pixels; p += SSE2_BLOCK_PIXELS) {
+    for(int k = 0; k < 3; k++) {
+      uint8_t* d = dst + p * 3 + k * 16;
+      __m128i v = _mm_loadu_si128((const __m128i*)d);
+      __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), ws), 8);
+      __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), ws), 8);
+      _mm_storeu_si128((__m128i*)d, _mm_packus_epi16(lo, hi));
+    }
+  }
+  compositeFadeScalar(dst + p * 3, pixels - p, scale);
+}
+
+const CompositeKernels compositeSse2Kernels = {
+  COMPOSITE_SSE2, "sse2",
+  fillSse2, lerpSse2, overColorSse2, alphaOverSse2, addSse2, fadeSse2, compositeGammaScalar,
+};
@@ -0,0 +1,268 @@
+// dmx_input.cpp - Art-Net / E1.31 네트워크 입력
+
+#include "dmx_input.h"
+#include "frame_capture.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+// ===== Art-Net =====
+#define ARTNET_OP_DMX   0x5000
+#define ARTNET_OP_SYNC  0x5200
+#define ARTNET_HEADER   18
+
+// ===== E1.31 (ANSI E1.31-2016) =====
+#define E131_ROOT_DATA       0x00000004
+#define E131_ROOT_EXTENDED   0x00000008
+#define E131_FRAMING_DATA    0x00000002
+#define E131_EXTENDED_SYNC   0x00000001
+#define E131_DMP_SET         0x02
+#define E131_HEADER          126      // DMP 속성 값(시작 코드) 다음
+#define E131_SYNC_LENGTH     49
+#define E131_OPTION_PREVIEW  0x80
+
+#define TARGET_NONE  0xFFFF
+
+static const uint8_t acnPacketId[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+
+static inline uint16_t be16(const uint8_t* p) { return (uint16_t)(p[0] << 8 | p[1]); }
+static inline uint32_t be32(const uint8_t* p) {
+  return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+//================= 생성 =================
+// 스트립 인덱스 → 물리 좌표 → 논리 픽셀 (패널 512픽셀마다 행 우선) → 유니버스/채널
+DmxInput::DmxInput(DmxProtocol protocol, uint16_t firstUniverse, FrameRing* ring, uint16_t pixelCount)
+  : protocol(protocol), firstUniverse(firstUniverse), ring(ring), pixelCount(pixelCount), fd(-1),
+    current(0), previous(0), receivedMask(0), skipMask(0), frameStartUs(0), lastSyncUs(0), syncSeen(false), sequence(0) {
+  if(this->pixelCount > ring->maxPixels()) this->pixelCount = ring->maxPixels();
+  if(this->pixelCount > DMX_MAX_UNIVERSES * DMX_PIXELS_PER_UNIVERSE) {
+    this->pixelCount = DMX_MAX_UNIVERSES * DMX_PIXELS_PER_UNIVERSE;
+  }
+  universes = (this->pixelCount + DMX_PIXELS_PER_UNIVERSE - 1) / DMX_PIXELS_PER_UNIVERSE;
+  channelTarget.assign((size_t)universes * DMX_UNIVERSE_SIZE, TARGET_NONE);
+
+  const int panelPixels = PREVIEW_MATRIX_WIDTH * PREVIEW_MATRIX_HEIGHT;
+  for(int s = 0; s < this->pixelCount; s++) {
+    int x, y;
+    previewPixelXY(s % panelPixels, &x, &y);
+    int logical = s / panelPixels * panelPixels + y * PREVIEW_MATRIX_WIDTH + x;
+    uint16_t* map = &channelTarget[(logical / DMX_PIXELS_PER_UNIVERSE) * DMX_UNIVERSE_SIZE +
+                                   (logical % DMX_PIXELS_PER_UNIVERSE) * 3];
+    map[0] = (uint16_t)(s * 3 + 1);   // R
+    map[1] = (uint16_t)(s * 3 + 0);   // G
+    map[2] = (uint16_t)(s * 3 + 2);   // B
+  }
+  for(int u = 0; u < DMX_MAX_UNIVERSES; u++) lastSequence[u] = -1;
+  packets = new uint8_t[DMX_RECV_BATCH * DMX_PACKET_MAX];
+}
+
+DmxInput::~DmxInput() {
+  if(fd >= 0) close(fd);
+  delete[] packets;
+}
+
+//================= 소켓 =================
+bool DmxInput::open(uint16_t port) {
+  if(port == 0) port = protocol == DMX_ARTNET ? DMX_ARTNET_PORT : DMX_SACN_PORT;
+  fd = socket(AF_INET, SOCK_DGRAM, 0);
+  if(fd < 0) return false;
+
+  int on = 1;
+  int bufferBytes = 4 << 20;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &bufferBytes, sizeof(bufferBytes));
+
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  if(bind(fd, (struct sockaddr*)&address, sizeof(address)) != 0) return false;
+
+  // sACN 멀티캐스트 그룹 239.255.<유니버스 상위>.<하위> (실패해도 유니캐스트로 동작)
+  if(protocol == DMX_SACN) {
+    for(uint16_t u = 0; u < universes; u++) {
+      uint16_t universe = firstUniverse + u;
+      struct ip_mreq group;
+      group.imr_multiaddr.s_addr = htonl(0xEFFF0000u | universe);
+      group.imr_interface.s_addr = htonl(INADDR_ANY);
+      setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &group, sizeof(group));
+    }
+  }
+  return true;
+}
+
+// 수신 버퍼에 여러 패킷을 한 번에 받고 그 자리에서 디코드
+int DmxInput::receive(int timeoutMs, uint64_t (*clockUs)()) {
+  struct pollfd p = { fd, POLLIN, 0 };
+  int ready = poll(&p, 1, timeoutMs);
+  if(ready <= 0) return ready < 0 && errno != EINTR ? -1 : 0;
+
+  struct mmsghdr messages[DMX_RECV_BATCH];
+  struct iovec vectors[DMX_RECV_BATCH];
+  memset(messages, 0, sizeof(messages));
+  for(int i = 0; i < DMX_RECV_BATCH; i++) {
+    vectors[i].iov_base = packets + i * DMX_PACKET_MAX;
+    vectors[i].iov_len = DMX_PACKET_MAX;
+    messages[i].msg_hdr.msg_iov = &vectors[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+  int count = recvmmsg(fd, messages, DMX_RECV_BATCH, MSG_DONTWAIT, 0);
+  if(count < 0) return errno == EAGAIN || errno == EINTR ? 0 : -1;
+  uint64_t nowUs = clockUs();
+  for(int i = 0; i < count; i++) {
+    decode(packets + i * DMX_PACKET_MAX, messages[i].msg_len, nowUs);
+  }
+  return count;
+}
+
+//================= 디코드 =================
+void DmxInput::decode(const uint8_t* packet, size_t length, uint64_t nowUs) {
+  counters.packets++;
+
+  if(protocol == DMX_ARTNET) {
+    if(length < 10 || memcmp(packet, "Art-Net", 8) != 0) {
+      counters.ignored++;
+      return;
+    }
+    uint16_t opcode = (uint16_t)(packet[8] | packet[9] << 8);
+    if(opcode == ARTNET_OP_SYNC) {
+      sync(nowUs);
+      return;
+    }
+    uint16_t size = length >= ARTNET_HEADER ? be16(packet + 16) : 0;
+    if(opcode != ARTNET_OP_DMX || size == 0 || size > DMX_UNIVERSE_SIZE || (size_t)ARTNET_HEADER + size > length) {
+      counters.ignored++;
+      return;
+    }
+    uint16_t universe = (uint16_t)(packet[14] | (packet[15] & 0x7F) << 8);
+    applyUniverse(universe, packet[12], packet + ARTNET_HEADER, size, nowUs);
+    return;
+  }
+
+  if(length < 44 || memcmp(packet + 4, acnPacketId, sizeof(acnPacketId)) != 0) {
+    counters.ignored++;
+    return;
+  }
+  uint32_t rootVector = be32(packet + 18);
+  uint32_t framingVector = be32(packet + 40);
+  if(rootVector == E131_ROOT_EXTENDED && framingVector == E131_EXTENDED_SYNC && length >= E131_SYNC_LENGTH) {
+    sync(nowUs);
+    return;
+  }
+  if(rootVector != E131_ROOT_DATA || framingVector != E131_FRAMING_DATA || length < E131_HEADER ||
+     packet[117] != E131_DMP_SET || (packet[112] & E131_OPTION_PREVIEW) || packet[125] != 0) {
+    counters.ignored++;
+    return;
+  }
+  uint16_t values = be16(packet + 123);   // 시작 코드 포함
+  if(values < 2 || values - 1 > DMX_UNIVERSE_SIZE || (size_t)E131_HEADER + values - 1 > length) {
+    counters.ignored++;
+    return;
+  }
+  applyUniverse(be16(packet + 113), packet[111], packet + E131_HEADER, values - 1, nowUs);
+}
+
+//================= 프레임 조립 =================
+void DmxInput::applyUniverse(uint16_t universe, uint8_t seq, const uint8_t* data, size_t length, uint64_t nowUs) {
+  if(universe < firstUniverse || universe - firstUniverse >= universes) {
+    counters.ignored++;
+    return;
+  }
+  uint16_t u = universe - firstUniverse;
+
+  // 늦은 패킷 (Art-Net 순번 0 = 순번 없음)
+  if(protocol == DMX_SACN || seq != 0) {
+    if(lastSequence[u] >= 0) {
+      int8_t diff = (int8_t)(seq - (uint8_t)lastSequence[u]);
+      if(diff <= 0 && diff > -20) {
+        counters.late++;
+        return;
+      }
+    }
+    lastSequence[u] = seq;
+  }
+
+  bool syncMode = syncSeen && nowUs - lastSyncUs < DMX_SYNC_TIMEOUT_US;
+  uint32_t bit = 1u << u;
+  // 버리는 프레임: 같은 유니버스가 다시 오거나 (동기 모드면 동기 패킷이 와야) 다음 프레임
+  // 한 유니버스만 버리면 다음 프레임 유니버스와 섞인 프레임이 나오므로 프레임 단위로 버림
+  if(skipMask) {
+    if(syncMode || !(skipMask & bit)) {
+      skipMask |= bit;
+      counters.overruns++;
+      return;
+    }
+    skipMask = 0;
+  }
+  if(!syncMode && (receivedMask & bit)) commit(nowUs);   // 다음 프레임이 시작됨
+  if(!current) {
+    current = ring->beginWrite();
+    if(!current) {
+      counters.overruns++;
+      skipMask = bit;
+      return;
+    }
+    frameStartUs = nowUs;
+    receivedMask = 0;
+  }
+
+  // 채널을 전송 버퍼 위치로 바로 옮기고, 짧은 패킷의 나머지 채널은 직전 프레임 값
+  const uint16_t* map = &channelTarget[(size_t)u * DMX_UNIVERSE_SIZE];
+  uint8_t* pixels = current->pixels;
+  for(size_t i = 0; i < length; i++) {
+    if(map[i] != TARGET_NONE) pixels[map[i]] = data[i];
+  }
+  for(size_t i = length; i < DMX_PIXELS_PER_UNIVERSE * 3; i++) {
+    if(map[i] != TARGET_NONE) pixels[map[i]] = previous ? previous->pixels[map[i]] : 0;
+  }
+  receivedMask |= bit;
+  counters.universes++;
+
+  uint32_t fullMask = universes >= 32 ? 0xFFFFFFFFu : (1u << universes) - 1;
+  if(!syncMode && receivedMask == fullMask) commit(nowUs);
+}
+
+void DmxInput::sync(uint64_t nowUs) {
+  counters.syncs++;
+  syncSeen = true;
+  lastSyncUs = nowUs;
+  skipMask = 0;
+  commit(nowUs);
+}
+
+void DmxInput::flush(uint64_t nowUs) {
+  commit(nowUs);
+}
+
+// 빠진 유니버스는 직전 프레임에서 채워 공개 (처음이면 검정)
+void DmxInput::commit(uint64_t nowUs) {
+  if(!current) return;
+  uint32_t fullMask = universes >= 32 ? 0xFFFFFFFFu : (1u << universes) - 1;
+  uint32_t missing = fullMask & ~receivedMask;
+  if(missing) {
+    counters.partialFrames++;
+    for(uint16_t u = 0; u < universes; u++) {
+      if(!(missing & (1u << u))) continue;
+      const uint16_t* map = &channelTarget[(size_t)u * DMX_UNIVERSE_SIZE];
+      for(int i = 0; i < DMX_PIXELS_PER_UNIVERSE * 3; i++) {
+        if(map[i] != TARGET_NONE) current->pixels[map[i]] = previous ? previous->pixels[map[i]] : 0;
+      }
+    }
+  }
+  current->timeUs = nowUs;
+  current->sequence = sequence++;
+  current->renderUs = (uint32_t)(nowUs - frameStartUs);
+  current->pixelCount = pixelCount;
+  ring->commitWrite();
+  previous = current;
+  current = 0;
+  receivedMask = 0;
+  counters.frames++;
+}
@@ -0,0 +1,89 @@
+// dmx_input.h - Art-Net / E1.31(sACN) 네트워크 입력 → 프레임 링
+// 연속된 유니버스 몇 개를 32x16 매트릭스에 논리 순서(행 우선, RGB 3채널씩, 유니버스당 170픽셀)로 받아
+// samsung_04_rain getPixelIndex와 같은 세로 지그재그 배치의 GRB 전송 버퍼로 바로 씀
+// 수신 버퍼 → 링 슬롯으로 채널을 한 번만 옮김 (중간 유니버스 버퍼 없음, 채널 → 바이트 위치 표 사용)
+//
+// 프레임 완성:
+//   동기 모드 (최근 DMX_SYNC_TIMEOUT_US 안에 ArtSync/E1.31 동기 패킷을 받음): 동기 패킷에서 공개
+//   그 외: 모든 유니버스를 받으면 공개, 받은 유니버스가 다시 오면 그 전에 공개 (빠진 유니버스는 직전 프레임 값)
+// 순번: 유니버스마다 (int8)(새 순번 - 이전 순번)이 -20 ~ 0이면 늦은 패킷으로 버림 (E1.31 규칙, Art-Net 순번 0은 검사 안 함)
+
+#ifndef DMX_INPUT_H
+#define DMX_INPUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "frame_ring.h"
+
+#define DMX_ARTNET_PORT       6454
+#define DMX_SACN_PORT         5568
+#define DMX_UNIVERSE_SIZE     512
+#define DMX_PIXELS_PER_UNIVERSE 170
+#define DMX_SYNC_TIMEOUT_US   4000000UL   // 동기 패킷이 이만큼 없으면 동기 모드 해제 (Art-Net 규격)
+#define DMX_MAX_UNIVERSES     32
+#define DMX_RECV_BATCH        32          // recvmmsg 한 번에 받을 패킷 수
+#define DMX_PACKET_MAX        640
+
+enum DmxProtocol {
+  DMX_ARTNET = 0,
+  DMX_SACN
+};
+
+// ===== 통계 (수신 스레드만 씀) =====
+struct DmxStats {
+  uint64_t packets = 0;
+  uint64_t universes = 0;       // 프레임에 반영한 유니버스
+  uint64_t late = 0;            // 순번이 뒤처져 버린 패킷
+  uint64_t ignored = 0;         // 형식 오류, 다른 유니버스, 시작 코드 != 0, 미리보기 데이터
+  uint64_t overruns = 0;        // 링이 가득 차 버린 패킷 (출력이 밀림, 그 프레임의 나머지 유니버스 포함)
+  uint64_t syncs = 0;
+  uint64_t frames = 0;
+  uint64_t partialFrames = 0;   // 일부 유니버스가 빠진 채 공개한 프레임
+};
+
+class DmxInput {
+ public:
+  DmxInput(DmxProtocol protocol, uint16_t firstUniverse, FrameRing* ring, uint16_t pixelCount);
+  ~DmxInput();
+
+  bool open(uint16_t port);                 // 0 = 프로토콜 기본 포트, 실패 시 errno 유지
+  int receive(int timeoutMs, uint64_t (*clockUs)());   // 받은 패킷 수 (시간 초과 0, 오류 -1), 시각은 받은 직후
+  void decode(const uint8_t* packet, size_t length, uint64_t nowUs);
+  void flush(uint64_t nowUs);               // 모으던 프레임 공개 (종료 시)
+
+  uint16_t universeCount() const { return universes; }
+  const DmxStats& stats() const { return counters; }
+
+ private:
+  DmxInput(const DmxInput&);
+  DmxInput& operator=(const DmxInput&);
+
+  void applyUniverse(uint16_t universe, uint8_t sequence, const uint8_t* data, size_t length, uint64_t nowUs);
+  void sync(uint64_t nowUs);
+  void commit(uint64_t nowUs);
+
+  DmxProtocol protocol;
+  uint16_t firstUniverse;
+  uint16_t universes;
+  FrameRing* ring;
+  uint16_t pixelCount;
+  int fd;
+
+  std::vector<uint16_t> channelTarget;   // [유니버스 * 512 + 채널] → 버퍼 바이트 위치 (0xFFFF = 없음)
+  int16_t lastSequence[DMX_MAX_UNIVERSES];   // -1 = 아직 없음
+  FrameSlot* current;           // 모으는 중인 슬롯 (없으면 0)
+  const FrameSlot* previous;    // 직전에 공개한 슬롯 (빠진 유니버스 채움)
+  uint32_t receivedMask;
+  uint32_t skipMask;            // 링이 가득 차 버리는 중인 프레임의 유니버스 (다음 프레임까지 통째로 버림)
+  uint64_t frameStartUs;
+  uint64_t lastSyncUs;
+  bool syncSeen;
+  uint32_t sequence;
+  DmxStats counters;
+
+  uint8_t* packets;             // DMX_RECV_BATCH * DMX_PACKET_MAX
+};
+
+#endif
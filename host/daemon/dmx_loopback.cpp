@@ -0,0 +1,296 @@
+// dmx_loopback.cpp - Art-Net / E1.31 입력 루프백 측정
+// 같은 프로세스에서 UDP(127.0.0.1)로 유니버스를 보내고 DmxInput → 프레임 링 → 출력(인코딩 + /dev/null)까지
+// 렌더 데몬과 같은 경로로 받아, 프레임 마지막 패킷 송신부터 출력 write 끝까지의 지연을 잼
+// 프레임 번호는 논리 픽셀 0의 RGB(24비트)에 넣어 보냄
+//
+// 빌드: g++ -std=c++17 -O2 -pthread -I../arduino -I../preview -o dmx_loopback dmx_loopback.cpp
+//       dmx_input.cpp frame_ring.cpp frame_output.cpp
+// 사용: ./dmx_loopback [--sacn] [--sync] [--fps N] [--seconds S] [--reorder N] [--flood] [--port N]
+//   --sync     프레임마다 ArtSync / E1.31 동기 패킷을 보내고 그때 공개
+//   --reorder  N 프레임마다 이전 프레임의 유니버스 1 패킷을 다시 보냄 (늦은 패킷으로 버려져야 함)
+//   --flood    간격 없이 최대 속도로 보내 초당 처리 유니버스 수 측정
+// 지연 모드에서 보낸 프레임이 모두 나오지 않거나 늦은 패킷이 반영되면 종료 코드 1
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dmx_input.h"
+#include "frame_ring.h"
+#include "frame_output.h"
+
+typedef std::chrono::steady_clock Clock;
+
+#define LOOPBACK_PIXELS  512
+#define LOOPBACK_PORT    16454     // 실제 콘솔과 겹치지 않는 포트
+
+static Clock::time_point startTime;
+
+static uint64_t nowUs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime).count();
+}
+
+//================= 패킷 생성 =================
+static size_t buildArtDmx(uint8_t* p, uint16_t universe, uint8_t sequence, const uint8_t* data, uint16_t length) {
+  memcpy(p, "Art-Net", 8);
+  p[8] = 0x00;  p[9] = 0x50;            // OpDmx (리틀 엔디언)
+  p[10] = 0;    p[11] = 14;             // 프로토콜 버전
+  p[12] = sequence;
+  p[13] = 0;
+  p[14] = (uint8_t)universe;
+  p[15] = (uint8_t)(universe >> 8);
+  p[16] = (uint8_t)(length >> 8);
+  p[17] = (uint8_t)length;
+  memcpy(p + 18, data, length);
+  return 18 + length;
+}
+
+static size_t buildArtSync(uint8_t* p) {
+  memcpy(p, "Art-Net", 8);
+  p[8] = 0x00;  p[9] = 0x52;            // OpSync
+  p[10] = 0;    p[11] = 14;
+  p[12] = 0;    p[13] = 0;
+  return 14;
+}
+
+static void put16(uint8_t* p, uint16_t v) { p[0] = (uint8_t)(v >> 8); p[1] = (uint8_t)v; }
+static void put32(uint8_t* p, uint32_t v) { put16(p, (uint16_t)(v >> 16)); put16(p + 2, (uint16_t)v); }
+
+// 루트 계층 (프리앰블, ACN 식별자, 벡터, CID)
+static void buildE131Root(uint8_t* p, size_t length, uint32_t vector) {
+  static const uint8_t acnId[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+  put16(p, 0x0010);
+  put16(p + 2, 0);
+  memcpy(p + 4, acnId, 12);
+  put16(p + 16, (uint16_t)(0x7000 | (length - 16)));
+  put32(p + 18, vector);
+  memset(p + 22, 0x5A, 16);
+}
+
+static size_t buildE131Data(uint8_t* p, uint16_t universe, uint8_t sequence, uint16_t syncAddress,
+                            const uint8_t* data, uint16_t length) {
+  size_t total = 126 + length;
+  buildE131Root(p, total, 0x00000004);
+  put16(p + 38, (uint16_t)(0x7000 | (total - 38)));
+  put32(p + 40, 0x00000002);
+  memset(p + 44, 0, 64);
+  strcpy((char*)p + 44, "dmx_loopback");
+  p[108] = 100;                           // 우선순위
+  put16(p + 109, syncAddress);
+  p[111] = sequence;
+  p[112] = 0;                             // 옵션
+  put16(p + 113, universe);
+  put16(p + 115, (uint16_t)(0x7000 | (total - 115)));
+  p[117] = 0x02;
+  p[118] = 0xA1;
+  put16(p + 119, 0);
+  put16(p + 121, 1);
+  put16(p + 123, (uint16_t)(length + 1));
+  p[125] = 0;                             // 시작 코드
+  memcpy(p + 126, data, length);
+  return total;
+}
+
+static size_t buildE131Sync(uint8_t* p, uint16_t syncAddress, uint8_t sequence) {
+  buildE131Root(p, 49, 0x00000008);
+  put16(p + 38, (uint16_t)(0x7000 | (49 - 38)));
+  put32(p + 40, 0x00000001);
+  p[44] = sequence;
+  put16(p + 45, syncAddress);
+  put16(p + 47, 0);
+  return 49;
+}
+
+//================= 출력 스레드 =================
+struct ShowStats {
+  std::vector<uint32_t> latenciesUs;
+  uint32_t frames = 0;
+  uint32_t unmatched = 0;     // 보낸 기록이 없는 프레임 번호 (잘못 조립된 프레임)
+};
+
+static void showLoop(FrameRing* ring, FrameOutput* output, const std::vector<std::atomic<uint64_t>>* sentUs,
+                     ShowStats* stats) {
+  while(true) {
+    FrameSlot* slot = ring->peek();
+    if(!slot) {
+      if(ring->closed() && !(slot = ring->peek())) break;
+      if(!slot) {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+        continue;
+      }
+    }
+    size_t length;
+    const uint8_t* bytes = output->encode(*slot, &length);
+    // 논리 픽셀 0 = 스트립 0번 (GRB)
+    uint32_t frame = (uint32_t)slot->pixels[1] << 16 | (uint32_t)slot->pixels[0] << 8 | slot->pixels[2];
+    ring->release();
+    output->write(bytes, length);
+    uint64_t shown = nowUs();
+
+    stats->frames++;
+    uint64_t sent = frame < sentUs->size() ? (*sentUs)[frame].load(std::memory_order_acquire) : 0;
+    if(sent && shown >= sent) stats->latenciesUs.push_back((uint32_t)(shown - sent));
+    else stats->unmatched++;
+  }
+}
+
+int main(int argc, char** argv) {
+  bool sacn = false;
+  bool useSync = false;
+  bool flood = false;
+  int fps = 40;
+  double seconds = 3;
+  int reorder = 0;
+  int port = LOOPBACK_PORT;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--sacn") == 0) sacn = true;
+    else if(strcmp(argv[i], "--sync") == 0) useSync = true;
+    else if(strcmp(argv[i], "--flood") == 0) flood = true;
+    else if(strcmp(argv[i], "--fps") == 0 && i + 1 < argc) fps = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+    else if(strcmp(argv[i], "--reorder") == 0 && i + 1 < argc) reorder = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--port") == 0 && i + 1 < argc) port = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "Usage: %s [--sacn] [--sync] [--fps N] [--seconds S] [--reorder N] [--flood] [--port N]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+  if(fps <= 0 || seconds <= 0) {
+    fprintf(stderr, "fps / seconds는 0보다 커야 함\n");
+    return 1;
+  }
+
+  // ===== 수신 측 (렌더 데몬과 같은 구성) =====
+  DmxProtocol protocol = sacn ? DMX_SACN : DMX_ARTNET;
+  uint16_t firstUniverse = sacn ? 1 : 0;
+  FrameRing ring(flood ? 64 : 8, LOOPBACK_PIXELS);
+  DmxInput input(protocol, firstUniverse, &ring, LOOPBACK_PIXELS);
+  if(!input.open((uint16_t)port)) {
+    fprintf(stderr, "cannot listen on %d: %s\n", port, strerror(errno));
+    return 1;
+  }
+  FrameOutput output;
+  if(!output.open("/dev/null", OUTPUT_SERIAL, OUTPUT_SERIAL_BAUD)) {
+    fprintf(stderr, "cannot open /dev/null: %s\n", strerror(errno));
+    return 1;
+  }
+  uint16_t universes = input.universeCount();
+
+  // ===== 송신 소켓 =====
+  int sender = socket(AF_INET, SOCK_DGRAM, 0);
+  struct sockaddr_in target;
+  memset(&target, 0, sizeof(target));
+  target.sin_family = AF_INET;
+  target.sin_port = htons((uint16_t)port);
+  target.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  size_t maxFrames = (size_t)(flood ? 2000000 : seconds * fps + 2);
+  std::vector<std::atomic<uint64_t>> sentUs(maxFrames);
+  for(auto& s : sentUs) s.store(0);
+
+  startTime = Clock::now();
+  std::atomic<bool> stop{false};
+  ShowStats show;
+  std::thread receiver([&] {
+    while(!stop.load()) input.receive(20, nowUs);
+    while(input.receive(0, nowUs) > 0) {}
+    input.flush(nowUs());
+    ring.close();
+  });
+  std::thread shower(showLoop, &ring, &output, &sentUs, &show);
+
+  // ===== 송신 =====
+  uint8_t data[DMX_UNIVERSE_SIZE];
+  uint8_t packet[DMX_PACKET_MAX];
+  uint8_t stale[DMX_PACKET_MAX];
+  size_t staleLength = 0;
+  uint8_t sequence[DMX_MAX_UNIVERSES] = {0};
+  uint8_t syncSequence = 0;
+  uint64_t sentUniverses = 0;
+  uint32_t injected = 0;
+  size_t frame = 0;
+  uint64_t endUs = (uint64_t)(seconds * 1e6);
+
+  for(; frame < maxFrames && nowUs() < endUs; frame++) {
+    uint64_t due = (uint64_t)(frame * 1e6 / fps);
+    if(!flood) std::this_thread::sleep_until(startTime + std::chrono::microseconds(due));
+
+    for(uint16_t u = 0; u < universes; u++) {
+      for(int i = 0; i < DMX_UNIVERSE_SIZE; i++) data[i] = (uint8_t)(frame + u * 7 + i);
+      if(u == 0) {
+        data[0] = (uint8_t)(frame >> 16);
+        data[1] = (uint8_t)(frame >> 8);
+        data[2] = (uint8_t)frame;
+      }
+      uint16_t universe = firstUniverse + u;
+      uint8_t seq = ++sequence[u];
+      if(!sacn && seq == 0) seq = sequence[u] = 1;   // Art-Net 0 = 순번 없음
+      size_t length = sacn ? buildE131Data(packet, universe, seq, useSync ? 1 : 0, data, DMX_PIXELS_PER_UNIVERSE * 3)
+                           : buildArtDmx(packet, universe, seq, data, DMX_PIXELS_PER_UNIVERSE * 3);
+      if(u == 1 && reorder > 0 && frame % reorder == 0) {
+        memcpy(stale, packet, length);
+        staleLength = length;
+      }
+      // 마지막 패킷 송신 시각 = 프레임이 완성될 수 있는 가장 이른 시각
+      if(!useSync && u == universes - 1) sentUs[frame].store(nowUs(), std::memory_order_release);
+      sendto(sender, packet, length, 0, (struct sockaddr*)&target, sizeof(target));
+      sentUniverses++;
+    }
+    if(useSync) {
+      size_t length = sacn ? buildE131Sync(packet, 1, ++syncSequence) : buildArtSync(packet);
+      sentUs[frame].store(nowUs(), std::memory_order_release);
+      sendto(sender, packet, length, 0, (struct sockaddr*)&target, sizeof(target));
+    }
+    // 이전 프레임 패킷을 순서가 뒤바뀐 것처럼 다시 보냄
+    if(reorder > 0 && frame % reorder == 1 && staleLength) {
+      sendto(sender, stale, staleLength, 0, (struct sockaddr*)&target, sizeof(target));
+      injected++;
+    }
+  }
+  double sendSeconds = nowUs() / 1e6;
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  stop.store(true);
+  receiver.join();
+  shower.join();
+  close(sender);
+
+  // ===== 결과 =====
+  const DmxStats& s = input.stats();
+  printf("%s%s, %u universes/frame, %zu frames sent in %.2f s\n", sacn ? "E1.31" : "Art-Net",
+         useSync ? " + sync" : "", universes, frame, sendSeconds);
+  printf("receive  %llu packets, %llu universes, late %llu (injected %u), ignored %llu, overruns %llu, syncs %llu\n",
+         (unsigned long long)s.packets, (unsigned long long)s.universes, (unsigned long long)s.late, injected,
+         (unsigned long long)s.ignored, (unsigned long long)s.overruns, (unsigned long long)s.syncs);
+  printf("frames   %llu assembled (partial %llu), %u shown, %u unmatched\n", (unsigned long long)s.frames,
+         (unsigned long long)s.partialFrames, show.frames, show.unmatched);
+
+  if(flood) {
+    printf("rate     sent %.0f universes/s, applied %.0f universes/s (%.1f%% of sent), %.0f frames/s\n",
+           sentUniverses / sendSeconds, s.universes / sendSeconds, 100.0 * s.universes / sentUniverses,
+           show.frames / sendSeconds);
+    return 0;
+  }
+
+  std::vector<uint32_t> sorted(show.latenciesUs);
+  std::sort(sorted.begin(), sorted.end());
+  if(!sorted.empty()) {
+    printf("latency  packet -> show p50 %u us, p99 %u us, max %u us\n", sorted[sorted.size() / 2],
+           sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)], sorted.back());
+  }
+  bool ok = show.frames == frame && show.unmatched == 0 && s.late == injected && s.partialFrames == 0;
+  printf("%s\n", ok ? "ok" : "FAILED");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+// frame_output.cpp - 렌더 데몬 출력 장치
+
+#include "frame_output.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+
+// 바이트 → SPI 3바이트 (비트마다 3비트, MSB 먼저)
+struct SpiPattern {
+  uint8_t bytes[256][3];
+  SpiPattern() {
+    for(int v = 0; v < 256; v++) {
+      uint32_t bits = 0;
+      for(int b = 7; b >= 0; b--) bits = (bits << 3) | ((v >> b) & 1 ? 0x6 : 0x4);
+      bytes[v][0] = (uint8_t)(bits >> 16);
+      bytes[v][1] = (uint8_t)(bits >> 8);
+      bytes[v][2] = (uint8_t)bits;
+    }
+  }
+};
+static const SpiPattern spiPattern;
+
+FrameOutput::FrameOutput() : fd(-1), mode(OUTPUT_SERIAL), written(0) {
+}
+
+FrameOutput::~FrameOutput() {
+  close();
+}
+
+//================= 장치 열기 =================
+bool FrameOutput::open(const char* path, OutputEncoding encoding, unsigned long baud) {
+  close();
+  mode = encoding;
+  fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_NOCTTY, 0644);
+  if(fd < 0) return false;
+  if(isatty(fd) && !configureTty(baud)) return false;
+  if(mode == OUTPUT_SPI && strstr(path, "spidev") && !configureSpi()) return false;
+  return true;
+}
+
+void FrameOutput::close() {
+  if(fd >= 0) ::close(fd);
+  fd = -1;
+}
+
+bool FrameOutput::configureTty(unsigned long baud) {
+  struct termios tio;
+  if(tcgetattr(fd, &tio) != 0) return false;
+  cfmakeraw(&tio);
+  speed_t speed = baud >= 1000000 ? B1000000 : baud >= 500000 ? B500000 : baud >= 230400 ? B230400 : B115200;
+  cfsetispeed(&tio, speed);
+  cfsetospeed(&tio, speed);
+  return tcsetattr(fd, TCSANOW, &tio) == 0;
+}
+
+bool FrameOutput::configureSpi() {
+  uint8_t spiMode = SPI_MODE_0;
+  uint8_t bits = 8;
+  uint32_t hz = OUTPUT_SPI_HZ;
+  return ioctl(fd, SPI_IOC_WR_MODE, &spiMode) >= 0 &&
+         ioctl(fd, SPI_IOC_WR_BITS_PER_WORD, &bits) >= 0 &&
+         ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &hz) >= 0;
+}
+
+//================= 인코딩 =================
+const uint8_t* FrameOutput::encode(const FrameSlot& frame, size_t* length) {
+  const uint8_t* p = frame.pixels;
+  size_t bytes = (size_t)frame.pixelCount * 3;
+
+  if(mode == OUTPUT_SPI) {
+    size_t latch = OUTPUT_SPI_HZ / 8 * OUTPUT_SPI_LATCH_US / 1000000;
+    buffer.resize(bytes * 3 + latch);
+    uint8_t* out = buffer.data();
+    for(size_t i = 0; i < bytes; i++) {
+      memcpy(out, spiPattern.bytes[p[i]], 3);
+      out += 3;
+    }
+    memset(out, 0, latch);
+  } else {
+    // Adalight: 'A' 'd' 'a' hi lo (hi ^ lo ^ 0x55), 색은 RGB 순서
+    uint16_t count = frame.pixelCount ? frame.pixelCount - 1 : 0;
+    buffer.resize(6 + bytes);
+    uint8_t* out = buffer.data();
+    out[0] = 'A';
+    out[1] = 'd';
+    out[2] = 'a';
+    out[3] = (uint8_t)(count >> 8);
+    out[4] = (uint8_t)count;
+    out[5] = out[3] ^ out[4] ^ 0x55;
+    out += 6;
+    for(size_t i = 0; i < bytes; i += 3) {
+      out[i + 0] = p[i + 1];
+      out[i + 1] = p[i + 0];
+      out[i + 2] = p[i + 2];
+    }
+  }
+  *length = buffer.size();
+  return buffer.data();
+}
+
+//================= 쓰기 =================
+bool FrameOutput::write(const uint8_t* data, size_t length) {
+  while(length > 0) {
+    ssize_t n = ::write(fd, data, length);
+    if(n < 0) {
+      if(errno == EINTR) continue;
+      return false;
+    }
+    data += n;
+    length -= (size_t)n;
+    written += (uint64_t)n;
+  }
+  return true;
+}
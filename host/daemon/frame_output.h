@@ -0,0 +1,51 @@
+// frame_output.h - 렌더 데몬 출력 장치 (시리얼/spidev/파일)
+// 프레임 하나를 장치 바이트열로 인코딩해 write() 한 번으로 내보냄
+//   serial  Adalight 헤더("Ada", LED 수 - 1, 체크섬) + RGB 바이트
+//   spi     WS2812 비트를 SPI 3비트로 (1 = 110, 0 = 100, 2.4 MHz), 끝에 래치용 0 바이트
+// 장치가 tty면 raw 모드 + 보율, spidev면 모드 0 + 클럭을 설정 (일반 파일은 그대로 씀)
+
+#ifndef FRAME_OUTPUT_H
+#define FRAME_OUTPUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "frame_ring.h"
+
+#define OUTPUT_SPI_HZ        2400000UL   // 3비트 = 1.25us (WS2812 비트 시간)
+#define OUTPUT_SPI_LATCH_US  300         // 래치 (0 바이트로 채움)
+#define OUTPUT_SERIAL_BAUD   1000000UL
+
+enum OutputEncoding {
+  OUTPUT_SERIAL = 0,
+  OUTPUT_SPI
+};
+
+class FrameOutput {
+ public:
+  FrameOutput();
+  ~FrameOutput();
+
+  bool open(const char* path, OutputEncoding encoding, unsigned long baud);   // 실패 시 errno 유지
+  void close();
+
+  const uint8_t* encode(const FrameSlot& frame, size_t* length);   // 내부 버퍼 (다음 encode까지 유효)
+  bool write(const uint8_t* data, size_t length);                 // 전부 쓸 때까지 반복
+
+  uint64_t bytesWritten() const { return written; }
+
+ private:
+  FrameOutput(const FrameOutput&);
+  FrameOutput& operator=(const FrameOutput&);
+
+  bool configureTty(unsigned long baud);
+  bool configureSpi();
+
+  int fd;
+  OutputEncoding mode;
+  std::vector<uint8_t> buffer;
+  uint64_t written;
+};
+
+#endif
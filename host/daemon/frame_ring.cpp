@@ -0,0 +1,51 @@
+// frame_ring.cpp - 렌더 → 출력 프레임 링
+
+#include "frame_ring.h"
+
+FrameRing::FrameRing(size_t capacity, uint16_t maxPixels) : pixelLimit(maxPixels) {
+  size_t size = 2;
+  while(size < capacity) size <<= 1;
+  mask = size - 1;
+
+  slots.resize(size);
+  storage.assign(size * maxPixels * 3, 0);
+  for(size_t i = 0; i < size; i++) {
+    slots[i].timeUs = 0;
+    slots[i].sequence = 0;
+    slots[i].renderUs = 0;
+    slots[i].pixelCount = 0;
+    slots[i].pixels = &storage[i * maxPixels * 3];
+  }
+}
+
+//================= 생산자 =================
+FrameSlot* FrameRing::beginWrite() {
+  size_t h = head.load(std::memory_order_relaxed);
+  if(h - tail.load(std::memory_order_acquire) > mask) return 0;
+  return &slots[h & mask];
+}
+
+void FrameRing::commitWrite() {
+  head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void FrameRing::close() {
+  finished.store(true, std::memory_order_release);
+}
+
+//================= 소비자 =================
+FrameSlot* FrameRing::peek() {
+  size_t t = tail.load(std::memory_order_relaxed);
+  if(t == head.load(std::memory_order_acquire)) return 0;
+  return &slots[t & mask];
+}
+
+void FrameRing::release() {
+  tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+size_t FrameRing::depth() const {
+  size_t t = tail.load(std::memory_order_acquire);
+  size_t h = head.load(std::memory_order_acquire);
+  return h - t;
+}
@@ -0,0 +1,55 @@
+// frame_ring.h - 렌더 → 출력 프레임 링 (단일 생산자/단일 소비자, 잠금 없음)
+// 슬롯은 생성 시 한 번만 할당하고, 쓰기/읽기는 슬롯 포인터를 직접 넘겨 복사 없이 채움
+// 생산자만 head를, 소비자만 tail을 씀 (acquire/release로 슬롯 내용 공개)
+
+#ifndef FRAME_RING_H
+#define FRAME_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <vector>
+
+// ===== 슬롯 =====
+struct FrameSlot {
+  uint64_t timeUs;       // 프레임 시각 (시나리오 가상 시계, show() 시작)
+  uint32_t sequence;     // 렌더 순번
+  uint32_t renderUs;     // 이 프레임 렌더에 든 실제 시간
+  uint16_t pixelCount;
+  uint8_t* pixels;       // GRB 전송 값 (밝기 스케일 적용), 용량 maxPixels * 3
+};
+
+class FrameRing {
+ public:
+  FrameRing(size_t capacity, uint16_t maxPixels);   // capacity는 2의 거듭제곱으로 올림
+
+  // ===== 생산자 (렌더 스레드) =====
+  FrameSlot* beginWrite();     // 빈 슬롯 (가득 차면 0)
+  void commitWrite();          // beginWrite()로 받은 슬롯 공개
+  void close();                // 더 쓸 프레임 없음
+
+  // ===== 소비자 (출력 스레드) =====
+  FrameSlot* peek();           // 가장 오래된 프레임 (없으면 0)
+  void release();              // peek()한 슬롯 반환
+  bool closed() const { return finished.load(std::memory_order_acquire); }
+
+  size_t depth() const;        // 현재 들어 있는 프레임 수 (어느 쪽에서 불러도 근사값으로 안전)
+  size_t capacity() const { return slots.size(); }
+  uint16_t maxPixels() const { return pixelLimit; }
+
+ private:
+  FrameRing(const FrameRing&);
+  FrameRing& operator=(const FrameRing&);
+
+  std::vector<FrameSlot> slots;
+  std::vector<uint8_t> storage;
+  size_t mask;
+  uint16_t pixelLimit;
+
+  // 생산자/소비자 인덱스는 서로 다른 캐시 라인에 (거짓 공유 방지)
+  alignas(64) std::atomic<size_t> head{0};    // 다음에 쓸 위치 (생산자)
+  alignas(64) std::atomic<size_t> tail{0};    // 다음에 읽을 위치 (소비자)
+  alignas(64) std::atomic<bool> finished{false};
+};
+
+#endif
@@ -0,0 +1,412 @@
+// render_daemon.cpp - 리눅스 보드용 LED 렌더 데몬
+// 패널마다 렌더 스레드 하나가 스케치 시나리오를 (프리뷰와 같은 소스/가상 시계로) 실행하고
+// show()마다 프레임을 잠금 없는 SPSC 링에 넣음, 출력 스레드는 프레임 시각(실시간)에 맞춰
+// 장치 바이트열로 인코딩해 시리얼/spidev/파일에 씀
+// 렌더가 한 프레임 늦어져도 링에 쌓인 프레임으로 출력 시각이 유지됨 (링이 차면 렌더가 기다림)
+// 네트워크 패널은 렌더 스레드 대신 Art-Net/E1.31 수신 스레드가 링을 채우고, 프레임은 받는 즉시 출력
+//
+// 스트립 fill / 밝기 낮춤 / 오버레이는 NEO_HOST_COMPOSITE로 host/composite 커널(SSE2/AVX2 실행 시 선택) 사용
+//
+// 빌드:
+//   g++ -std=c++17 -O2 -pthread -DNEO_HOST_COMPOSITE -I../arduino -I../preview -o render_daemon render_daemon.cpp
+//       frame_ring.cpp frame_output.cpp dmx_input.cpp ../preview/scenario_breathing.cpp ../preview/scenario_surprise.cpp
+//       ../preview/scenario_blow.cpp ../preview/scenario_rain.cpp ../preview/scenario_companion.cpp
+//       ../composite/composite_scalar.cpp ../composite/composite_sse2.cpp ../composite/composite_avx2.cpp
+// 사용: ./render_daemon --panel NAME[=DEVICE] [--panel ...] [--net artnet|sacn[=DEVICE]] [--pty]
+//                       [--encoding serial|spi] [--baud N] [--ring N] [--speed X] [--late-ms MS]
+//                       [--pixels N] [--seed N] [--port N] [--universe N] [--seconds S]
+//   --panel     시나리오 이름 (led_preview 결과 표의 scenario), DEVICE는 출력 경로 (파일 가능)
+//   --net       네트워크 입력 패널 (--port 기본 6454/5568, --universe 첫 유니버스 기본 0/1)
+//   --seconds   네트워크 패널 수신 시간 (기본: SIGINT/SIGTERM까지)
+//   --pty       DEVICE 없는 패널은 의사 터미널을 만들어 씀 (반대쪽은 데몬이 읽어 버림, 시험용)
+//   --speed     재생 배율 (2 = 두 배 빠르게, 시험 시간 단축)
+//   --late-ms   출력 시작이 프레임 시각보다 이만큼 넘게 늦으면 늦은 프레임 (기본 2)
+// 결과: 렌더 시간(평균/표준편차/p99/최대), 최소 여유, 링 깊이, 늦은 프레임 수, 쓴 바이트
+//       네트워크 패널의 렌더 시간은 첫 유니버스 ~ 프레임 공개 시간, 패킷 통계를 추가로 출력
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+
+#ifndef NEO_HOST_COMPOSITE
+#error "render_daemon needs -DNEO_HOST_COMPOSITE (and the host/composite sources)"
+#endif
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "preview_scenarios.h"
+#include "frame_ring.h"
+#include "frame_output.h"
+#include "dmx_input.h"
+
+typedef std::chrono::steady_clock Clock;
+
+#define RING_POLL_US  200    // 링이 비었거나 찼을 때 다시 볼 간격
+#define PREROLL_US    20000  // 시작 후 첫 프레임 출력까지 (렌더가 링을 미리 채울 시간)
+
+// ===== 패널 (시나리오 + 링 + 출력 장치) =====
+// 렌더 통계는 렌더 스레드만, 출력 통계는 출력 스레드만 씀 (join 후 main이 읽음)
+struct Panel {
+  const PreviewScenario* scenario = 0;
+  std::unique_ptr<DmxInput> input;   // 네트워크 패널 (scenario 대신)
+  std::string name;
+  std::string device;
+  bool pty = false;
+  int ptyMaster = -1;
+  FrameOutput output;
+  std::unique_ptr<FrameRing> ring;
+
+  // 렌더 스레드
+  std::vector<uint32_t> renderUs;
+  int64_t minLeadUs = INT64_MAX;     // 링에 넣은 시점의 출력 시각까지 남은 시간
+  uint32_t renderMisses = 0;         // 넣는 시점에 이미 출력 시각이 지난 프레임
+  uint32_t fullWaits = 0;            // 링이 차서 기다린 횟수
+  uint32_t truncated = 0;            // --pixels보다 긴 스트립 프레임
+  Clock::time_point lastReturn;
+
+  // 출력 스레드
+  std::vector<uint32_t> depthHistogram;
+  uint32_t frames = 0;
+  uint32_t late = 0;
+  int64_t maxLateUs = 0;
+  uint32_t maxWriteUs = 0;
+  bool writeFailed = false;
+
+  // 의사 터미널 반대쪽
+  std::atomic<uint64_t> drained{0};
+};
+
+static Clock::time_point startTime;
+static double speed = 1.0;
+static int64_t lateUs = 2000;
+static volatile sig_atomic_t stopRequested = 0;
+
+static void requestStop(int) {
+  stopRequested = 1;
+}
+
+static int64_t elapsedUs(Clock::time_point from, Clock::time_point to) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+}
+
+static Clock::time_point deadlineOf(uint64_t timeUs) {
+  return startTime + std::chrono::microseconds((int64_t)(timeUs / speed));
+}
+
+//================= 렌더 스레드 =================
+// show() 훅: 직전 훅 반환 뒤 여기까지가 이 프레임 렌더 시간
+static void renderShowHook(const Adafruit_NeoPixel& strip, uint64_t timeUs, void* context) {
+  Panel* panel = (Panel*)context;
+  Clock::time_point now = Clock::now();
+  panel->renderUs.push_back((uint32_t)elapsedUs(panel->lastReturn, now));
+
+  FrameSlot* slot;
+  while(!(slot = panel->ring->beginWrite())) {
+    panel->fullWaits++;
+    std::this_thread::sleep_for(std::chrono::microseconds(RING_POLL_US));
+  }
+  uint16_t count = strip.numPixels();
+  if(count > panel->ring->maxPixels()) {
+    count = panel->ring->maxPixels();
+    panel->truncated++;
+  }
+  slot->timeUs = timeUs;
+  slot->sequence = (uint32_t)panel->renderUs.size() - 1;
+  slot->renderUs = panel->renderUs.back();
+  slot->pixelCount = count;
+  memcpy(slot->pixels, strip.getPixels(), (size_t)count * 3);
+  panel->ring->commitWrite();
+
+  panel->lastReturn = Clock::now();
+  int64_t lead = elapsedUs(panel->lastReturn, deadlineOf(timeUs));
+  if(lead < panel->minLeadUs) panel->minLeadUs = lead;
+  if(lead < 0) panel->renderMisses++;
+}
+
+static void renderLoop(Panel* panel, uint32_t seed) {
+  hostSetMicros(0);
+  randomSeed(1);
+  hostShowContext = panel;
+  hostShowHook = renderShowHook;
+  panel->lastReturn = Clock::now();
+  panel->scenario->run(seed);
+  hostShowHook = 0;
+  panel->ring->close();
+}
+
+//================= 네트워크 수신 스레드 =================
+// 프레임 시각 = 공개 시각 (배율 적용 시계), 출력 스레드가 바로 내보냄
+static uint64_t networkClockUs() {
+  int64_t now = elapsedUs(startTime, Clock::now());
+  return now > 0 ? (uint64_t)(now * speed) : 0;
+}
+
+static void networkLoop(Panel* panel, double seconds) {
+  while(!stopRequested && !(seconds > 0 && networkClockUs() > seconds * speed * 1e6)) {
+    if(panel->input->receive(50, networkClockUs) < 0) {
+      fprintf(stderr, "%s: receive failed: %s\n", panel->name.c_str(), strerror(errno));
+      break;
+    }
+  }
+  panel->input->flush(networkClockUs());
+  panel->ring->close();
+}
+
+//================= 출력 스레드 =================
+static void outputLoop(Panel* panel) {
+  FrameRing& ring = *panel->ring;
+  panel->depthHistogram.assign(ring.capacity() + 1, 0);
+
+  while(true) {
+    FrameSlot* slot = ring.peek();
+    if(!slot) {
+      if(ring.closed() && !(slot = ring.peek())) break;   // 닫힌 뒤 한 번 더 확인 (마지막 프레임)
+      if(!slot) {
+        std::this_thread::sleep_for(std::chrono::microseconds(RING_POLL_US));
+        continue;
+      }
+    }
+    panel->depthHistogram[ring.depth()]++;
+    if(panel->input) panel->renderUs.push_back(slot->renderUs);   // 수신 패널: 조립 시간 (렌더 스레드 없음)
+
+    Clock::time_point deadline = deadlineOf(slot->timeUs);
+    std::this_thread::sleep_until(deadline);
+    Clock::time_point begin = Clock::now();
+    int64_t lateness = elapsedUs(deadline, begin);
+    if(lateness > lateUs) panel->late++;
+    if(lateness > panel->maxLateUs) panel->maxLateUs = lateness;
+
+    size_t length;
+    const uint8_t* bytes = panel->output.encode(*slot, &length);
+    ring.release();
+    if(!panel->writeFailed && !panel->output.write(bytes, length)) {
+      fprintf(stderr, "%s: write failed: %s\n", panel->device.c_str(), strerror(errno));
+      panel->writeFailed = true;
+    }
+    uint32_t writeUs = (uint32_t)elapsedUs(begin, Clock::now());
+    if(writeUs > panel->maxWriteUs) panel->maxWriteUs = writeUs;
+    panel->frames++;
+  }
+  panel->output.close();
+}
+
+//================= 의사 터미널 =================
+static bool openPty(Panel* panel) {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if(master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) return false;
+  panel->ptyMaster = master;
+  panel->device = ptsname(master);
+  return true;
+}
+
+// 반대쪽(장치 역할)에서 읽어 버림: 출력 쪽이 닫히면 EIO로 끝남
+static void drainPty(Panel* panel) {
+  uint8_t buffer[4096];
+  while(true) {
+    struct pollfd p = { panel->ptyMaster, POLLIN, 0 };
+    if(poll(&p, 1, 100) < 0 && errno != EINTR) break;
+    ssize_t n = read(panel->ptyMaster, buffer, sizeof(buffer));
+    if(n > 0) panel->drained += (uint64_t)n;
+    else if(n < 0 && errno != EAGAIN && errno != EINTR) break;
+  }
+  close(panel->ptyMaster);
+}
+
+//================= 통계 =================
+static void printPanel(const Panel& panel) {
+  std::vector<uint32_t> sorted(panel.renderUs);
+  std::sort(sorted.begin(), sorted.end());
+  double mean = 0, var = 0;
+  for(uint32_t v : sorted) mean += v;
+  if(!sorted.empty()) mean /= sorted.size();
+  for(uint32_t v : sorted) var += (v - mean) * (v - mean);
+  if(!sorted.empty()) var /= sorted.size();
+  uint32_t p99 = sorted.empty() ? 0 : sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)];
+  uint32_t maxRender = sorted.empty() ? 0 : sorted.back();
+
+  double depthMean = 0;
+  size_t depthMax = 0;
+  for(size_t d = 0; d < panel.depthHistogram.size(); d++) {
+    depthMean += (double)d * panel.depthHistogram[d];
+    if(panel.depthHistogram[d]) depthMax = d;
+  }
+  if(panel.frames) depthMean /= panel.frames;
+
+  printf("%s -> %s\n", panel.name.c_str(), panel.device.c_str());
+  if(panel.input) {
+    const DmxStats& s = panel.input->stats();
+    printf("  network  %llu packets, %llu universes, late %llu, ignored %llu, overruns %llu, syncs %llu, "
+           "frames %llu (partial %llu)\n", (unsigned long long)s.packets, (unsigned long long)s.universes,
+           (unsigned long long)s.late, (unsigned long long)s.ignored, (unsigned long long)s.overruns,
+           (unsigned long long)s.syncs, (unsigned long long)s.frames, (unsigned long long)s.partialFrames);
+  }
+  printf("  %s %u frames, mean %.0f us, jitter(sd) %.0f us, p99 %u us, max %u us\n",
+         panel.input ? "assembly" : "render  ", (unsigned)sorted.size(), mean, sqrt(var), p99, maxRender);
+  if(!panel.input) {
+    printf("  lead     min %.1f ms, render misses %u, ring full waits %u%s\n", panel.minLeadUs / 1000.0,
+           panel.renderMisses, panel.fullWaits, panel.truncated ? ", truncated frames" : "");
+  }
+  printf("  ring     depth mean %.2f, max %zu / %zu\n", depthMean, depthMax, panel.depthHistogram.size() - 1);
+  printf("  output   %u frames, late %u (>%.1f ms), max late %.2f ms, max write %.2f ms, %llu bytes",
+         panel.frames, panel.late, lateUs / 1000.0, panel.maxLateUs / 1000.0, panel.maxWriteUs / 1000.0,
+         (unsigned long long)panel.output.bytesWritten());
+  if(panel.pty) printf(" (pty read %llu)", (unsigned long long)panel.drained.load());
+  printf("%s\n", panel.writeFailed ? ", WRITE FAILED" : "");
+}
+
+static const PreviewScenario* findScenario(const std::string& name) {
+  const PreviewScenario* (*lists[])(int*) = {
+    breathingScenarios, surpriseScenarios, blowScenarios, rainScenarios, companionScenarios
+  };
+  for(auto list : lists) {
+    int count;
+    const PreviewScenario* scenarios = list(&count);
+    for(int i = 0; i < count; i++) {
+      if(name == scenarios[i].name) return &scenarios[i];
+    }
+  }
+  return 0;
+}
+
+static void usage(const char* argv0) {
+  fprintf(stderr, "Usage: %s --panel NAME[=DEVICE] [--panel ...] [--net artnet|sacn[=DEVICE]] [--pty]\n"
+                  "       [--encoding serial|spi] [--baud N] [--ring N] [--speed X] [--late-ms MS]\n"
+                  "       [--pixels N] [--seed N] [--port N] [--universe N] [--seconds S]\n", argv0);
+}
+
+int main(int argc, char** argv) {
+  std::vector<std::unique_ptr<Panel>> panels;
+  bool pty = false;
+  OutputEncoding encoding = OUTPUT_SERIAL;
+  unsigned long baud = OUTPUT_SERIAL_BAUD;
+  size_t ringSize = 8;
+  int maxPixels = 512;
+  uint32_t seed = 0;
+  int port = 0;
+  int universe = -1;
+  double seconds = 0;
+
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--panel") == 0 && i + 1 < argc) {
+      std::string arg = argv[++i];
+      size_t eq = arg.find('=');
+      std::unique_ptr<Panel> panel(new Panel);
+      panel->scenario = findScenario(arg.substr(0, eq));
+      if(!panel->scenario) {
+        fprintf(stderr, "unknown scenario: %s\n", arg.substr(0, eq).c_str());
+        return 1;
+      }
+      for(const auto& other : panels) {
+        // 같은 시나리오는 네임스페이스 정적 변수를 공유하므로 동시에 두 번 실행할 수 없음
+        if(other->scenario == panel->scenario) {
+          fprintf(stderr, "scenario used twice: %s\n", panel->scenario->name);
+          return 1;
+        }
+      }
+      if(eq != std::string::npos) panel->device = arg.substr(eq + 1);
+      panel->name = panel->scenario->name;
+      panels.push_back(std::move(panel));
+    }
+    else if(strcmp(argv[i], "--net") == 0 && i + 1 < argc) {
+      std::string arg = argv[++i];
+      size_t eq = arg.find('=');
+      std::string kind = arg.substr(0, eq);
+      if(kind != "artnet" && kind != "sacn") { usage(argv[0]); return 1; }
+      std::unique_ptr<Panel> panel(new Panel);
+      panel->name = kind;
+      if(eq != std::string::npos) panel->device = arg.substr(eq + 1);
+      panels.push_back(std::move(panel));
+    }
+    else if(strcmp(argv[i], "--pty") == 0) pty = true;
+    else if(strcmp(argv[i], "--encoding") == 0 && i + 1 < argc) {
+      const char* name = argv[++i];
+      if(strcmp(name, "serial") == 0) encoding = OUTPUT_SERIAL;
+      else if(strcmp(name, "spi") == 0) encoding = OUTPUT_SPI;
+      else { usage(argv[0]); return 1; }
+    }
+    else if(strcmp(argv[i], "--baud") == 0 && i + 1 < argc) baud = strtoul(argv[++i], 0, 10);
+    else if(strcmp(argv[i], "--ring") == 0 && i + 1 < argc) ringSize = strtoul(argv[++i], 0, 10);
+    else if(strcmp(argv[i], "--speed") == 0 && i + 1 < argc) speed = atof(argv[++i]);
+    else if(strcmp(argv[i], "--late-ms") == 0 && i + 1 < argc) lateUs = (int64_t)(atof(argv[++i]) * 1000);
+    else if(strcmp(argv[i], "--pixels") == 0 && i + 1 < argc) maxPixels = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc) seed = strtoul(argv[++i], 0, 0);
+    else if(strcmp(argv[i], "--port") == 0 && i + 1 < argc) port = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--universe") == 0 && i + 1 < argc) universe = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+    else { usage(argv[0]); return 1; }
+  }
+  if(panels.empty() || speed <= 0 || ringSize < 2 || maxPixels < 1 || maxPixels > 65535) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  // ===== 장치 열기 =====
+  for(auto& panel : panels) {
+    if(panel->device.empty()) {
+      if(!pty) {
+        fprintf(stderr, "%s: no device (use NAME=DEVICE or --pty)\n", panel->name.c_str());
+        return 1;
+      }
+      if(!openPty(panel.get())) {
+        fprintf(stderr, "cannot create pty: %s\n", strerror(errno));
+        return 1;
+      }
+      panel->pty = true;
+    }
+    if(!panel->output.open(panel->device.c_str(), encoding, baud)) {
+      fprintf(stderr, "cannot open %s: %s\n", panel->device.c_str(), strerror(errno));
+      return 1;
+    }
+    panel->ring.reset(new FrameRing(ringSize, (uint16_t)maxPixels));
+
+    if(!panel->scenario) {
+      DmxProtocol protocol = panel->name == "artnet" ? DMX_ARTNET : DMX_SACN;
+      uint16_t first = universe >= 0 ? (uint16_t)universe : (protocol == DMX_ARTNET ? 0 : 1);
+      panel->input.reset(new DmxInput(protocol, first, panel->ring.get(), (uint16_t)maxPixels));
+      if(!panel->input->open((uint16_t)port)) {
+        fprintf(stderr, "%s: cannot listen: %s\n", panel->name.c_str(), strerror(errno));
+        return 1;
+      }
+      char label[64];
+      snprintf(label, sizeof(label), " (universe %u-%u)", first, first + panel->input->universeCount() - 1);
+      panel->name += label;
+    }
+  }
+  signal(SIGINT, requestStop);
+  signal(SIGTERM, requestStop);
+
+  // ===== 실행: 패널마다 렌더/출력 스레드 (+ 의사 터미널 읽기) =====
+  startTime = Clock::now() + std::chrono::microseconds(PREROLL_US);
+  std::vector<std::thread> threads;
+  for(auto& panel : panels) {
+    Panel* p = panel.get();
+    if(p->scenario) threads.emplace_back(renderLoop, p, seed);
+    else threads.emplace_back(networkLoop, p, seconds);
+    threads.emplace_back(outputLoop, p);
+    if(p->pty) threads.emplace_back(drainPty, p);
+  }
+  for(std::thread& t : threads) t.join();
+
+  // ===== 결과 =====
+  bool failed = false;
+  printf("%zu panel(s), ring %zu, speed %.2fx, %s, composite %s, %.1f s\n\n", panels.size(),
+         panels[0]->ring->capacity(), speed, encoding == OUTPUT_SPI ? "spi" : "serial", compositeBest().name,
+         elapsedUs(startTime, Clock::now()) / 1e6);
+  for(const auto& panel : panels) {
+    printPanel(*panel);
+    failed |= panel->writeFailed;
+  }
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,252 @@
+// dxl_host_player.cpp - 모션 플레이어를 시뮬레이션 버스로 실행하는 호스트 도구
+// 펌웨어와 같은 dxl_protocol.cpp / motion_player.cpp를 가상 시계로 실행하고
+// 프레임별 패킷 생성 시간, 버스 점유율, 추종 오차를 출력
+// --telemetry: 전송 프레임마다 모터별 목표/현재 위치와 생성 시간을 바이너리 로그로 기록 (telemetry_analyze로 분석)
+// --profiles: 구간별 프로파일 속도/가속도를 계산해 목표와 함께 전송 (motion_profiler.cpp)
+//
+// 빌드 (FW = ../../Scenario_motion/samsung_motion_player/samsung_motion_player):
+//   g++ -std=c++17 -O2 -pthread -I../arduino -I$FW -o dxl_host_player dxl_host_player.cpp
+//       dxl_sim_bus.cpp motion_json.cpp $FW/dxl_protocol.cpp $FW/motion_player.cpp
+//       $FW/motion_resampler.cpp $FW/motion_keyframes.cpp motion_decimator.cpp telemetry_recorder.cpp
+//       motion_profiler.cpp
+// 사용: ./dxl_host_player <motion.json> [--csv] [--rate HZ] [--mode linear|hermite|monotone]
+//         [--keyframes TOL] [--telemetry FILE] [--profiles]
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "dxl_protocol.h"
+#include "motion_player.h"
+#include "dxl_sim_bus.h"
+#include "motion_json.h"
+#include "host_track.h"
+#include "motion_decimator.h"
+#include "telemetry_recorder.h"
+#include "motion_profiler.h"
+
+#define SIM_STEP_US 500    // 시뮬레이션 시간 간격 (0.5ms)
+
+int main(int argc, char** argv) {
+  if(argc < 2) {
+    fprintf(stderr, "Usage: %s <motion.json> [--csv] [--rate HZ] [--mode linear|hermite|monotone] "
+                    "[--keyframes TOL] [--telemetry FILE] [--profiles]\n", argv[0]);
+    return 1;
+  }
+
+  bool csv = false;
+  uint16_t rateHz = 0;
+  int mode = RESAMPLE_MONOTONE;
+  int keyTolerance = -1;
+  const char* telemetryPath = 0;
+  bool profiles = false;
+  for(int i = 2; i < argc; i++) {
+    if(strcmp(argv[i], "--csv") == 0) {
+      csv = true;
+    } else if(strcmp(argv[i], "--profiles") == 0) {
+      profiles = true;
+    } else if(strcmp(argv[i], "--rate") == 0 && i + 1 < argc) {
+      rateHz = (uint16_t)atoi(argv[++i]);
+    } else if(strcmp(argv[i], "--keyframes") == 0 && i + 1 < argc) {
+      keyTolerance = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "--telemetry") == 0 && i + 1 < argc) {
+      telemetryPath = argv[++i];
+    } else if(strcmp(argv[i], "--mode") == 0 && i + 1 < argc) {
+      mode = parseResampleMode(argv[++i]);
+      if(mode < 0) {
+        fprintf(stderr, "Unknown mode %s\n", argv[i]);
+        return 1;
+      }
+    }
+  }
+
+  MotionClip clip;
+  if(!loadMotionClip(argv[1], clip)) return 1;
+  if(clip.motorIds.size() > DXL_MAX_MOTORS) {
+    fprintf(stderr, "Too many motors (%zu > %d)\n", clip.motorIds.size(), DXL_MAX_MOTORS);
+    return 1;
+  }
+
+  HostTrack host;
+  makeHostTrack(clip, host);
+  size_t motors = clip.motorIds.size();
+  size_t frames = clip.frameCount();
+  const MotionTrack& track = host.track;
+
+  // 프로파일 모드: 트랙에 구간별 프로파일을 붙여 재생 (키프레임 트랙에는 없음)
+  std::vector<uint16_t> profileData;
+  if(profiles) {
+    if(keyTolerance >= 0) {
+      fprintf(stderr, "--profiles cannot be combined with --keyframes\n");
+      return 1;
+    }
+    ProfileSettings settings;
+    ProfileStats profileStats;
+    defaultProfileSettings(settings);
+    profileTrack(track, settings, profileData, profileStats);
+    host.track.profiles = profileData.data();
+    fprintf(stderr, "Profiles: max velocity %u, max acceleration %u, %zu/%zu clamped\n",
+            profileStats.maxVelocity, profileStats.maxAcceleration,
+            profileStats.velocityClamped, profileStats.entries);
+  }
+
+  // 추종 오차 기준: 작성된 프레임을 선형으로 이은 궤적
+  MotionResampler reference;
+  initResampler(reference, &track, RESAMPLE_LINEAR);
+  int32_t referenceOffsets[RESAMPLE_LANES];
+
+  simBusInit(clip.motorIds.data(), motors);
+  dxlBegin(simBusReceive);
+  // 키프레임 모드: 감축한 트랙을 재생 (정지 구간은 전송 생략)
+  KeyframeData keys;
+  if(keyTolerance >= 0) {
+    decimateTrack(track, keyTolerance, keys);
+    initMotionPlayerKeyframes(&keys.track);
+    fprintf(stderr, "Keyframes: %zu (tolerance %d units)\n", keys.keyFrames.size(), keyTolerance);
+  } else {
+    initMotionPlayer(&track);
+  }
+  setupMotionMotors(DXL_PROFILE_VELOCITY);
+  setMotionControlRate(rateHz, mode);
+  startMotionPlayback();
+
+  // 재생 시작 기준 시각 / 전송 간격 (제어 주기를 쓰면 틱 간격)
+  uint32_t startUs = micros();
+  uint32_t intervalUs = rateHz ? 1000000UL / rateHz : track.frameIntervalUs;
+  TelemetryRecorder telemetry;
+  if(telemetryPath && !telemetry.open(telemetryPath, clip.motorIds.data(), motors, intervalUs)) return 1;
+  double maxRecordNs = 0, sumRecordNs = 0;
+  bool telemetryPending = false;
+  TelemetrySample pendingSample;
+  int32_t pendingTargets[DXL_MAX_MOTORS];
+
+  if(csv) printf("frame,bytes,build_ns,wire_us,bus_load_permille,max_error\n");
+
+  uint32_t sentFrames = 0;
+  double maxBuildNs = 0, sumBuildNs = 0;
+  uint32_t maxLoad = 0;
+  int32_t maxError = 0;
+  double sumSquaredError = 0;
+  uint64_t errorSamples = 0;
+
+  // 스텝마다 측정: 기준 궤적 대비 경로 오차, 서보 가속도 (멈췄다 가는 움직임일수록 큼)
+  double maxPathError = 0, sumSquaredPath = 0, sumSquaredAccel = 0;
+  uint64_t pathSamples = 0;
+  std::vector<double> lastVelocity(motors, 0.0);
+
+  while(!isMotionPlaybackComplete()) {
+    // 패킷 생성+전송 시간은 실제 시계로 측정 (가상 시계는 멈춰 있음)
+    auto t0 = std::chrono::steady_clock::now();
+    bool sent = updateMotionPlayback();
+    auto t1 = std::chrono::steady_clock::now();
+
+    if(sent) {
+      const MotionFrameStats& stats = getMotionFrameStats();
+      double buildNs = std::chrono::duration<double, std::nano>(t1 - t0).count();
+
+      // 기준 궤적 대비 현재 위치 오차 (전송 시점)
+      int32_t frameError = 0;
+      resampleAt(reference, micros() - startUs, referenceOffsets);
+      for(size_t m = 0; m < motors; m++) {
+        SimServo* servo = simBusServo(clip.motorIds[m]);
+        double error = fabs(referenceOffsets[m] - servo->presentPosition);
+        sumSquaredError += error * error;
+        errorSamples++;
+        if(lround(error) > frameError) frameError = (int32_t)lround(error);
+      }
+
+      // 텔레메트리는 목표만 잡아 두고 현재 위치는 한 스텝(0.5ms) 뒤에 읽음 (재생 스크립트의 읽기 순서와 같음)
+      if(telemetryPath) {
+        telemetryPending = true;
+        pendingSample.timeUs = micros() - startUs;
+        pendingSample.frame = stats.frame;
+        pendingSample.buildNs = (uint32_t)buildNs;
+        pendingSample.lateUs = pendingSample.timeUs - stats.frame * intervalUs;
+        pendingSample.flags = 0;
+        pendingSample.reserved = 0;
+        for(size_t m = 0; m < motors; m++) {
+          pendingTargets[m] = simBusServo(clip.motorIds[m])->goalPosition;
+        }
+      }
+
+      sentFrames++;
+      sumBuildNs += buildNs;
+      if(buildNs > maxBuildNs) maxBuildNs = buildNs;
+      if(stats.busLoadPermille > maxLoad) maxLoad = stats.busLoadPermille;
+      if(frameError > maxError) maxError = frameError;
+
+      if(csv) {
+        printf("%u,%u,%.0f,%u,%u,%d\n", stats.frame, stats.packetBytes, buildNs,
+               stats.wireUs, stats.busLoadPermille, frameError);
+      }
+    }
+
+    simBusStep(SIM_STEP_US);
+    hostAdvanceMicros(SIM_STEP_US);
+
+    resampleAt(reference, micros() - startUs, referenceOffsets);
+    for(size_t m = 0; m < motors; m++) {
+      SimServo* servo = simBusServo(clip.motorIds[m]);
+      double error = fabs(referenceOffsets[m] - servo->presentPosition);
+      double accel = (servo->presentVelocity - lastVelocity[m]) / (SIM_STEP_US / 1000000.0);
+      lastVelocity[m] = servo->presentVelocity;
+      if(error > maxPathError) maxPathError = error;
+      sumSquaredPath += error * error;
+      sumSquaredAccel += accel * accel;
+      pathSamples++;
+    }
+
+    if(telemetryPending) {
+      auto r0 = std::chrono::steady_clock::now();
+      for(size_t m = 0; m < motors; m++) {
+        pendingSample.motorIndex = (uint8_t)m;
+        pendingSample.target = pendingTargets[m];
+        pendingSample.actual = (int32_t)lround(simBusServo(clip.motorIds[m])->presentPosition);
+        telemetry.record(pendingSample);
+      }
+      double recordNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - r0).count();
+      sumRecordNs += recordNs;
+      if(recordNs > maxRecordNs) maxRecordNs = recordNs;
+      telemetryPending = false;
+    }
+  }
+
+  bool telemetryOk = true;
+  if(telemetryPath) {
+    telemetryOk = telemetry.close();
+    fprintf(stderr, "Telemetry: %llu samples (%zu bytes each), %llu dropped, ring high water %zu/%zu, "
+                    "record avg %.0f ns, max %.0f ns per frame\n",
+            (unsigned long long)telemetry.recorded(), sizeof(TelemetrySample),
+            (unsigned long long)telemetry.dropped(), telemetry.highWater(), telemetry.capacity(),
+            sentFrames ? sumRecordNs / sentFrames : 0.0, maxRecordNs);
+  }
+
+  const SimBusStats& bus = simBusStats();
+  fprintf(stderr, "=== %s ===\n", argv[1]);
+  fprintf(stderr, "Frames: %u sent (%zu authored, %u Hz), %u skipped, %u held\n",
+          sentFrames, frames, rateHz ? rateHz : (unsigned)lround(clip.fps),
+          getMotionFrameStats().skippedFrames, getMotionFrameStats().heldFrames);
+  fprintf(stderr, "Packets: %u (sync write %u, write %u), %llu bytes\n",
+          bus.packets, bus.syncWrites, bus.writes, (unsigned long long)bus.bytes);
+  fprintf(stderr, "Build: avg %.0f ns, max %.0f ns (host)\n",
+          sentFrames ? sumBuildNs / sentFrames : 0.0, maxBuildNs);
+  fprintf(stderr, "Bus load: max %u permille\n", maxLoad);
+  fprintf(stderr, "Tracking error: max %d units, rms %.1f units\n",
+          maxError, errorSamples ? sqrt(sumSquaredError / errorSamples) : 0.0);
+  fprintf(stderr, "Path error (every %u us): max %.0f units, rms %.1f units\n",
+          SIM_STEP_US, maxPathError, pathSamples ? sqrt(sumSquaredPath / pathSamples) : 0.0);
+  fprintf(stderr, "Servo acceleration: rms %.0f units/s^2\n",
+          pathSamples ? sqrt(sumSquaredAccel / pathSamples) : 0.0);
+
+  // 프로토콜 오류나 누락 프레임이 있으면 실패
+  size_t expected = rateHz ? resampleDurationUs(&track) / (1000000UL / rateHz) + 1 : frames;
+  expected -= getMotionFrameStats().heldFrames;
+  if(bus.crcErrors || bus.formatErrors || bus.syncWrites != sentFrames || sentFrames != expected || !telemetryOk) {
+    fprintf(stderr, "FAILED: crc %u, format %u\n", bus.crcErrors, bus.formatErrors);
+    return 1;
+  }
+  return 0;
+}
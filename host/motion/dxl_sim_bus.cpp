@@ -0,0 +1,287 @@
+// dxl_sim_bus.cpp - 다이나믹셀 버스 시뮬레이터 구현
+// 패킷 헤더/CRC/스터핑을 검증하고 WRITE, SYNC_WRITE를 가상 컨트롤 테이블에 반영
+// SYNC_READ / FAST_SYNC_READ는 현재 위치 응답 바이트를 만들어 둠 (도착 시각은 호출 측이 계산)
+
+#include "dxl_sim_bus.h"
+#include "dxl_protocol.h"
+
+#include <math.h>
+#include <string.h>
+
+// ================= 버스 상태 =================
+static SimServo servos[SIM_MAX_SERVOS];
+static size_t servoCount = 0;
+static SimBusStats busStats;
+static SimBusResponse response;
+
+//================= 버스 함수 =================
+void simBusInit(const uint8_t* ids, size_t count) {
+  memset(&busStats, 0, sizeof(busStats));
+  response.length = 0;
+  response.packetCount = 0;
+  servoCount = (count < SIM_MAX_SERVOS) ? count : SIM_MAX_SERVOS;
+  for(size_t i = 0; i < servoCount; i++) {
+    memset(&servos[i], 0, sizeof(SimServo));
+    servos[i].id = ids[i];
+  }
+}
+
+SimServo* simBusServo(uint8_t id) {
+  for(size_t i = 0; i < servoCount; i++) {
+    if(servos[i].id == id) return &servos[i];
+  }
+  return 0;
+}
+
+const SimBusStats& simBusStats() {
+  return busStats;
+}
+
+const SimBusResponse& simBusResponse() {
+  return response;
+}
+
+// 리틀 엔디안 값 읽기
+static uint32_t readLE(const uint8_t* p, uint16_t length) {
+  uint32_t value = 0;
+  for(uint16_t i = 0; i < length && i < 4; i++) {
+    value |= (uint32_t)p[i] << (8 * i);
+  }
+  return value;
+}
+
+// 시뮬레이션하는 레지스터 크기 (0 = 무시)
+static uint16_t registerSize(uint16_t address) {
+  switch(address) {
+    case ADDR_TORQUE_ENABLE:
+    case ADDR_OPERATING_MODE:       return 1;
+    case ADDR_PROFILE_ACCELERATION:
+    case ADDR_PROFILE_VELOCITY:
+    case ADDR_GOAL_POSITION:        return 4;
+    default:                        return 0;
+  }
+}
+
+// 컨트롤 테이블 쓰기 (연속 범위면 범위 안의 레지스터를 모두 반영, 예: 108~119)
+static void writeControlTable(SimServo* servo, uint16_t address, const uint8_t* data, uint16_t length) {
+  if(servo == 0) return;
+
+  uint16_t i = 0;
+  while(i < length) {
+    uint16_t size = registerSize(address + i);
+    if(size == 0 || i + size > length) {
+      i++;
+      continue;
+    }
+    uint32_t value = readLE(data + i, size);
+    switch(address + i) {
+      case ADDR_TORQUE_ENABLE:        servo->torque = (value != 0); break;
+      case ADDR_OPERATING_MODE:       servo->operatingMode = value; break;
+      case ADDR_PROFILE_ACCELERATION: servo->profileAcceleration = value; break;
+      case ADDR_PROFILE_VELOCITY:     servo->profileVelocity = value; break;
+      case ADDR_GOAL_POSITION:        servo->goalPosition = (int32_t)value; break;
+      default: break;
+    }
+    i += size;
+  }
+}
+
+//================= 읽기 응답 =================
+// 상태 패킷 하나를 응답 버퍼 끝에 추가 (params는 스터핑 전, 길이/CRC는 여기서 채움)
+static void appendStatus(uint8_t id, const uint8_t* params, uint16_t paramLength) {
+  uint8_t packet[SIM_RESPONSE_MAX];
+  uint16_t n = 0;
+  packet[n++] = 0xFF;
+  packet[n++] = 0xFF;
+  packet[n++] = 0xFD;
+  packet[n++] = 0x00;
+  packet[n++] = id;
+  n += 2;
+  packet[n++] = DXL_INST_STATUS;
+  for(uint16_t i = 0; i < paramLength && n + 3 < (uint16_t)sizeof(packet); i++) {
+    packet[n++] = params[i];
+    if(params[i] == 0xFD && n >= 4 && packet[n - 3] == 0xFF && packet[n - 2] == 0xFF && n - 3 >= 8) {
+      packet[n++] = 0xFD;    // 스터핑
+    }
+  }
+  uint16_t packetLength = n - 7 + 2;
+  packet[5] = packetLength & 0xFF;
+  packet[6] = packetLength >> 8;
+  uint16_t crc = dxlUpdateCRC(0, packet, n);
+  packet[n++] = crc & 0xFF;
+  packet[n++] = crc >> 8;
+
+  if(response.length + n > SIM_RESPONSE_MAX || response.packetCount >= SIM_MAX_SERVOS) return;
+  memcpy(response.bytes + response.length, packet, n);
+  response.length += n;
+  response.packetEnd[response.packetCount++] = response.length;
+}
+
+static void putPosition(uint8_t* p, const SimServo* servo) {
+  uint32_t v = (uint32_t)(int32_t)lround(servo->presentPosition);
+  p[0] = v & 0xFF;
+  p[1] = (v >> 8) & 0xFF;
+  p[2] = (v >> 16) & 0xFF;
+  p[3] = (v >> 24) & 0xFF;
+}
+
+// 현재 위치(132, 4바이트) 읽기만 지원, 없는 ID는 응답하지 않음
+// Fast Sync Read의 서보별 중간 CRC는 스터핑 전 바이트 기준 누적값 (길이 필드는 스터핑 없다고 가정)
+static void buildReadResponse(bool fast, const uint8_t* params, uint16_t paramLength) {
+  uint16_t address = readLE(params, 2);
+  uint16_t dataLength = readLE(params + 2, 2);
+  if(address != ADDR_PRESENT_POSITION || dataLength != 4) return;
+
+  if(!fast) {
+    for(uint16_t p = 4; p < paramLength; p++) {
+      SimServo* servo = simBusServo(params[p]);
+      if(servo == 0) continue;
+      uint8_t status[5] = { 0 };
+      putPosition(status + 1, servo);
+      appendStatus(servo->id, status, sizeof(status));
+    }
+    return;
+  }
+
+  uint8_t body[SIM_MAX_SERVOS * 8];
+  uint16_t n = 0;
+  uint16_t count = 0;
+  for(uint16_t p = 4; p < paramLength && count < SIM_MAX_SERVOS; p++) {
+    if(simBusServo(params[p])) count++;
+  }
+  uint16_t packetLength = 1 + count * 8;
+  uint8_t head[8] = { 0xFF, 0xFF, 0xFD, 0x00, DXL_BROADCAST_ID,
+                      (uint8_t)(packetLength & 0xFF), (uint8_t)(packetLength >> 8), DXL_INST_STATUS };
+  uint16_t crc = dxlUpdateCRC(0, head, sizeof(head));
+  uint16_t done = 0;
+  for(uint16_t p = 4; p < paramLength && done < count; p++) {
+    SimServo* servo = simBusServo(params[p]);
+    if(servo == 0) continue;
+    uint8_t* block = body + n;
+    block[0] = 0;
+    block[1] = servo->id;
+    putPosition(block + 2, servo);
+    n += 6;
+    crc = dxlUpdateCRC(crc, block, 6);
+    if(++done < count) {
+      body[n++] = crc & 0xFF;
+      body[n++] = crc >> 8;
+      crc = dxlUpdateCRC(crc, body + n - 2, 2);
+    }
+  }
+  if(count > 0) appendStatus(DXL_BROADCAST_ID, body, n);
+}
+
+// 패킷 수신 (헤더, 길이, CRC, 스터핑 검증 후 명령 처리)
+void simBusReceive(const uint8_t* data, uint16_t length) {
+  busStats.bytes += length;
+  response.length = 0;
+  response.packetCount = 0;
+
+  if(length < 10 || data[0] != 0xFF || data[1] != 0xFF || data[2] != 0xFD || data[3] != 0x00) {
+    busStats.formatErrors++;
+    return;
+  }
+
+  uint16_t packetLength = data[5] | (data[6] << 8);
+  if(packetLength + 7 != length) {
+    busStats.formatErrors++;
+    return;
+  }
+
+  uint16_t crc = data[length - 2] | (data[length - 1] << 8);
+  if(dxlUpdateCRC(0, data, length - 2) != crc) {
+    busStats.crcErrors++;
+    return;
+  }
+
+  // 스터핑 제거 (FF FF FD 뒤의 FD 삭제)
+  uint8_t body[1024];
+  uint16_t bodyLength = 0;
+  if(length - 9 > (int)sizeof(body)) {
+    busStats.formatErrors++;
+    return;
+  }
+  for(uint16_t i = 7; i < length - 2; i++) {
+    body[bodyLength++] = data[i];
+    if(bodyLength >= 3 && body[bodyLength - 3] == 0xFF && body[bodyLength - 2] == 0xFF &&
+       body[bodyLength - 1] == 0xFD) {
+      if(i + 1 >= length - 2 || data[i + 1] != 0xFD) {
+        busStats.formatErrors++;
+        return;
+      }
+      i++;
+    }
+  }
+
+  busStats.packets++;
+  uint8_t id = data[4];
+  uint8_t instruction = body[0];
+  const uint8_t* params = body + 1;
+  uint16_t paramLength = bodyLength - 1;
+
+  if(instruction == DXL_INST_WRITE && paramLength >= 3) {
+    busStats.writes++;
+    writeControlTable(simBusServo(id), readLE(params, 2), params + 2, paramLength - 2);
+  } else if(instruction == DXL_INST_SYNC_WRITE && paramLength >= 4) {
+    busStats.syncWrites++;
+    uint16_t address = readLE(params, 2);
+    uint16_t dataLength = readLE(params + 2, 2);
+    uint16_t entry = dataLength + 1;
+    if(dataLength == 0 || (paramLength - 4) % entry != 0) {
+      busStats.formatErrors++;
+      return;
+    }
+    for(uint16_t p = 4; p < paramLength; p += entry) {
+      writeControlTable(simBusServo(params[p]), address, params + p + 1, dataLength);
+    }
+  } else if((instruction == DXL_INST_SYNC_READ || instruction == DXL_INST_FAST_SYNC_READ) && paramLength >= 4) {
+    if(instruction == DXL_INST_SYNC_READ) busStats.syncReads++;
+    else busStats.fastSyncReads++;
+    buildReadResponse(instruction == DXL_INST_FAST_SYNC_READ, params, paramLength);
+  }
+}
+
+// 서보 위치 갱신 (속도 기반 사다리꼴 프로파일)
+// 속도 상한 = 프로파일 속도 (0이거나 하드웨어보다 크면 하드웨어 최대 속도)
+// 가속도 = 프로파일 가속도 (0이면 하드웨어 한계), 목표에서 멈출 수 있는 속도 이하로 감속
+void simBusStep(uint32_t dtUs) {
+  double maxUnitsPerSec = SIM_SERVO_MAX_RPM / 60.0 * 4096.0;
+  double dt = dtUs / 1000000.0;
+
+  for(size_t i = 0; i < servoCount; i++) {
+    SimServo& s = servos[i];
+    if(!s.torque) continue;
+
+    double unitsPerSec = maxUnitsPerSec;
+    if(s.profileVelocity > 0) {
+      double profile = s.profileVelocity * SIM_VELOCITY_UNIT / 60.0 * 4096.0;
+      if(profile < unitsPerSec) unitsPerSec = profile;
+    }
+    double accel = SIM_SERVO_MAX_ACCEL;
+    if(s.profileAcceleration > 0) {
+      double profile = s.profileAcceleration * SIM_ACCEL_UNIT / 3600.0 * 4096.0;
+      if(profile < accel) accel = profile;
+    }
+
+    // 목표 방향 희망 속도 (남은 거리에서 멈출 수 있는 속도와 속도 상한 중 작은 값)
+    double diff = s.goalPosition - s.presentPosition;
+    double wanted = fmin(unitsPerSec, sqrt(2.0 * accel * fabs(diff)));
+    if(diff < 0) wanted = -wanted;
+
+    double change = wanted - s.presentVelocity;
+    double maxChange = accel * dt;
+    if(change > maxChange) change = maxChange;
+    if(change < -maxChange) change = -maxChange;
+    s.presentVelocity += change;
+
+    // 이번 스텝에 목표를 지나면 목표에서 정지
+    double step = s.presentVelocity * dt;
+    if((diff >= 0 && step >= diff) || (diff <= 0 && step <= diff)) {
+      s.presentPosition = s.goalPosition;
+      s.presentVelocity = 0;
+    } else {
+      s.presentPosition += step;
+    }
+  }
+}
@@ -0,0 +1,59 @@
+// dxl_sim_bus.h - 다이나믹셀 버스 시뮬레이터 헤더 (호스트 전용)
+
+#ifndef DXL_SIM_BUS_H
+#define DXL_SIM_BUS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ===== 시뮬레이션 설정 =====
+#define SIM_SERVO_MAX_RPM   46.0     // XH540-W270 무부하 속도 (12V)
+#define SIM_SERVO_MAX_ACCEL 60000.0  // 프로파일 가속도 0일 때 가속도 (units/s², 토크 한계로 약 0.05초에 최고 속도)
+#define SIM_VELOCITY_UNIT   0.229    // 프로파일 속도 단위 (rpm)
+#define SIM_ACCEL_UNIT      214.577  // 프로파일 가속도 단위 (rev/min²)
+#define SIM_MAX_SERVOS      32
+#define SIM_RESPONSE_MAX    1024     // 읽기 응답 바이트 (상태 패킷을 이어 붙임)
+
+// ===== 가상 서보 상태 =====
+struct SimServo {
+  uint8_t id;
+  bool torque;
+  uint8_t operatingMode;
+  uint32_t profileAcceleration;
+  uint32_t profileVelocity;
+  int32_t goalPosition;
+  double presentPosition;
+  double presentVelocity;   // units/s (목표 방향 부호)
+};
+
+// ===== 버스 통계 =====
+struct SimBusStats {
+  uint32_t packets;        // 받은 패킷 수
+  uint32_t syncWrites;     // 싱크 라이트 패킷 수
+  uint32_t writes;         // 단일 쓰기 패킷 수
+  uint32_t syncReads;      // 싱크 리드 요청 수
+  uint32_t fastSyncReads;  // 패스트 싱크 리드 요청 수
+  uint32_t crcErrors;      // CRC 불일치
+  uint32_t formatErrors;   // 헤더/길이/스터핑 오류
+  uint64_t bytes;          // 누적 바이트
+};
+
+// ===== 읽기 응답 =====
+// 마지막으로 받은 패킷이 (Fast) Sync Read면 서보들이 보낼 상태 패킷 (없으면 packetCount 0)
+// Sync Read: 서보마다 패킷 1개, Fast Sync Read: 패킷 1개 (서보마다 [오류][ID][데이터][CRC])
+struct SimBusResponse {
+  uint8_t bytes[SIM_RESPONSE_MAX];
+  uint16_t length;
+  uint8_t packetCount;
+  uint16_t packetEnd[SIM_MAX_SERVOS];   // 패킷마다 끝 위치 (bytes 기준, 응답 지연 계산용)
+};
+
+// ===== 버스 함수 =====
+void simBusInit(const uint8_t* ids, size_t count);
+void simBusReceive(const uint8_t* data, uint16_t length);   // DxlTxHandler 호환
+void simBusStep(uint32_t dtUs);
+SimServo* simBusServo(uint8_t id);
+const SimBusStats& simBusStats();
+const SimBusResponse& simBusResponse();
+
+#endif
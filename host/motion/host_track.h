@@ -0,0 +1,51 @@
+// host_track.h - 호스트 도구에서 MotionClip을 펌웨어 MotionTrack으로 감싸는 도우미
+// 호스트에서는 PROGMEM이 일반 메모리이므로 벡터를 그대로 트랙 데이터로 사용
+
+#ifndef HOST_TRACK_H
+#define HOST_TRACK_H
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+#include "motion_json.h"
+#include "motion_player.h"
+#include "motion_resampler.h"
+
+// ===== 트랙 데이터 소유 구조체 =====
+struct HostTrack {
+  std::vector<uint8_t> ids;
+  std::vector<int32_t> offsets;   // offsets[frame * motors + motor], 첫 프레임 대비
+  MotionTrack track;
+};
+
+// 클립을 상대 위치 트랙으로 변환 (HostTrack은 복사하지 말 것: track이 내부 벡터를 가리킴)
+inline void makeHostTrack(const MotionClip& clip, HostTrack& out) {
+  size_t motors = clip.motorIds.size();
+  size_t frames = clip.frameCount();
+
+  out.ids = clip.motorIds;
+  out.offsets.assign(frames * motors, 0);
+  for(size_t i = 0; i < frames; i++) {
+    for(size_t m = 0; m < motors; m++) {
+      out.offsets[i * motors + m] = clip.positions[m][i] - clip.positions[m][0];
+    }
+  }
+
+  out.track.motorCount = (uint8_t)motors;
+  out.track.frameCount = (uint16_t)frames;
+  out.track.frameIntervalUs = (uint32_t)lround(1000000.0 / clip.fps);
+  out.track.motorIds = out.ids.data();
+  out.track.offsets = out.offsets.data();
+  out.track.profiles = 0;
+}
+
+// 보간 모드 이름 변환 (linear / hermite / monotone, 알 수 없으면 -1)
+inline int parseResampleMode(const char* name) {
+  if(strcmp(name, "linear") == 0) return RESAMPLE_LINEAR;
+  if(strcmp(name, "hermite") == 0) return RESAMPLE_HERMITE;
+  if(strcmp(name, "monotone") == 0) return RESAMPLE_MONOTONE;
+  return -1;
+}
+
+#endif
@@ -0,0 +1,112 @@
+// motion_decimator.cpp - 허용 오차 내 키프레임 감축 구현
+//
+// 최적 구간 선형 근사 (L∞ 오차, 키는 원래 샘플 위에 둠):
+// 키 i에서 출발해 j를 늘려 가며 중간 점들이 허용하는 기울기 범위(원뿔)를 좁히고,
+// j로 가는 직선 기울기가 범위 안이면 i → j 간선이 가능 → 최소 키 개수 경로를 DP로 선택
+// 키 개수가 같은 경로 중에서는 정지(기울기 0) 구간이 가장 긴 경로를 골라 재생 중 전송 생략을 늘림
+// 정수 허용 오차 안의 직선은 반올림해도 허용 오차 안에 남으므로 펌웨어 정수 복원도 만족
+
+#include "motion_decimator.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define SLOPE_EPSILON 1e-9
+
+std::vector<uint16_t> decimateChannel(const std::vector<int32_t>& values, int32_t tolerance) {
+  size_t n = values.size();
+  std::vector<uint16_t> keys;
+  if(n <= 2) {
+    for(size_t i = 0; i < n; i++) keys.push_back((uint16_t)i);
+    return keys;
+  }
+
+  // best[j] = 0 ~ j를 덮는 최소 키 개수, flat[j] = 그때 정지 구간 프레임 수, prev[j] = 직전 키
+  std::vector<uint32_t> best(n, UINT32_MAX);
+  std::vector<uint32_t> flat(n, 0);
+  std::vector<uint32_t> prev(n, 0);
+  best[0] = 1;
+
+  for(size_t i = 0; i + 1 < n; i++) {
+    double lo = -INFINITY, hi = INFINITY;
+    for(size_t j = i + 1; j < n; j++) {
+      double span = (double)(j - i);
+      double slope = (values[j] - values[i]) / span;
+
+      if(slope >= lo - SLOPE_EPSILON && slope <= hi + SLOPE_EPSILON) {
+        uint32_t count = best[i] + 1;
+        uint32_t flatFrames = flat[i] + ((values[j] == values[i]) ? (uint32_t)(j - i) : 0);
+        if(count < best[j] || (count == best[j] && flatFrames > flat[j])) {
+          best[j] = count;
+          flat[j] = flatFrames;
+          prev[j] = (uint32_t)i;
+        }
+      }
+
+      // j를 중간 점으로 포함했을 때 허용되는 기울기 범위
+      lo = fmax(lo, (values[j] - tolerance - values[i]) / span);
+      hi = fmin(hi, (values[j] + tolerance - values[i]) / span);
+      if(lo > hi + SLOPE_EPSILON) break;
+    }
+  }
+
+  for(size_t k = n - 1; ; k = prev[k]) {
+    keys.push_back((uint16_t)k);
+    if(k == 0) break;
+  }
+  for(size_t a = 0, b = keys.size() - 1; a < b; a++, b--) {
+    uint16_t t = keys[a];
+    keys[a] = keys[b];
+    keys[b] = t;
+  }
+  return keys;
+}
+
+void decimateTrack(const MotionTrack& track, int32_t tolerance, KeyframeData& out) {
+  size_t motors = track.motorCount;
+  size_t frames = track.frameCount;
+
+  out.ids.assign(track.motorIds, track.motorIds + motors);
+  out.channelStart.clear();
+  out.keyFrames.clear();
+  out.keyValues.clear();
+
+  std::vector<int32_t> values(frames);
+  for(size_t m = 0; m < motors; m++) {
+    for(size_t i = 0; i < frames; i++) {
+      values[i] = track.offsets[i * motors + m];
+    }
+
+    out.channelStart.push_back((uint16_t)out.keyFrames.size());
+    std::vector<uint16_t> keys = decimateChannel(values, tolerance);
+    for(uint16_t k : keys) {
+      out.keyFrames.push_back(k);
+      out.keyValues.push_back(values[k]);
+    }
+  }
+  out.channelStart.push_back((uint16_t)out.keyFrames.size());
+
+  out.track.motorCount = track.motorCount;
+  out.track.frameCount = track.frameCount;
+  out.track.frameIntervalUs = track.frameIntervalUs;
+  out.track.motorIds = out.ids.data();
+  out.track.channelStart = out.channelStart.data();
+  out.track.keyFrames = out.keyFrames.data();
+  out.track.keyValues = out.keyValues.data();
+}
+
+int32_t keyframeMaxError(const MotionTrack& track, const KeyframeTrack& keys) {
+  KeyframeCursor cursor;
+  initKeyframeCursor(keys, cursor);
+
+  int32_t values[DXL_MAX_MOTORS];
+  int32_t worst = 0;
+  for(size_t i = 0; i < track.frameCount; i++) {
+    sampleKeyframes(keys, cursor, (uint32_t)i * track.frameIntervalUs, values);
+    for(size_t m = 0; m < track.motorCount; m++) {
+      int32_t error = abs(values[m] - track.offsets[i * track.motorCount + m]);
+      if(error > worst) worst = error;
+    }
+  }
+  return worst;
+}
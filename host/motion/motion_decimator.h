@@ -0,0 +1,30 @@
+// motion_decimator.h - 허용 오차 내 키프레임 감축 헤더 (호스트 도구)
+
+#ifndef MOTION_DECIMATOR_H
+#define MOTION_DECIMATOR_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "motion_player.h"
+#include "motion_keyframes.h"
+
+// ===== 감축 결과 (KeyframeTrack이 내부 벡터를 가리키므로 복사하지 말 것) =====
+struct KeyframeData {
+  std::vector<uint8_t> ids;
+  std::vector<uint16_t> channelStart;   // 모터별 키 시작 인덱스 (motors + 1개)
+  std::vector<uint16_t> keyFrames;
+  std::vector<int32_t> keyValues;
+  KeyframeTrack track;
+};
+
+// 모터 한 개의 값 목록에서 최소 키 프레임 번호 목록 계산 (처음/끝 포함)
+std::vector<uint16_t> decimateChannel(const std::vector<int32_t>& values, int32_t tolerance);
+
+// 트랙 전체 감축
+void decimateTrack(const MotionTrack& track, int32_t tolerance, KeyframeData& out);
+
+// 펌웨어 복원 함수(sampleKeyframes)로 모든 원래 프레임을 복원했을 때의 최대 오차
+int32_t keyframeMaxError(const MotionTrack& track, const KeyframeTrack& keys);
+
+#endif
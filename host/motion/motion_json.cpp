@@ -0,0 +1,101 @@
+// motion_json.cpp - 블렌더 모션 JSON 로더 구현
+// 전체 JSON 파서 없이 필요한 키("fps", "frame", "dynamixel_position", "motor_id")만 순서대로 읽음
+
+#include "motion_json.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+// 파일 전체를 문자열로 읽기
+static bool readFile(const char* path, std::string& text) {
+  FILE* f = fopen(path, "rb");
+  if(!f) return false;
+
+  char buffer[65536];
+  size_t n;
+  while((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+    text.append(buffer, n);
+  }
+  fclose(f);
+  return true;
+}
+
+// pos 이후 처음 나오는 "key": 의 값 위치 반환 (없으면 npos)
+static size_t findKey(const std::string& text, const char* key, size_t pos) {
+  std::string token = std::string("\"") + key + "\"";
+  while((pos = text.find(token, pos)) != std::string::npos) {
+    size_t p = pos + token.size();
+    while(p < text.size() && (text[p] == ' ' || text[p] == '\n' || text[p] == '\r' || text[p] == '\t')) p++;
+    if(p < text.size() && text[p] == ':') return p + 1;
+    pos = p;
+  }
+  return std::string::npos;
+}
+
+bool loadMotionClip(const char* path, MotionClip& clip) {
+  std::string text;
+  if(!readFile(path, text)) {
+    fprintf(stderr, "Failed to open %s\n", path);
+    return false;
+  }
+
+  clip = MotionClip();
+  size_t fpsPos = findKey(text, "fps", 0);
+  if(fpsPos != std::string::npos) {
+    clip.fps = strtof(text.c_str() + fpsPos, 0);
+  }
+
+  size_t pos = findKey(text, "frames", 0);
+  if(pos == std::string::npos) {
+    fprintf(stderr, "No frames in %s\n", path);
+    return false;
+  }
+
+  // 프레임 단위로 조인트 위치를 모음
+  size_t frameIndex = 0;
+  size_t next = findKey(text, "frame", pos);
+  while(next != std::string::npos) {
+    size_t frameEnd = findKey(text, "frame", next);
+    size_t end = (frameEnd == std::string::npos) ? text.size() : frameEnd;
+
+    size_t p = next;
+    while(true) {
+      size_t valuePos = findKey(text, "dynamixel_position", p);
+      if(valuePos == std::string::npos || valuePos >= end) break;
+      size_t idPos = findKey(text, "motor_id", valuePos);
+      if(idPos == std::string::npos || idPos >= end) break;
+
+      int32_t value = (int32_t)strtol(text.c_str() + valuePos, 0, 10);
+      uint8_t id = (uint8_t)strtol(text.c_str() + idPos, 0, 10);
+
+      // 모터 인덱스 찾기 (처음 보는 모터는 추가)
+      size_t m = 0;
+      while(m < clip.motorIds.size() && clip.motorIds[m] != id) m++;
+      if(m == clip.motorIds.size()) {
+        if(frameIndex != 0) {
+          fprintf(stderr, "Motor %d first appears at frame %zu\n", id, frameIndex);
+          return false;
+        }
+        clip.motorIds.push_back(id);
+        clip.positions.push_back(std::vector<int32_t>());
+      }
+      clip.positions[m].push_back(value);
+      p = idPos;
+    }
+
+    frameIndex++;
+    next = frameEnd;
+  }
+
+  // 모든 모터의 프레임 수가 같아야 함
+  for(size_t m = 0; m < clip.positions.size(); m++) {
+    if(clip.positions[m].size() != frameIndex) {
+      fprintf(stderr, "Motor %d has %zu of %zu frames\n",
+              clip.motorIds[m], clip.positions[m].size(), frameIndex);
+      return false;
+    }
+  }
+  return !clip.motorIds.empty();
+}
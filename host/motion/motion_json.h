@@ -0,0 +1,22 @@
+// motion_json.h - 블렌더 모션 JSON 로더 헤더 (호스트 도구 공용)
+
+#ifndef MOTION_JSON_H
+#define MOTION_JSON_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// ===== 모션 클립 (모터별 다이나믹셀 위치 트랙) =====
+struct MotionClip {
+  float fps = 24.0f;                              // 메타데이터 fps
+  std::vector<uint8_t> motorIds;                  // 모터 ID 목록 (등장 순서)
+  std::vector<std::vector<int32_t>> positions;    // positions[motor][frame]
+
+  size_t frameCount() const { return positions.empty() ? 0 : positions[0].size(); }
+};
+
+// 내보낸 JSON에서 fps와 프레임별 dynamixel_position만 읽음
+bool loadMotionClip(const char* path, MotionClip& clip);
+
+#endif
@@ -0,0 +1,100 @@
+// motion_profiler.cpp - 구간별 프로파일 속도/가속도 계산 구현
+//
+// 플레이어는 구간 시작 시각에 구간 끝 위치를 목표로 보내므로, 서보는 구간 하나를
+// 이전 구간 속도 u에서 출발 → 가속도 a로 V까지 변속 → V로 이동 → 목표에서 멈추도록 감속
+// 1) 가속도: 속도 변화 |v_k - v_(k-1)|를 rampFraction 구간 안에 끝내고,
+//    끝 감속(V / a)이 brakeFraction 구간을 넘지 않는 값 중 큰 쪽
+// 2) 속도: 변속/감속으로 잃는 거리를 보충해 구간 시간 T 동안 거리 D를 가는 V
+//    D = V·T - (V² - V·u) / a - u² / (2a)  →  V에 대한 2차식의 작은 근
+// 3) 단위 변환 후 올림 (속도가 모자라면 늦고, 남으면 목표에서 잠깐 멈출 뿐이므로)
+// 4) 속도 상한에 걸린 구간은 못 간 거리를 기억해 두고 다음 구간 거리에 더함 (뒤처진 만큼 따라잡기)
+
+#include "motion_profiler.h"
+
+#include <math.h>
+
+// 단위 1당 units/s, units/s² (4096 units/회전)
+#define VELOCITY_UNIT_UPS  (PROFILE_VELOCITY_UNIT_RPM / 60.0 * 4096.0)
+#define ACCEL_UNIT_UPS2    (PROFILE_ACCEL_UNIT_RPM2 / 3600.0 * 4096.0)
+
+void defaultProfileSettings(ProfileSettings& settings) {
+  settings.velocityLimit = (uint16_t)(46.0 / PROFILE_VELOCITY_UNIT_RPM);
+  settings.rampFraction = 0.5;
+  settings.brakeFraction = 0.2;
+}
+
+// 프레임 값 (호스트 트랙은 일반 메모리)
+static int32_t frameValue(const MotionTrack& track, size_t frame, uint8_t motor) {
+  return track.offsets[frame * track.motorCount + motor];
+}
+
+// 시작 속도 u(이동 방향 성분), 가속도 a로 T 동안 거리 D를 가는 최고 속도
+static double cruiseVelocity(double D, double T, double u, double a) {
+  double b = T + u / a;
+  double c = D + u * u / (2.0 * a);
+  double disc = b * b - 4.0 * c / a;
+  if(disc <= 0) return b * a / 2.0;   // 이 가속도로는 시간 안에 못 감: 낼 수 있는 최고 속도
+  return (b - sqrt(disc)) * a / 2.0;
+}
+
+void profileTrack(const MotionTrack& track, const ProfileSettings& settings,
+                  std::vector<uint16_t>& out, ProfileStats& stats) {
+  size_t motors = track.motorCount;
+  size_t frames = track.frameCount;
+  double T = track.frameIntervalUs / 1000000.0;
+
+  out.assign(frames * motors * 2, 0);
+  stats.entries = 0;
+  stats.velocityClamped = 0;
+  stats.maxVelocity = 0;
+  stats.maxAcceleration = 0;
+
+  for(uint8_t m = 0; m < motors; m++) {
+    double expected = frameValue(track, 0, m);   // 구간 시작 때 서보 위치 (앞 구간이 상한에 걸렸으면 뒤처짐)
+    double previous = 0;                          // 앞 구간 속도 (units/s, 부호 포함)
+
+    for(size_t k = 0; k < frames; k++) {
+      double target = frameValue(track, (k + 1 < frames) ? k + 1 : k, m);
+      double v = (target - expected) / T;
+      double D = fabs(v) * T;
+      double u = (v >= 0) ? previous : -previous;    // 이동 방향 성분 (반대 방향이면 음수)
+      if(u < 0) u = 0;                                // 반대로 움직이던 중이면 멈춘 뒤 출발한다고 봄
+
+      double a = fabs(v - previous) / (settings.rampFraction * T);
+      double V = fabs(v);
+      if(D == 0) V = fabs(previous);   // 정지 구간: 남은 거리를 이전 속도로 마저 가고 멈춤
+      for(int pass = 0; pass < 2; pass++) {
+        double brake = V / (settings.brakeFraction * T);
+        if(brake > a) a = brake;
+        if(a > 0 && D > 0) V = cruiseVelocity(D, T, u, a);
+      }
+
+      // 0은 "제한 없음"이므로 정지 구간도 최소 1
+      double velocityUnits = ceil(V / VELOCITY_UNIT_UPS);
+      double accelUnits = ceil(a / ACCEL_UNIT_UPS2);
+      if(velocityUnits < 1) velocityUnits = 1;
+      if(accelUnits < 1) accelUnits = 1;
+      if(accelUnits > PROFILE_ACCEL_MAX) accelUnits = PROFILE_ACCEL_MAX;
+
+      // 상한에 걸리면 구간 끝까지 못 가고 남은 거리는 다음 구간들이 속도를 높여 따라잡음
+      if(velocityUnits > settings.velocityLimit) {
+        velocityUnits = settings.velocityLimit;
+        double reach = velocityUnits * VELOCITY_UNIT_UPS * T;
+        expected += (v >= 0) ? reach : -reach;
+        previous = (v >= 0) ? reach / T : -reach / T;
+        stats.velocityClamped++;
+      } else {
+        expected = target;
+        previous = v;
+      }
+
+      uint16_t velocity = (uint16_t)velocityUnits;
+      uint16_t accel = (uint16_t)accelUnits;
+      out[(k * motors + m) * 2] = accel;
+      out[(k * motors + m) * 2 + 1] = velocity;
+      if(velocity > stats.maxVelocity) stats.maxVelocity = velocity;
+      if(accel > stats.maxAcceleration) stats.maxAcceleration = accel;
+      stats.entries++;
+    }
+  }
+}
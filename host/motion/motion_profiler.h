@@ -0,0 +1,41 @@
+// motion_profiler.h - 구간별 프로파일 속도/가속도 계산 헤더 (호스트 도구)
+// 작성된 궤적의 구간(프레임 k → k+1)마다 서보가 프레임 간격 동안 그 구간을 따라가도록
+// 프로파일 속도/가속도를 정해 MotionTrack::profiles 형식으로 만듦
+
+#ifndef MOTION_PROFILER_H
+#define MOTION_PROFILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "motion_player.h"
+
+// ===== X 시리즈 프로파일 단위 (속도 기반 프로파일, Drive Mode 기본값) =====
+#define PROFILE_VELOCITY_UNIT_RPM   0.229     // 프로파일 속도 1 = 0.229 rpm
+#define PROFILE_ACCEL_UNIT_RPM2     214.577   // 프로파일 가속도 1 = 214.577 rev/min²
+#define PROFILE_ACCEL_MAX           32767     // 프로파일 가속도 최대값
+
+// ===== 계산 설정 =====
+struct ProfileSettings {
+  uint16_t velocityLimit;    // 프로파일 속도 상한 (Velocity Limit(44)보다 크면 서보가 쓰기를 거부)
+  double rampFraction;       // 이전 구간 속도에서 이번 구간 속도로 바꾸는 데 쓰는 구간 비율
+  double brakeFraction;      // 구간 끝 감속이 차지해도 되는 구간 비율 (가속도 하한)
+};
+
+// ===== 계산 결과 통계 =====
+struct ProfileStats {
+  size_t entries;            // 구간 × 모터 수
+  size_t velocityClamped;    // 속도 상한에 걸린 개수 (이 구간은 작성된 속도를 못 따라감)
+  uint16_t maxVelocity;      // 최대 프로파일 속도
+  uint16_t maxAcceleration;  // 최대 프로파일 가속도
+};
+
+// 기본 설정 (속도 상한 = XH540-W270 무부하 최고 속도 46 rpm, 서보의 Velocity Limit(44)가 더 낮으면 맞춰 줄 것)
+void defaultProfileSettings(ProfileSettings& settings);
+
+// 트랙 전체 계산 (out[(frame * motors + motor) * 2] = 가속도, + 1 = 속도, 마지막 프레임은 정지 유지)
+void profileTrack(const MotionTrack& track, const ProfileSettings& settings,
+                  std::vector<uint16_t>& out, ProfileStats& stats);
+
+#endif
@@ -0,0 +1,142 @@
+// motion_retimer.cpp - 속도/가속도 한계 기반 모션 리타이밍 구현
+//
+// 1) 한 번의 순회로 구간별 변화량에서 속도 한계를 만족하는 최소 시간 계산
+// 2) 인접 구간 사이 가속도가 한계를 넘으면 두 구간만 sqrt(a / amax)배 늘림
+//    (가속도는 시간 배율의 제곱에 반비례) - 이웃에 영향이 가므로 수렴할 때까지 반복
+// 3) 구간 시간 누적으로 작성 프레임 → 재생 시각 맵 생성
+
+#include "motion_retimer.h"
+#include "motion_resampler.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#define RETIME_TOLERANCE  1e-6      // 한계 비교 허용 오차 (비율)
+
+double rpmToUnitsPerSecond(double rpm) {
+  return rpm / 60.0 * 4096.0;
+}
+
+// 작성 프레임 값 (호스트 트랙은 일반 메모리)
+static int32_t frameValue(const MotionTrack& track, size_t frame, uint8_t motor) {
+  return track.offsets[frame * track.motorCount + motor];
+}
+
+// 구간 k의 모터별 속도 (units/s)
+static double segmentVelocity(const MotionTrack& track, const std::vector<double>& segmentUs,
+                              size_t k, uint8_t motor) {
+  double delta = frameValue(track, k + 1, motor) - frameValue(track, k, motor);
+  return delta / (segmentUs[k] / 1000000.0);
+}
+
+// 구간 k-1 → k 사이의 최대 가속도 (모든 모터 중)
+static double jointAcceleration(const MotionTrack& track, const std::vector<double>& segmentUs, size_t k) {
+  double worst = 0;
+  double dt = (segmentUs[k - 1] + segmentUs[k]) / 2.0 / 1000000.0;
+  for(uint8_t m = 0; m < track.motorCount; m++) {
+    double dv = segmentVelocity(track, segmentUs, k, m) - segmentVelocity(track, segmentUs, k - 1, m);
+    double a = fabs(dv) / dt;
+    if(a > worst) worst = a;
+  }
+  return worst;
+}
+
+bool retimeTrack(const MotionTrack& track, const RetimeLimits& limits, RetimeResult& out, int maxSweeps) {
+  size_t frames = track.frameCount;
+  size_t segments = frames > 0 ? frames - 1 : 0;
+  double authoredUs = track.frameIntervalUs;
+
+  out.segmentUs.assign(segments, authoredUs);
+  out.velocityStretched = 0;
+  out.accelerationStretched = 0;
+  out.sweeps = 0;
+  out.converged = true;
+  out.worstAcceleration = 0;
+
+  // 1) 속도 한계: 구간의 최대 변화량 / 최대 속도
+  for(size_t k = 0; k < segments; k++) {
+    double worst = 0;
+    for(uint8_t m = 0; m < track.motorCount; m++) {
+      double delta = fabs((double)frameValue(track, k + 1, m) - frameValue(track, k, m));
+      if(delta > worst) worst = delta;
+    }
+    double minUs = worst / limits.maxVelocity * 1000000.0;
+    if(minUs > authoredUs * (1.0 + RETIME_TOLERANCE)) {
+      out.segmentUs[k] = minUs;
+      out.velocityStretched++;
+    }
+  }
+
+  // 2) 가속도 한계: 위반한 인접 구간 쌍만 늘림
+  std::vector<bool> accelerationHit(segments, false);
+  if(limits.maxAcceleration > 0) {
+    for(int sweep = 0; sweep < maxSweeps; sweep++) {
+      bool changed = false;
+      for(size_t k = 1; k < segments; k++) {
+        double a = jointAcceleration(track, out.segmentUs, k);
+        if(a > limits.maxAcceleration * (1.0 + RETIME_TOLERANCE)) {
+          double scale = sqrt(a / limits.maxAcceleration);
+          out.segmentUs[k - 1] *= scale;
+          out.segmentUs[k] *= scale;
+          accelerationHit[k - 1] = true;
+          accelerationHit[k] = true;
+          changed = true;
+        }
+      }
+      out.sweeps = sweep + 1;
+      if(!changed) break;
+    }
+  }
+  for(size_t k = 0; k < segments; k++) {
+    if(accelerationHit[k]) out.accelerationStretched++;
+  }
+
+  // 마지막 반복에서도 늘렸으면 남은 위반이 있을 수 있으므로 다시 확인
+  if(limits.maxAcceleration > 0) {
+    for(size_t k = 1; k < segments; k++) {
+      double a = jointAcceleration(track, out.segmentUs, k);
+      if(a > out.worstAcceleration) out.worstAcceleration = a;
+    }
+    out.converged = out.worstAcceleration <= limits.maxAcceleration * (1.0 + RETIME_TOLERANCE);
+  }
+
+  // 3) 시간 변환 맵
+  out.warpUs.assign(frames, 0.0);
+  for(size_t k = 0; k < segments; k++) {
+    out.warpUs[k + 1] = out.warpUs[k] + out.segmentUs[k];
+  }
+  out.authoredUs = segments * authoredUs;
+  out.retimedUs = frames > 0 ? out.warpUs[frames - 1] : 0;
+  return out.converged;
+}
+
+void bakeRetimedTrack(const MotionTrack& track, const RetimeResult& retime, uint32_t intervalUs,
+                      uint8_t mode, std::vector<int32_t>& out) {
+  MotionResampler resampler;
+  initResampler(resampler, &track, mode);
+
+  int32_t values[RESAMPLE_LANES];
+  size_t ticks = (size_t)(retime.retimedUs / intervalUs) + 1;
+  size_t segment = 0;
+  out.clear();
+
+  for(size_t n = 0; n < ticks; n++) {
+    double playbackUs = (double)n * intervalUs;
+
+    // 재생 시각이 속한 구간 (재생 시각은 단조 증가하므로 앞으로만 이동)
+    while(segment + 1 < retime.segmentUs.size() && retime.warpUs[segment + 1] <= playbackUs) {
+      segment++;
+    }
+
+    // 재생 시각 → 작성 시각
+    double authoredUs = (double)segment * track.frameIntervalUs;
+    if(!retime.segmentUs.empty()) {
+      double frac = (playbackUs - retime.warpUs[segment]) / retime.segmentUs[segment];
+      if(frac > 1.0) frac = 1.0;
+      authoredUs += frac * track.frameIntervalUs;
+    }
+
+    resampleAt(resampler, (uint32_t)lround(authoredUs), values);
+    out.insert(out.end(), values, values + track.motorCount);
+  }
+}
@@ -0,0 +1,46 @@
+// motion_retimer.h - 속도/가속도 한계 기반 모션 리타이밍 헤더 (호스트 도구)
+// 한계를 넘는 구간만 시간을 늘리고 나머지 구간은 작성된 속도 그대로 유지
+
+#ifndef MOTION_RETIMER_H
+#define MOTION_RETIMER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "motion_player.h"
+
+#define RETIME_MAX_SWEEPS 64        // 가속도 보정 기본 최대 반복 횟수
+
+// ===== 서보 한계 =====
+struct RetimeLimits {
+  double maxVelocity;        // 최대 속도 (units/s)
+  double maxAcceleration;    // 최대 가속도 (units/s², 0 = 검사 안 함)
+};
+
+// ===== 리타이밍 결과 =====
+struct RetimeResult {
+  std::vector<double> segmentUs;   // 구간별 재생 시간 (작성 프레임 k → k+1)
+  std::vector<double> warpUs;      // 작성 프레임별 재생 시각 (시간 변환 맵)
+  size_t velocityStretched;        // 속도 한계로 늘어난 구간 수
+  size_t accelerationStretched;    // 가속도 한계로 (추가로) 늘어난 구간 수
+  int sweeps;                      // 가속도 보정 반복 횟수
+  bool converged;                  // 최대 반복 안에 가속도 한계를 모두 만족했는지
+  double worstAcceleration;        // 보정 후 남은 최대 가속도 (units/s², 검사 안 하면 0)
+  double authoredUs;               // 원래 재생 시간
+  double retimedUs;                // 리타이밍 후 재생 시간
+};
+
+// rpm → units/s (4096 units/회전)
+double rpmToUnitsPerSecond(double rpm);
+
+// 구간별 최소 재생 시간 계산 후 시간 변환 맵 생성
+// 가속도 보정이 maxSweeps 안에 수렴하지 않으면 false (맵은 만들지만 위반이 남아 있음)
+bool retimeTrack(const MotionTrack& track, const RetimeLimits& limits, RetimeResult& out,
+                 int maxSweeps = RETIME_MAX_SWEEPS);
+
+// 시간 변환 맵을 따라 일정 간격 트랙으로 다시 샘플링 (offsets[tick * motors + motor])
+void bakeRetimedTrack(const MotionTrack& track, const RetimeResult& retime, uint32_t intervalUs,
+                      uint8_t mode, std::vector<int32_t>& out);
+
+#endif
@@ -0,0 +1,279 @@
+// pipeline_bench.cpp - 싱크 라이트 / 위치 읽기 파이프라인 벤치 (시뮬레이션 반이중 버스)
+// 펌웨어와 같은 dxl_protocol.cpp / dxl_pipeline.cpp를 가상 시계로 실행
+// 버스: 송신은 전송 시간만큼 블로킹 (펌웨어의 flush()), 응답 바이트는 응답 지연 뒤 1Mbps로 하나씩 도착
+// 서보 1~32개 × 루프 방식마다 싱크 라이트 시작 간격(주기)과 지터, 예정 시각 대비 지연, 읽기 결과 출력
+//   sequential   매 프레임 쓰기 → Sync Read 응답을 다 받을 때까지 대기 (파이썬 루프와 같은 순서)
+//   pipe_sync    매 프레임 Sync Read, 응답은 기다리지 않고 다음 프레임 계산과 겹침
+//   pipe_fast    매 프레임 Fast Sync Read
+//   pipe_fast_k4 4 프레임마다 Fast Sync Read
+// 응답이 프레임 간격보다 길면 파이프라인도 쓰기를 미룰 수밖에 없음 (Fast Sync Read나 k로 줄임)
+// 버스 충돌(응답 수신 중 송신), CRC 오류, 요청 시점과 다른 위치 값, 한 번도 읽지 못한 서보가 있으면 종료 코드 1
+//
+// 빌드 (FW = ../../Scenario_motion/samsung_motion_player/samsung_motion_player):
+//   g++ -std=c++17 -O2 -DDXL_MAX_MOTORS=32 -I../arduino -I$FW -o pipeline_bench pipeline_bench.cpp
+//       dxl_sim_bus.cpp $FW/dxl_protocol.cpp $FW/dxl_pipeline.cpp
+// 사용: ./pipeline_bench [--rate HZ] [--seconds S] [--compute-us US] [--servos N,N,...]
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+#include "dxl_protocol.h"
+#include "dxl_pipeline.h"
+#include "dxl_sim_bus.h"
+
+#define LOOP_US 20    // MCU loop() 한 바퀴 (폴링 간격)
+
+// ===== 루프 방식 =====
+struct LoopMode {
+  const char* name;
+  uint8_t readEvery;
+  bool fastRead;
+  bool blocking;
+};
+
+static const LoopMode modes[] = {
+  { "sequential",   1, false, true  },
+  { "pipe_sync",    1, false, false },
+  { "pipe_fast",    1, true,  false },
+  { "pipe_fast_k4", 4, true,  false },
+};
+
+// ================= 시간 모델 버스 =================
+static uint8_t rxBytes[SIM_RESPONSE_MAX];
+static uint64_t rxTimes[SIM_RESPONSE_MAX];
+static uint16_t rxCount = 0;
+static uint16_t rxNext = 0;
+static uint64_t busQuietUs = 0;      // 마지막 응답 바이트 도착 시각
+static uint32_t collisions = 0;
+
+// 측정: 싱크 라이트 시작 시각과 그 프레임의 예정 시각
+static uint64_t frameDeadlineUs = 0;
+static std::vector<uint64_t> writeStarts;
+static std::vector<int64_t> writeLateness;
+// 최근 두 읽기 요청 시점의 서보 위치 (검증용, 읽기가 끝난 같은 poll에서 다음 요청이 나갈 수 있음)
+static int32_t requestedPositions[2][SIM_MAX_SERVOS];
+static uint32_t requestCount = 0;
+
+static void benchWire(const uint8_t* data, uint16_t length) {
+  if(hostClockUs < busQuietUs) collisions++;
+  if(length > 7 && data[7] == DXL_INST_SYNC_WRITE) {
+    writeStarts.push_back(hostClockUs);
+    writeLateness.push_back((int64_t)hostClockUs - (int64_t)frameDeadlineUs);
+  }
+
+  hostAdvanceMicros(dxlWireTimeUs(length));
+  simBusReceive(data, length);
+  if(length > 7 && (data[7] == DXL_INST_SYNC_READ || data[7] == DXL_INST_FAST_SYNC_READ)) {
+    requestCount++;
+    for(uint16_t i = 12; i + 2 < length && i - 12 < SIM_MAX_SERVOS; i++) {
+      requestedPositions[requestCount & 1][i - 12] = (int32_t)lround(simBusServo(data[i])->presentPosition);
+    }
+  }
+
+  // 응답: 패킷마다 응답 지연 후 바이트당 10us
+  const SimBusResponse& r = simBusResponse();
+  if(r.packetCount == 0) return;
+  rxCount = 0;
+  rxNext = 0;
+  uint64_t t = hostClockUs;
+  uint16_t start = 0;
+  for(uint8_t p = 0; p < r.packetCount; p++) {
+    t += DXL_RETURN_DELAY_US;
+    for(uint16_t i = start; i < r.packetEnd[p]; i++) {
+      t += dxlWireTimeUs(1);
+      rxBytes[rxCount] = r.bytes[i];
+      rxTimes[rxCount++] = t;
+    }
+    start = r.packetEnd[p];
+  }
+  busQuietUs = t;
+}
+
+static int benchRead() {
+  if(rxNext < rxCount && rxTimes[rxNext] <= hostClockUs) return rxBytes[rxNext++];
+  return -1;
+}
+
+static void step(uint32_t us) {
+  simBusStep(us);
+  hostAdvanceMicros(us);
+}
+
+// ================= 결과 =================
+struct BenchResult {
+  double periodMeanUs = 0;
+  double periodSdUs = 0;
+  double lateP50Us = 0;
+  double lateP99Us = 0;
+  double lateMaxUs = 0;
+  uint32_t frames = 0;
+  uint32_t skipped = 0;
+  double readsPerSec = 0;
+  double readMeanUs = 0;
+  DxlPipelineStats stats;
+  bool allRead = true;
+  uint32_t wrongValues = 0;     // 요청 시점 위치와 다르게 읽힌 값
+};
+
+static double percentile(std::vector<int64_t> values, double q) {
+  if(values.empty()) return 0;
+  size_t k = std::min(values.size() - 1, (size_t)(q * values.size()));
+  std::nth_element(values.begin(), values.begin() + k, values.end());
+  return (double)values[k];
+}
+
+static BenchResult runBench(int servos, const LoopMode& mode, uint32_t intervalUs, double seconds,
+                            uint32_t computeUs) {
+  std::vector<uint8_t> ids;
+  for(int i = 0; i < servos; i++) ids.push_back((uint8_t)(i + 1));
+
+  hostSetMicros(0);
+  simBusInit(ids.data(), ids.size());
+  for(uint8_t id : ids) simBusServo(id)->torque = true;
+  rxCount = rxNext = 0;
+  busQuietUs = 0;
+  collisions = 0;
+  writeStarts.clear();
+  writeLateness.clear();
+
+  dxlBegin(dxlPipelineWrite);
+  dxlPipelineBegin(ids.data(), (uint8_t)servos, benchWire, benchRead, mode.readEvery, mode.fastRead);
+
+  BenchResult result;
+  uint64_t durationUs = (uint64_t)(seconds * 1e6);
+  uint64_t nextDeadline = intervalUs;
+  uint32_t lastComplete = 0;
+  double readSumUs = 0;
+
+  // 읽기가 끝날 때마다 시간 누적 + 값 검증
+  auto checkRead = [&]() {
+    if(dxlPipelineStats().readsComplete == lastComplete) return;
+    lastComplete = dxlPipelineStats().readsComplete;
+    readSumUs += dxlPipelineStats().lastReadUs;
+    uint32_t mismatch[2] = { 0, 0 };
+    for(int i = 0; i < servos; i++) {
+      int32_t position;
+      if(!dxlPipelinePosition((uint8_t)i, &position, 0)) continue;
+      for(int r = 0; r < 2; r++) {
+        if(position != requestedPositions[r][i]) mismatch[r]++;
+      }
+    }
+    result.wrongValues += std::min(mismatch[0], mismatch[1]);
+  };
+
+  while(hostClockUs < durationUs) {
+    dxlPipelinePoll();
+    checkRead();
+
+    if(hostClockUs >= nextDeadline) {
+      // 프레임 계산 (보간 + 패킷 생성 시간 모델) 후 싱크 라이트
+      frameDeadlineUs = nextDeadline;
+      hostAdvanceMicros(computeUs);
+      double t = nextDeadline / 1e6;
+      dxlBeginSyncWrite(ADDR_GOAL_POSITION, LEN_GOAL_POSITION);
+      for(int i = 0; i < servos; i++) {
+        dxlSyncWriteAdd32(ids[i], (int32_t)lround(800.0 * sin(2 * PI * 0.5 * t + i * 0.3)));
+      }
+      if(dxlFinishPacket()) dxlTransmit();
+      result.frames++;
+
+      if(mode.blocking) {
+        while(dxlPipelineBusy()) {
+          step(LOOP_US);
+          dxlPipelinePoll();
+        }
+        checkRead();
+      }
+
+      nextDeadline += intervalUs;
+      while(nextDeadline <= hostClockUs) {
+        nextDeadline += intervalUs;
+        result.skipped++;
+      }
+    }
+    step(LOOP_US);
+  }
+
+  // 주기 / 지터
+  std::vector<double> periods;
+  for(size_t i = 1; i < writeStarts.size(); i++) periods.push_back((double)(writeStarts[i] - writeStarts[i - 1]));
+  if(!periods.empty()) {
+    double sum = 0, squared = 0;
+    for(double p : periods) sum += p;
+    result.periodMeanUs = sum / periods.size();
+    for(double p : periods) squared += (p - result.periodMeanUs) * (p - result.periodMeanUs);
+    result.periodSdUs = sqrt(squared / periods.size());
+  }
+  result.lateP50Us = percentile(writeLateness, 0.50);
+  result.lateP99Us = percentile(writeLateness, 0.99);
+  result.lateMaxUs = writeLateness.empty() ? 0 : (double)*std::max_element(writeLateness.begin(), writeLateness.end());
+  result.stats = dxlPipelineStats();
+  result.readsPerSec = result.stats.readsComplete / seconds;
+  result.readMeanUs = result.stats.readsComplete ? readSumUs / result.stats.readsComplete : 0;
+
+  // 읽은 위치가 서보마다 한 번 이상 있는지 (모든 모드가 읽기 포함)
+  for(int i = 0; i < servos; i++) {
+    int32_t position;
+    if(!dxlPipelinePosition((uint8_t)i, &position, 0)) result.allRead = false;
+  }
+  return result;
+}
+
+int main(int argc, char** argv) {
+  uint32_t rateHz = 200;
+  double seconds = 5.0;
+  uint32_t computeUs = 300;
+  std::vector<int> servoCounts = { 1, 2, 4, 8, 16, 32 };
+
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--rate") == 0 && i + 1 < argc) rateHz = (uint32_t)atoi(argv[++i]);
+    else if(strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+    else if(strcmp(argv[i], "--compute-us") == 0 && i + 1 < argc) computeUs = (uint32_t)atoi(argv[++i]);
+    else if(strcmp(argv[i], "--servos") == 0 && i + 1 < argc) {
+      servoCounts.clear();
+      for(char* p = strtok(argv[++i], ","); p; p = strtok(0, ",")) servoCounts.push_back(atoi(p));
+    } else {
+      fprintf(stderr, "Usage: %s [--rate HZ] [--seconds S] [--compute-us US] [--servos N,N,...]\n", argv[0]);
+      return 1;
+    }
+  }
+  if(rateHz == 0 || seconds <= 0) {
+    fprintf(stderr, "Invalid --rate or --seconds\n");
+    return 1;
+  }
+  for(int n : servoCounts) {
+    if(n < 1 || n > DXL_MAX_MOTORS || n > SIM_MAX_SERVOS) {
+      fprintf(stderr, "Servo count %d out of range (1-%d)\n", n, DXL_MAX_MOTORS);
+      return 1;
+    }
+  }
+
+  uint32_t intervalUs = 1000000UL / rateHz;
+  printf("rate %u Hz (%u us), compute %u us, return delay %u us, %.1f s per run\n\n",
+         rateHz, intervalUs, computeUs, (unsigned)DXL_RETURN_DELAY_US, seconds);
+  printf("%6s %-13s %9s %8s %8s %8s %8s %7s %8s %8s %6s %6s\n", "servos", "mode", "period", "jitter",
+         "late50", "late99", "lateMax", "dropped", "reads/s", "read_us", "defer", "tmout");
+
+  bool failed = false;
+  for(int servos : servoCounts) {
+    for(const LoopMode& mode : modes) {
+      BenchResult r = runBench(servos, mode, intervalUs, seconds, computeUs);
+      printf("%6d %-13s %9.1f %8.1f %8.0f %8.0f %8.0f %7u %8.1f %8.0f %6u %6u\n", servos, mode.name,
+             r.periodMeanUs, r.periodSdUs, r.lateP50Us, r.lateP99Us, r.lateMaxUs,
+             r.skipped + r.stats.replacedWrites,
+             r.readsPerSec, r.readMeanUs, r.stats.deferredWrites, r.stats.readTimeouts);
+      if(collisions || r.stats.crcErrors || !r.allRead || r.wrongValues) {
+        fprintf(stderr, "FAILED: %d servos %s: collisions %u, crc %u, wrong values %u, unread servos %s\n",
+                servos, mode.name, collisions, r.stats.crcErrors, r.wrongValues, r.allRead ? "no" : "yes");
+        failed = true;
+      }
+    }
+  }
+  printf("\nperiod/jitter: 싱크 라이트 시작 간격 평균/표준편차 (us), late: 프레임 예정 시각 대비 시작 지연 (us)\n");
+  printf("dropped: 보내지 못한 프레임 (루프가 늦어 건너뜀 + 응답 수신 중 새 프레임으로 바뀜)\n");
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,122 @@
+// resampler_bench.cpp - 리샘플러 SSE4.1 경로 검증 (펌웨어 motion_resampler.cpp 그대로 사용)
+// 합성 트랙(모터 5개 이상, 4의 배수가 아니어서 스칼라 꼬리도 지남)을 모드마다 촘촘한 시각으로 리샘플해
+// SSE4.1 경로와 스칼라 경로 출력이 바이트 단위로 같은지 비교, 다르면 종료 코드 1
+// CPU에 SSE4.1이 없으면 비교를 건너뜀 (종료 코드 0)
+//
+// 빌드 (FW = ../../Scenario_motion/samsung_motion_player/samsung_motion_player):
+//   g++ -std=c++17 -O2 -I../arduino -I$FW -o resampler_bench resampler_bench.cpp $FW/motion_resampler.cpp
+// 사용: ./resampler_bench [--motors N] [--frames N] [--step-us US]
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "motion_player.h"
+#include "motion_resampler.h"
+
+static const char* modeNames[] = { "linear", "hermite", "monotone" };
+
+// ===== 합성 트랙 =====
+// 모터마다 다른 주기의 사인 + 무작위 걸음 (XL330 범위 안, 급한 반전과 정지 구간 포함)
+static void makeTrack(uint8_t motors, uint16_t frames, std::vector<uint8_t>& ids,
+                      std::vector<int32_t>& offsets, MotionTrack& track) {
+  ids.resize(motors);
+  offsets.assign((size_t)frames * motors, 0);
+  srand(1234);
+  for(uint8_t m = 0; m < motors; m++) {
+    ids[m] = m + 1;
+    int32_t walk = 0;
+    for(uint16_t i = 0; i < frames; i++) {
+      walk += rand() % 161 - 80;
+      if(walk > 1500) walk = 1500;
+      if(walk < -1500) walk = -1500;
+      double wave = 1200.0 * sin(i * (0.05 + 0.03 * m));
+      int32_t value = (int32_t)wave + walk;
+      if((i / 40) % 3 == 2) value = offsets[(size_t)(i - 1) * motors + m];   // 정지 구간
+      offsets[(size_t)i * motors + m] = value;
+    }
+  }
+  track.motorCount = motors;
+  track.frameCount = frames;
+  track.frameIntervalUs = 41667;
+  track.motorIds = ids.data();
+  track.offsets = offsets.data();
+  track.profiles = 0;
+}
+
+// 트랙 전체를 stepUs 간격으로 리샘플 (경로 선택은 resampleSetSimd로)
+static void resampleAll(const MotionTrack& track, uint8_t mode, uint32_t stepUs, bool simd,
+                        std::vector<int32_t>& out) {
+  MotionResampler r;
+  initResampler(r, &track, mode);
+  resampleSetSimd(simd);
+  uint32_t duration = resampleDurationUs(&track) + track.frameIntervalUs;
+  out.assign((size_t)(duration / stepUs + 1) * RESAMPLE_LANES, 0);
+  size_t n = 0;
+  for(uint32_t t = 0; t <= duration; t += stepUs, n++) {
+    resampleAt(r, t, &out[n * RESAMPLE_LANES]);
+  }
+  resampleSetSimd(true);
+}
+
+int main(int argc, char** argv) {
+  int motors = DXL_MAX_MOTORS - 1;
+  int frames = 600;
+  int stepUs = 997;   // 프레임 간격과 맞지 않는 간격으로 구간 내 모든 t 근처를 지남
+
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--motors") == 0 && i + 1 < argc) {
+      motors = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frames = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "--step-us") == 0 && i + 1 < argc) {
+      stepUs = atoi(argv[++i]);
+    } else {
+      fprintf(stderr, "Usage: %s [--motors N] [--frames N] [--step-us US]\n", argv[0]);
+      return 1;
+    }
+  }
+  if(motors < 1 || motors > DXL_MAX_MOTORS || frames < 2 || frames > 65535 || stepUs < 1) {
+    fprintf(stderr, "Usage: %s [--motors 1..%d] [--frames 2..65535] [--step-us US]\n", argv[0], DXL_MAX_MOTORS);
+    return 1;
+  }
+  if(!resampleSimdSupported()) {
+    printf("이 CPU는 SSE4.1 미지원: 비교 건너뜀\n");
+    return 0;
+  }
+
+  std::vector<uint8_t> ids;
+  std::vector<int32_t> offsets;
+  MotionTrack track;
+  makeTrack((uint8_t)motors, (uint16_t)frames, ids, offsets, track);
+  printf("합성 트랙: 모터 %d개, %d프레임, %d us 간격으로 리샘플\n", motors, frames, stepUs);
+
+  bool ok = true;
+  for(uint8_t mode = RESAMPLE_LINEAR; mode <= RESAMPLE_MONOTONE; mode++) {
+    std::vector<int32_t> scalar, simd;
+    auto t0 = std::chrono::steady_clock::now();
+    resampleAll(track, mode, (uint32_t)stepUs, false, scalar);
+    auto t1 = std::chrono::steady_clock::now();
+    resampleAll(track, mode, (uint32_t)stepUs, true, simd);
+    auto t2 = std::chrono::steady_clock::now();
+
+    // 유효한 모터 칸만 비교 (RESAMPLE_LANES 패딩 제외)
+    size_t ticks = scalar.size() / RESAMPLE_LANES;
+    size_t mismatches = 0;
+    for(size_t n = 0; n < ticks; n++) {
+      if(memcmp(&scalar[n * RESAMPLE_LANES], &simd[n * RESAMPLE_LANES], motors * sizeof(int32_t)) != 0) {
+        if(mismatches == 0) printf("  첫 불일치: 틱 %zu\n", n);
+        mismatches++;
+      }
+    }
+    double scalarMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    double simdMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    printf("%-9s 틱 %zu개, 불일치 %zu, 스칼라 %.2f ms, SSE4.1 %.2f ms -> %s\n", modeNames[mode],
+           ticks, mismatches, scalarMs, simdMs, mismatches == 0 ? "ok" : "FAILED");
+    if(mismatches) ok = false;
+  }
+  return ok ? 0 : 1;
+}
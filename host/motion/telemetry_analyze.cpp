@@ -0,0 +1,249 @@
+// telemetry_analyze.cpp - 모션 텔레메트리 로그 분석기
+// 로그를 고정 크기 블록씩 읽으며 누적만 하므로 메모리는 로그 길이와 무관 (모터 수 × 히스토그램/지연 창)
+// 모터별: 오차(목표 - 현재) 평균/RMS/최대, |오차| 백분위, 읽기 실패 수, 추종 지연 추정
+// 프레임별: 패킷 생성 시간과 전송 지연의 백분위
+//
+// 추종 지연: 현재 위치를 k 프레임 전 목표와 비교한 |차이| 합이 가장 작은 k (0 ~ --max-lag)
+//            양옆 값으로 포물선 보간해 프레임 이하 단위까지 추정
+//
+// 빌드: g++ -std=c++17 -O2 -o telemetry_analyze telemetry_analyze.cpp
+// 사용: ./telemetry_analyze <telemetry.bin> [--max-lag FRAMES] [--csv]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+#include "telemetry_recorder.h"
+
+#define READ_BLOCK_SAMPLES 4096
+#define DEFAULT_MAX_LAG 50
+
+// ===== 로그-선형 히스토그램 =====
+// 0~63은 1단위, 그 위는 2배 구간마다 32칸 (상대 오차 3% 이하), 백분위는 칸 중앙값
+#define HIST_LINEAR 64
+#define HIST_SUB_BITS 5
+#define HIST_BUCKETS (HIST_LINEAR + 32 * (1 << HIST_SUB_BITS))
+
+struct LogHistogram {
+  std::vector<uint64_t> counts = std::vector<uint64_t>(HIST_BUCKETS, 0);
+  uint64_t total = 0;
+  uint64_t maxValue = 0;
+
+  static int bucketOf(uint64_t v) {
+    if(v < HIST_LINEAR) return (int)v;
+    int e = 63 - __builtin_clzll(v) - HIST_SUB_BITS;    // v >> e 는 32~63
+    int b = HIST_LINEAR + (e - 1) * (1 << HIST_SUB_BITS) + (int)((v >> e) - (1 << HIST_SUB_BITS));
+    return b < HIST_BUCKETS ? b : HIST_BUCKETS - 1;
+  }
+
+  static double bucketMid(int b) {
+    if(b < HIST_LINEAR) return b;
+    int e = (b - HIST_LINEAR) / (1 << HIST_SUB_BITS) + 1;
+    uint64_t low = (uint64_t)((b - HIST_LINEAR) % (1 << HIST_SUB_BITS) + (1 << HIST_SUB_BITS)) << e;
+    return low + ((1ULL << e) - 1) / 2.0;
+  }
+
+  void add(uint64_t v) {
+    counts[bucketOf(v)]++;
+    total++;
+    if(v > maxValue) maxValue = v;
+  }
+
+  double percentile(double q) const {
+    if(total == 0) return 0;
+    uint64_t rank = (uint64_t)ceil(q * total);
+    if(rank == 0) rank = 1;
+    uint64_t seen = 0;
+    for(int b = 0; b < HIST_BUCKETS; b++) {
+      seen += counts[b];
+      if(seen >= rank) return std::min(bucketMid(b), (double)maxValue);
+    }
+    return maxValue;
+  }
+};
+
+// ===== 모터별 누적 =====
+struct MotorStats {
+  uint64_t samples = 0;
+  uint64_t missingReads = 0;
+  double errorSum = 0;
+  double errorSquaredSum = 0;
+  int32_t maxAbsError = 0;
+  uint32_t maxErrorFrame = 0;
+  LogHistogram absError;
+
+  // 지연 추정: 최근 목표 (maxLag + 1개 원형 버퍼)와 지연별 |차이| 합
+  std::vector<int32_t> recentTargets;
+  std::vector<double> lagCost;
+  uint64_t lagSamples = 0;
+  size_t targetCount = 0;
+};
+
+static void usage(const char* name) {
+  fprintf(stderr, "Usage: %s <telemetry.bin> [--max-lag FRAMES] [--csv]\n", name);
+}
+
+// 가장 작은 비용의 지연 (포물선 보간, 프레임 단위)
+static double estimateLag(const MotorStats& m) {
+  if(m.lagSamples == 0) return -1;
+  size_t best = 0;
+  for(size_t k = 1; k < m.lagCost.size(); k++) {
+    if(m.lagCost[k] < m.lagCost[best]) best = k;
+  }
+  if(best == 0 || best + 1 >= m.lagCost.size()) return best;
+  double a = m.lagCost[best - 1], b = m.lagCost[best], c = m.lagCost[best + 1];
+  double denominator = a - 2 * b + c;
+  return denominator > 0 ? best + 0.5 * (a - c) / denominator : best;
+}
+
+int main(int argc, char** argv) {
+  const char* path = 0;
+  int maxLag = DEFAULT_MAX_LAG;
+  bool csv = false;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--max-lag") == 0 && i + 1 < argc) maxLag = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--csv") == 0) csv = true;
+    else if(argv[i][0] != '-' && !path) path = argv[i];
+    else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if(!path || maxLag < 0) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  FILE* file = fopen(path, "rb");
+  if(!file) {
+    perror(path);
+    return 1;
+  }
+
+  TelemetryHeader header;
+  if(fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, TELEMETRY_MAGIC, 4) != 0 ||
+     header.version != TELEMETRY_VERSION || header.sampleBytes != sizeof(TelemetrySample) ||
+     header.motorCount > TELEMETRY_MAX_MOTORS) {
+    fprintf(stderr, "%s: not a telemetry log (version %d)\n", path, TELEMETRY_VERSION);
+    fclose(file);
+    return 1;
+  }
+
+  std::vector<MotorStats> motors(header.motorCount);
+  for(MotorStats& m : motors) {
+    m.recentTargets.assign(maxLag + 1, 0);
+    m.lagCost.assign(maxLag + 1, 0);
+  }
+  LogHistogram buildNs, lateUs;
+  uint64_t total = 0, frames = 0, badIndex = 0;
+  uint32_t firstTimeUs = 0, lastTimeUs = 0;
+
+  // ===== 블록 단위 스트리밍 =====
+  std::vector<TelemetrySample> block(READ_BLOCK_SAMPLES);
+  size_t got;
+  while((got = fread(block.data(), sizeof(TelemetrySample), block.size(), file)) > 0) {
+    for(size_t i = 0; i < got; i++) {
+      const TelemetrySample& s = block[i];
+      if(s.motorIndex >= header.motorCount) {
+        badIndex++;
+        continue;
+      }
+      if(total == 0) firstTimeUs = s.timeUs;
+      lastTimeUs = s.timeUs;
+      total++;
+
+      if(s.motorIndex == 0) {
+        frames++;
+        buildNs.add(s.buildNs);
+        lateUs.add(s.lateUs);
+      }
+
+      MotorStats& m = motors[s.motorIndex];
+      m.samples++;
+      m.recentTargets[m.targetCount % m.recentTargets.size()] = s.target;
+      m.targetCount++;
+      if(s.flags & TELEMETRY_NO_READ) {
+        m.missingReads++;
+        continue;
+      }
+
+      int32_t error = s.target - s.actual;
+      int32_t absError = error < 0 ? -error : error;
+      m.errorSum += error;
+      m.errorSquaredSum += (double)error * error;
+      m.absError.add((uint64_t)absError);
+      if(absError > m.maxAbsError) {
+        m.maxAbsError = absError;
+        m.maxErrorFrame = s.frame;
+      }
+
+      // 목표가 maxLag 프레임 이상 쌓인 뒤부터 지연별 비용 누적
+      if(m.targetCount > (size_t)maxLag) {
+        size_t n = m.targetCount - 1;
+        for(int k = 0; k <= maxLag; k++) {
+          int32_t past = m.recentTargets[(n - k) % m.recentTargets.size()];
+          m.lagCost[k] += fabs((double)past - s.actual);
+        }
+        m.lagSamples++;
+      }
+    }
+  }
+  bool readError = ferror(file) != 0;
+  fclose(file);
+  if(readError) {
+    fprintf(stderr, "%s: read error\n", path);
+    return 1;
+  }
+
+  // 프레임 간격: 헤더 값 대신 실제 전송 시각으로 (제어 주기를 바꿔 재생한 경우 포함)
+  double intervalUs = frames > 1 ? (double)(lastTimeUs - firstTimeUs) / (frames - 1) : header.frameIntervalUs;
+
+  if(csv) {
+    printf("motor,samples,missing,mean_error,rms_error,p50_abs,p95_abs,p99_abs,max_abs,max_frame,lag_frames,lag_ms\n");
+    for(size_t i = 0; i < motors.size(); i++) {
+      const MotorStats& m = motors[i];
+      uint64_t valid = m.samples - m.missingReads;
+      double lag = estimateLag(m);
+      printf("%u,%llu,%llu,%.2f,%.2f,%.0f,%.0f,%.0f,%d,%u,%.2f,%.2f\n", header.motorIds[i],
+             (unsigned long long)m.samples, (unsigned long long)m.missingReads,
+             valid ? m.errorSum / valid : 0.0, valid ? sqrt(m.errorSquaredSum / valid) : 0.0,
+             m.absError.percentile(0.50), m.absError.percentile(0.95), m.absError.percentile(0.99),
+             m.maxAbsError, m.maxErrorFrame, lag, lag >= 0 ? lag * intervalUs / 1000.0 : -1.0);
+    }
+    return 0;
+  }
+
+  printf("=== %s ===\n", path);
+  printf("Samples: %llu (%llu frames, %u motors), dropped at record time %llu",
+         (unsigned long long)total, (unsigned long long)frames, header.motorCount,
+         (unsigned long long)header.droppedCount);
+  if(header.sampleCount != total) printf(", header says %llu", (unsigned long long)header.sampleCount);
+  if(badIndex) printf(", %llu bad motor index", (unsigned long long)badIndex);
+  printf("\nFrame interval: %.0f us measured (%u us nominal)\n", intervalUs, header.frameIntervalUs);
+  printf("Build ns:  p50 %.0f  p90 %.0f  p99 %.0f  p99.9 %.0f  max %llu\n",
+         buildNs.percentile(0.50), buildNs.percentile(0.90), buildNs.percentile(0.99),
+         buildNs.percentile(0.999), (unsigned long long)buildNs.maxValue);
+  printf("Late us:   p50 %.0f  p90 %.0f  p99 %.0f  p99.9 %.0f  max %llu\n",
+         lateUs.percentile(0.50), lateUs.percentile(0.90), lateUs.percentile(0.99),
+         lateUs.percentile(0.999), (unsigned long long)lateUs.maxValue);
+
+  printf("\n%5s %8s %6s %8s %8s %6s %6s %6s %6s %8s %11s\n", "motor", "samples", "miss",
+         "mean", "rms", "p50", "p95", "p99", "max", "max_at", "lag");
+  for(size_t i = 0; i < motors.size(); i++) {
+    const MotorStats& m = motors[i];
+    uint64_t valid = m.samples - m.missingReads;
+    double lag = estimateLag(m);
+    char lagText[32];
+    if(lag < 0) snprintf(lagText, sizeof(lagText), "-");
+    else snprintf(lagText, sizeof(lagText), "%.1f ms", lag * intervalUs / 1000.0);
+    printf("%5u %8llu %6llu %8.1f %8.1f %6.0f %6.0f %6.0f %6d %8u %11s\n", header.motorIds[i],
+           (unsigned long long)m.samples, (unsigned long long)m.missingReads,
+           valid ? m.errorSum / valid : 0.0, valid ? sqrt(m.errorSquaredSum / valid) : 0.0,
+           m.absError.percentile(0.50), m.absError.percentile(0.95), m.absError.percentile(0.99),
+           m.maxAbsError, m.maxErrorFrame, lagText);
+  }
+  return 0;
+}
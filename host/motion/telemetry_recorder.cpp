@@ -0,0 +1,110 @@
+// telemetry_recorder.cpp - 모션 재생 텔레메트리 기록기
+
+#include "telemetry_recorder.h"
+
+#include <string.h>
+#include <chrono>
+
+#define TELEMETRY_IDLE_US 1000    // 링이 비었을 때 쓰기 스레드 대기
+
+TelemetryRecorder::TelemetryRecorder(size_t capacity)
+  : file(0), writeFailed(false), recordedCount(0), droppedCount(0), maxDepth(0) {
+  size_t size = 2;
+  while(size < capacity) size <<= 1;
+  mask = size - 1;
+  samples.resize(size);
+  memset(&header, 0, sizeof(header));
+}
+
+TelemetryRecorder::~TelemetryRecorder() {
+  if(file) close();
+}
+
+//================= 열기 / 닫기 =================
+bool TelemetryRecorder::open(const char* path, const uint8_t* motorIds, size_t motorCount,
+                             uint32_t frameIntervalUs) {
+  if(motorCount > TELEMETRY_MAX_MOTORS) {
+    fprintf(stderr, "Telemetry: too many motors (%zu > %d)\n", motorCount, TELEMETRY_MAX_MOTORS);
+    return false;
+  }
+  file = fopen(path, "wb");
+  if(!file) {
+    perror(path);
+    return false;
+  }
+
+  memcpy(header.magic, TELEMETRY_MAGIC, 4);
+  header.version = TELEMETRY_VERSION;
+  header.sampleBytes = sizeof(TelemetrySample);
+  header.frameIntervalUs = frameIntervalUs;
+  header.motorCount = (uint8_t)motorCount;
+  memcpy(header.motorIds, motorIds, motorCount);
+  if(fwrite(&header, sizeof(header), 1, file) != 1) {
+    perror(path);
+    fclose(file);
+    file = 0;
+    return false;
+  }
+
+  head.store(0, std::memory_order_relaxed);
+  tail.store(0, std::memory_order_relaxed);
+  finished.store(false, std::memory_order_relaxed);
+  recordedCount = droppedCount = 0;
+  maxDepth = 0;
+  writeFailed = false;
+  writer = std::thread(&TelemetryRecorder::writerLoop, this);
+  return true;
+}
+
+bool TelemetryRecorder::close() {
+  if(!file) return false;
+  finished.store(true, std::memory_order_release);
+  writer.join();
+
+  header.sampleCount = recordedCount;
+  header.droppedCount = droppedCount;
+  bool ok = !writeFailed && fseek(file, 0, SEEK_SET) == 0 &&
+            fwrite(&header, sizeof(header), 1, file) == 1;
+  if(fclose(file) != 0) ok = false;
+  file = 0;
+  if(!ok) fprintf(stderr, "Telemetry: write failed\n");
+  return ok;
+}
+
+//================= 생산자 =================
+bool TelemetryRecorder::record(const TelemetrySample& sample) {
+  size_t h = head.load(std::memory_order_relaxed);
+  if(h - tail.load(std::memory_order_acquire) > mask) {
+    droppedCount++;
+    return false;
+  }
+  samples[h & mask] = sample;
+  head.store(h + 1, std::memory_order_release);
+  recordedCount++;
+  return true;
+}
+
+//================= 쓰기 스레드 =================
+// 링 끝에서 끊기지 않는 연속 구간씩 fwrite (한 번에 최대 링 절반)
+void TelemetryRecorder::writerLoop() {
+  for(;;) {
+    bool done = finished.load(std::memory_order_acquire);
+    size_t t = tail.load(std::memory_order_relaxed);
+    size_t h = head.load(std::memory_order_acquire);
+    if(h == t) {
+      if(done) return;
+      std::this_thread::sleep_for(std::chrono::microseconds(TELEMETRY_IDLE_US));
+      continue;
+    }
+
+    if(h - t > maxDepth) maxDepth = h - t;
+    size_t start = t & mask;
+    size_t count = h - t;
+    if(count > samples.size() - start) count = samples.size() - start;
+    if(count > samples.size() / 2) count = samples.size() / 2;
+    if(!writeFailed && fwrite(&samples[start], sizeof(TelemetrySample), count, file) != count) {
+      writeFailed = true;
+    }
+    tail.store(t + count, std::memory_order_release);
+  }
+}
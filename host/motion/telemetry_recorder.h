@@ -0,0 +1,96 @@
+// telemetry_recorder.h - 모션 재생 텔레메트리 기록기 (호스트 전용)
+// 제어 루프는 고정 크기 샘플을 미리 할당한 잠금 없는 SPSC 링에 넣기만 하고 (할당/입출력 없음)
+// 백그라운드 쓰기 스레드가 링의 연속 구간을 그대로 바이너리 로그에 씀
+// 링이 가득 차면 샘플을 버리고 개수만 셈 (제어 루프는 절대 기다리지 않음)
+//
+// 로그 형식 (리틀 엔디안): TelemetryHeader + TelemetrySample × sampleCount
+// sampleCount/droppedCount는 close() 때 헤더에 다시 씀 (중간에 끊긴 로그는 파일 크기로 판단)
+
+#ifndef TELEMETRY_RECORDER_H
+#define TELEMETRY_RECORDER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define TELEMETRY_MAGIC        "DXTL"
+#define TELEMETRY_VERSION      1
+#define TELEMETRY_MAX_MOTORS   32
+
+// 샘플 플래그
+#define TELEMETRY_NO_READ      0x01    // 위치 읽기 실패 (actual 무효)
+
+// ===== 파일 헤더 (64바이트) =====
+struct TelemetryHeader {
+  char magic[4];
+  uint16_t version;
+  uint16_t sampleBytes;          // sizeof(TelemetrySample)
+  uint32_t frameIntervalUs;      // 전송 간격 (제어 주기)
+  uint8_t motorCount;
+  uint8_t reserved[3];
+  uint64_t sampleCount;
+  uint64_t droppedCount;         // 링이 가득 차서 버린 샘플
+  uint8_t motorIds[TELEMETRY_MAX_MOTORS];
+};
+
+// ===== 샘플 (모터 하나 × 전송 프레임 하나, 28바이트) =====
+// buildNs/lateUs는 프레임 단위 값이라 프레임의 모든 모터 샘플에 같이 들어감 (분석기는 motorIndex 0만 셈)
+struct TelemetrySample {
+  uint32_t timeUs;        // 전송 시각 (재생 시작 기준)
+  uint32_t frame;         // 전송 프레임 (틱) 번호
+  int32_t target;         // 보낸 목표 위치 (units)
+  int32_t actual;         // 읽은 현재 위치 (units)
+  uint32_t buildNs;       // 패킷 생성 + 전송 시간
+  uint32_t lateUs;        // 예정 시각 대비 전송 지연
+  uint8_t motorIndex;     // 헤더 motorIds 인덱스
+  uint8_t flags;
+  uint16_t reserved;
+};
+
+static_assert(sizeof(TelemetryHeader) == 64, "telemetry header layout");
+static_assert(sizeof(TelemetrySample) == 28, "telemetry sample layout");
+
+class TelemetryRecorder {
+ public:
+  explicit TelemetryRecorder(size_t capacity = 65536);   // 샘플 수, 2의 거듭제곱으로 올림
+  ~TelemetryRecorder();
+
+  // 로그 파일을 열고 쓰기 스레드 시작 (실패하면 stderr 출력 후 false)
+  bool open(const char* path, const uint8_t* motorIds, size_t motorCount, uint32_t frameIntervalUs);
+
+  // ===== 생산자 (제어 루프) =====
+  bool record(const TelemetrySample& sample);   // 가득 차면 false (버린 수 증가)
+
+  // 남은 샘플을 모두 쓰고 헤더 갱신 후 닫음
+  bool close();
+
+  uint64_t recorded() const { return recordedCount; }
+  uint64_t dropped() const { return droppedCount; }
+  size_t capacity() const { return samples.size(); }
+  size_t highWater() const { return maxDepth; }    // 쓰기 스레드가 본 최대 링 깊이
+
+ private:
+  TelemetryRecorder(const TelemetryRecorder&);
+  TelemetryRecorder& operator=(const TelemetryRecorder&);
+
+  void writerLoop();
+
+  std::vector<TelemetrySample> samples;
+  size_t mask;
+  FILE* file;
+  TelemetryHeader header;
+  std::thread writer;
+  bool writeFailed;
+  uint64_t recordedCount;     // 생산자만 씀
+  uint64_t droppedCount;      // 생산자만 씀
+  size_t maxDepth;            // 쓰기 스레드만 씀
+
+  alignas(64) std::atomic<size_t> head{0};    // 다음에 쓸 위치 (생산자)
+  alignas(64) std::atomic<size_t> tail{0};    // 다음에 읽을 위치 (쓰기 스레드)
+  alignas(64) std::atomic<bool> finished{false};
+};
+
+#endif
@@ -0,0 +1,71 @@
+// track_decimate.cpp - 모션 트랙을 허용 오차 내 최소 키프레임으로 감축
+// 파일별 감축률과 (펌웨어 복원 기준) 최대 오차를 출력
+//
+// 빌드 (FW = ../../Scenario_motion/samsung_motion_player/samsung_motion_player):
+//   g++ -std=c++17 -O2 -I../arduino -I$FW -o track_decimate track_decimate.cpp motion_decimator.cpp
+//       motion_json.cpp track_writer.cpp $FW/motion_keyframes.cpp
+// 사용: ./track_decimate --tol UNITS [--out motion_keyframes_track.h] <motion.json>...
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "motion_json.h"
+#include "host_track.h"
+#include "motion_decimator.h"
+#include "track_writer.h"
+
+int main(int argc, char** argv) {
+  int32_t tolerance = 2;
+  const char* outPath = 0;
+  std::vector<const char*> inputs;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--tol") == 0 && i + 1 < argc) {
+      tolerance = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      outPath = argv[++i];
+    } else {
+      inputs.push_back(argv[i]);
+    }
+  }
+  if(inputs.empty() || tolerance < 0 || (outPath && inputs.size() != 1)) {
+    fprintf(stderr, "Usage: %s --tol UNITS [--out motion_keyframes_track.h] <motion.json>...\n", argv[0]);
+    fprintf(stderr, "       (--out은 입력 파일이 한 개일 때만)\n");
+    return 1;
+  }
+
+  printf("%-28s %7s %6s %8s %9s %9s %7s\n",
+         "file", "samples", "keys", "ratio", "bytes", "key_bytes", "max_err");
+
+  for(const char* path : inputs) {
+    MotionClip clip;
+    if(!loadMotionClip(path, clip)) return 1;
+
+    HostTrack host;
+    makeHostTrack(clip, host);
+
+    KeyframeData keys;
+    decimateTrack(host.track, tolerance, keys);
+    int32_t maxError = keyframeMaxError(host.track, keys.track);
+
+    // 저장 크기: 프레임 트랙 (int32 × 프레임 × 모터) vs 키 (uint16 + int32) + 채널 인덱스
+    size_t samples = host.offsets.size();
+    size_t keyCount = keys.keyFrames.size();
+    size_t denseBytes = samples * sizeof(int32_t);
+    size_t keyBytes = keyCount * (sizeof(uint16_t) + sizeof(int32_t)) +
+                      keys.channelStart.size() * sizeof(uint16_t);
+
+    const char* name = strrchr(path, '/');
+    printf("%-28s %7zu %6zu %7.1fx %9zu %9zu %7d\n", name ? name + 1 : path,
+           samples, keyCount, keyCount ? (double)samples / keyCount : 0.0,
+           denseBytes, keyBytes, maxError);
+
+    if(maxError > tolerance) {
+      fprintf(stderr, "FAILED: %s max error %d > tolerance %d\n", path, maxError, tolerance);
+      return 1;
+    }
+    if(outPath && !writeKeyframeHeader(outPath, path, tolerance, keys)) return 1;
+  }
+  return 0;
+}
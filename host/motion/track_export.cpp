@@ -0,0 +1,108 @@
+// track_export.cpp - 모션 JSON을 펌웨어용 PROGMEM 트랙 헤더로 변환
+// --rate를 주면 리샘플러로 제어 주기에 맞춰 미리 보간한 트랙을 생성 (오프라인 베이크)
+// --profiles를 주면 내보내는 트랙의 구간별 프로파일 속도/가속도도 기록 (motion_profiler.cpp)
+//   --vlimit은 프로파일 속도 상한 (서보의 Velocity Limit(44) 값, 기본 200 = 46 rpm)
+//
+// 빌드 (FW = ../../Scenario_motion/samsung_motion_player/samsung_motion_player):
+//   g++ -std=c++17 -O2 -I../arduino -I$FW -o track_export track_export.cpp motion_json.cpp
+//       track_writer.cpp motion_profiler.cpp $FW/motion_resampler.cpp
+// 사용: ./track_export <motion.json> <motion_track.h> [--rate HZ] [--mode linear|hermite|monotone]
+//         [--profiles] [--vlimit UNITS]
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "motion_json.h"
+#include "host_track.h"
+#include "track_writer.h"
+#include "motion_profiler.h"
+
+// 제어 주기로 리샘플링한 오프셋 생성
+static void bakeResampled(const MotionTrack& track, uint16_t rateHz, int mode,
+                          std::vector<int32_t>& out) {
+  uint32_t intervalUs = 1000000UL / rateHz;
+  uint32_t ticks = resampleDurationUs(&track) / intervalUs + 1;
+
+  MotionResampler resampler;
+  initResampler(resampler, &track, mode);
+
+  int32_t values[RESAMPLE_LANES];
+  out.clear();
+  for(uint32_t n = 0; n < ticks; n++) {
+    resampleAt(resampler, n * intervalUs, values);
+    out.insert(out.end(), values, values + track.motorCount);
+  }
+}
+
+int main(int argc, char** argv) {
+  if(argc < 3) {
+    fprintf(stderr, "Usage: %s <motion.json> <motion_track.h> [--rate HZ] [--mode linear|hermite|monotone] "
+                    "[--profiles] [--vlimit UNITS]\n", argv[0]);
+    return 1;
+  }
+
+  uint16_t rateHz = 0;
+  int mode = RESAMPLE_MONOTONE;
+  bool profiles = false;
+  ProfileSettings settings;
+  defaultProfileSettings(settings);
+  for(int i = 3; i < argc; i++) {
+    if(strcmp(argv[i], "--rate") == 0 && i + 1 < argc) {
+      rateHz = (uint16_t)atoi(argv[++i]);
+    } else if(strcmp(argv[i], "--profiles") == 0) {
+      profiles = true;
+    } else if(strcmp(argv[i], "--vlimit") == 0 && i + 1 < argc) {
+      settings.velocityLimit = (uint16_t)atoi(argv[++i]);
+    } else if(strcmp(argv[i], "--mode") == 0 && i + 1 < argc) {
+      mode = parseResampleMode(argv[++i]);
+      if(mode < 0) {
+        fprintf(stderr, "Unknown mode %s\n", argv[i]);
+        return 1;
+      }
+    }
+  }
+
+  MotionClip clip;
+  if(!loadMotionClip(argv[1], clip)) return 1;
+
+  HostTrack host;
+  makeHostTrack(clip, host);
+
+  // 내보낼 트랙 (베이크했으면 제어 주기 간격의 새 트랙)
+  std::vector<int32_t> baked;
+  const std::vector<int32_t>* offsets = &host.offsets;
+  unsigned long intervalUs = host.track.frameIntervalUs;
+  char description[96];
+  if(rateHz > 0) {
+    bakeResampled(host.track, rateHz, mode, baked);
+    offsets = &baked;
+    intervalUs = 1000000UL / rateHz;
+    static const char* modeNames[] = {"linear", "hermite", "monotone"};
+    snprintf(description, sizeof(description), "%.1f fps -> %u Hz %s", clip.fps, rateHz, modeNames[mode]);
+  } else {
+    snprintf(description, sizeof(description), "%.1f fps", clip.fps);
+  }
+
+  // 구간별 프로파일은 내보내는 트랙 기준으로 계산
+  std::vector<uint16_t> profileData;
+  if(profiles) {
+    MotionTrack view = host.track;
+    view.frameCount = (uint16_t)(offsets->size() / host.ids.size());
+    view.frameIntervalUs = intervalUs;
+    view.offsets = offsets->data();
+    ProfileStats stats;
+    profileTrack(view, settings, profileData, stats);
+    size_t used = strlen(description);
+    snprintf(description + used, sizeof(description) - used, ", profiles");
+    printf("Profiles: max velocity %u, max acceleration %u, %zu/%zu at velocity limit %u\n",
+           stats.maxVelocity, stats.maxAcceleration, stats.velocityClamped, stats.entries, settings.velocityLimit);
+  }
+
+  if(!writeTrackHeader(argv[2], argv[1], description, host.ids, *offsets, intervalUs, profileData)) return 1;
+
+  printf("%s: %zu frames, %zu motors -> %s (%s)\n",
+         argv[1], clip.frameCount(), clip.motorIds.size(), argv[2], description);
+  return 0;
+}
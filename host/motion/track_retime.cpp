@@ -0,0 +1,113 @@
+// track_retime.cpp - 서보 속도/가속도 한계에 맞춰 모션 트랙을 리타이밍
+// 리타이밍된 트랙(motion_track.h)을 생성하고, --csv면 시간 변환 맵(작성 프레임별 재생 시각)을 표준 출력으로
+// (펌웨어에는 시간 변환 조회가 없음, LED 타임라인 큐를 옮길 때 이 표를 보고 맞춤)
+//
+// 빌드 (FW = ../../Scenario_motion/samsung_motion_player/samsung_motion_player):
+//   g++ -std=c++17 -O2 -I../arduino -I$FW -o track_retime track_retime.cpp motion_retimer.cpp
+//       motion_json.cpp track_writer.cpp $FW/motion_resampler.cpp
+// 사용: ./track_retime <motion.json> <motion_track.h>
+//         [--vmax-rpm RPM] [--amax UNITS_PER_S2] [--mode linear|hermite|monotone] [--max-sweeps N] [--csv]
+//   --max-sweeps  가속도 보정 최대 반복 횟수 (기본 RETIME_MAX_SWEEPS)
+//   --csv         frame,authored_ms,playback_ms 출력 (요약은 표준 에러로)
+// 가속도 보정이 수렴하지 않으면 남은 최대 가속도를 출력하고 헤더를 쓰지 않은 채 종료 코드 1
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "motion_json.h"
+#include "host_track.h"
+#include "motion_retimer.h"
+#include "track_writer.h"
+
+// 기본 한계: XH540 (내보낸 JSON의 motor_rpm = 40), 0.1초 안에 최고 속도 도달
+#define DEFAULT_VMAX_RPM        40.0
+#define DEFAULT_RAMP_SECONDS    0.1
+
+int main(int argc, char** argv) {
+  if(argc < 3) {
+    fprintf(stderr, "Usage: %s <motion.json> <motion_track.h> "
+                    "[--vmax-rpm RPM] [--amax UNITS_PER_S2] [--mode linear|hermite|monotone] [--max-sweeps N] [--csv]\n",
+            argv[0]);
+    return 1;
+  }
+
+  double vmaxRpm = DEFAULT_VMAX_RPM;
+  double amax = -1;
+  int mode = RESAMPLE_LINEAR;    // 선형: 구간 내 속도가 한계를 넘지 않음
+  int maxSweeps = RETIME_MAX_SWEEPS;
+  bool csv = false;
+  for(int i = 3; i < argc; i++) {
+    if(strcmp(argv[i], "--vmax-rpm") == 0 && i + 1 < argc) {
+      vmaxRpm = atof(argv[++i]);
+    } else if(strcmp(argv[i], "--amax") == 0 && i + 1 < argc) {
+      amax = atof(argv[++i]);
+    } else if(strcmp(argv[i], "--mode") == 0 && i + 1 < argc) {
+      mode = parseResampleMode(argv[++i]);
+      if(mode < 0) {
+        fprintf(stderr, "Unknown mode %s\n", argv[i]);
+        return 1;
+      }
+    } else if(strcmp(argv[i], "--max-sweeps") == 0 && i + 1 < argc) {
+      maxSweeps = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "--csv") == 0) {
+      csv = true;
+    }
+  }
+
+  MotionClip clip;
+  if(!loadMotionClip(argv[1], clip)) return 1;
+
+  HostTrack host;
+  makeHostTrack(clip, host);
+
+  RetimeLimits limits;
+  limits.maxVelocity = rpmToUnitsPerSecond(vmaxRpm);
+  limits.maxAcceleration = (amax >= 0) ? amax : limits.maxVelocity / DEFAULT_RAMP_SECONDS;
+
+  RetimeResult retime;
+  if(!retimeTrack(host.track, limits, retime, maxSweeps)) {
+    fprintf(stderr, "Acceleration did not converge after %d sweeps: worst %.0f units/s^2 "
+                    "(limit %.0f, +%.1f%%), headers not written\n", retime.sweeps, retime.worstAcceleration,
+            limits.maxAcceleration, (retime.worstAcceleration / limits.maxAcceleration - 1.0) * 100.0);
+    return 1;
+  }
+
+  std::vector<int32_t> baked;
+  bakeRetimedTrack(host.track, retime, host.track.frameIntervalUs, mode, baked);
+
+  char description[64];
+  snprintf(description, sizeof(description), "%.1f fps, retimed %.0f rpm", clip.fps, vmaxRpm);
+  if(!writeTrackHeader(argv[2], argv[1], description, host.ids, baked, host.track.frameIntervalUs,
+                       std::vector<uint16_t>())) return 1;
+
+  if(csv) {
+    printf("frame,authored_ms,playback_ms\n");
+    for(size_t k = 0; k < retime.warpUs.size(); k++) {
+      printf("%zu,%.1f,%.1f\n", k, k * host.track.frameIntervalUs / 1000.0, retime.warpUs[k] / 1000.0);
+    }
+  }
+
+  // 원래 속도로 남은 구간 비율
+  size_t segments = retime.segmentUs.size();
+  size_t kept = 0;
+  for(size_t k = 0; k < segments; k++) {
+    if(retime.segmentUs[k] <= host.track.frameIntervalUs * (1.0 + 1e-6)) kept++;
+  }
+
+  // --csv면 표준 출력은 표만, 요약은 표준 에러로
+  FILE* report = csv ? stderr : stdout;
+  fprintf(report, "=== %s ===\n", argv[1]);
+  fprintf(report, "Limits: %.0f units/s, %.0f units/s^2\n", limits.maxVelocity, limits.maxAcceleration);
+  fprintf(report, "Duration: %.3f s -> %.3f s (+%.1f%%)\n", retime.authoredUs / 1e6, retime.retimedUs / 1e6,
+          retime.authoredUs > 0 ? (retime.retimedUs / retime.authoredUs - 1.0) * 100.0 : 0.0);
+  fprintf(report, "Segments: %zu, kept %zu (%.1f%%), velocity %zu, acceleration %zu (%d sweeps)\n",
+          segments, kept, segments ? kept * 100.0 / segments : 100.0,
+          retime.velocityStretched, retime.accelerationStretched, retime.sweeps);
+  if(limits.maxAcceleration > 0) {
+    fprintf(report, "Worst acceleration: %.0f units/s^2 (%.1f%% of limit)\n", retime.worstAcceleration,
+            retime.worstAcceleration / limits.maxAcceleration * 100.0);
+  }
+  return 0;
+}
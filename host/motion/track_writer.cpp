@@ -0,0 +1,124 @@
+// track_writer.cpp - PROGMEM 트랙 헤더 생성 구현 (호스트 도구 공용)
+
+#include "track_writer.h"
+#include "motion_decimator.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// 상대 위치 트랙 헤더 기록 (offsets[frame * motors + motor])
+bool writeTrackHeader(const char* path, const char* source, const char* description,
+                      const std::vector<uint8_t>& ids, const std::vector<int32_t>& offsets,
+                      unsigned long intervalUs, const std::vector<uint16_t>& profiles) {
+  FILE* f = fopen(path, "w");
+  if(!f) {
+    fprintf(stderr, "Failed to write %s\n", path);
+    return false;
+  }
+
+  size_t motors = ids.size();
+  size_t frames = offsets.size() / motors;
+  const char* name = strrchr(source, '/');
+  name = name ? name + 1 : source;
+
+  fprintf(f, "// motion_track.h - PROGMEM 모션 트랙 (track_export로 생성, 직접 수정 금지)\n");
+  fprintf(f, "// 원본: %s (%s, %zu 프레임, 모터 %zu개)\n\n", name, description, frames, motors);
+  fprintf(f, "#ifndef MOTION_TRACK_H\n#define MOTION_TRACK_H\n\n");
+  fprintf(f, "#include \"motion_player.h\"\n\n");
+  fprintf(f, "#define MOTION_TRACK_MOTORS %zu\n", motors);
+  fprintf(f, "#define MOTION_TRACK_FRAMES %zu\n\n", frames);
+
+  fprintf(f, "const uint8_t motionTrackIds[MOTION_TRACK_MOTORS] PROGMEM = {");
+  for(size_t m = 0; m < motors; m++) {
+    fprintf(f, "%s%d", m ? ", " : "", ids[m]);
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "const int32_t motionTrackOffsets[MOTION_TRACK_FRAMES * MOTION_TRACK_MOTORS] PROGMEM = {\n");
+  for(size_t i = 0; i < frames; i++) {
+    fprintf(f, (i % 8 == 0) ? "  " : " ");
+    for(size_t m = 0; m < motors; m++) {
+      fprintf(f, "%s%ld,", m ? " " : "", (long)offsets[i * motors + m]);
+    }
+    if(i % 8 == 7 || i + 1 == frames) fprintf(f, "\n");
+  }
+  fprintf(f, "};\n\n");
+
+  // 구간별 [프로파일 가속도, 프로파일 속도] (모터 순서, 한 줄에 한 프레임)
+  bool hasProfiles = !profiles.empty();
+  if(hasProfiles) {
+    fprintf(f, "const uint16_t motionTrackProfiles[MOTION_TRACK_FRAMES * MOTION_TRACK_MOTORS * 2] PROGMEM = {\n");
+    for(size_t i = 0; i < frames; i++) {
+      fprintf(f, " ");
+      for(size_t m = 0; m < motors; m++) {
+        size_t at = (i * motors + m) * 2;
+        fprintf(f, " %u, %u,", profiles[at], profiles[at + 1]);
+      }
+      fprintf(f, "\n");
+    }
+    fprintf(f, "};\n\n");
+  }
+
+  fprintf(f, "const MotionTrack motionTrack = {\n");
+  fprintf(f, "  MOTION_TRACK_MOTORS, MOTION_TRACK_FRAMES, %luUL,\n", intervalUs);
+  fprintf(f, "  motionTrackIds, motionTrackOffsets, %s\n};\n\n", hasProfiles ? "motionTrackProfiles" : "0");
+  fprintf(f, "#endif\n");
+
+  fclose(f);
+  return true;
+}
+
+bool writeKeyframeHeader(const char* path, const char* source, int32_t tolerance, const KeyframeData& keys) {
+  FILE* f = fopen(path, "w");
+  if(!f) {
+    fprintf(stderr, "Failed to write %s\n", path);
+    return false;
+  }
+
+  size_t motors = keys.ids.size();
+  size_t count = keys.keyFrames.size();
+  const char* name = strrchr(source, '/');
+  name = name ? name + 1 : source;
+
+  fprintf(f, "// motion_keyframes_track.h - PROGMEM 키프레임 트랙 (track_decimate로 생성, 직접 수정 금지)\n");
+  fprintf(f, "// 원본: %s (%u 프레임 -> 키 %zu개, 허용 오차 %ld units)\n\n",
+          name, keys.track.frameCount, count, (long)tolerance);
+  fprintf(f, "#ifndef MOTION_KEYFRAMES_TRACK_H\n#define MOTION_KEYFRAMES_TRACK_H\n\n");
+  fprintf(f, "#include \"motion_keyframes.h\"\n\n");
+  fprintf(f, "#define MOTION_KEY_MOTORS %zu\n", motors);
+  fprintf(f, "#define MOTION_KEY_COUNT %zu\n\n", count);
+
+  fprintf(f, "const uint8_t motionKeyIds[MOTION_KEY_MOTORS] PROGMEM = {");
+  for(size_t m = 0; m < motors; m++) {
+    fprintf(f, "%s%d", m ? ", " : "", keys.ids[m]);
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "const uint16_t motionKeyChannelStart[MOTION_KEY_MOTORS + 1] PROGMEM = {");
+  for(size_t m = 0; m <= motors; m++) {
+    fprintf(f, "%s%u", m ? ", " : "", keys.channelStart[m]);
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "const uint16_t motionKeyFrames[MOTION_KEY_COUNT] PROGMEM = {\n");
+  for(size_t i = 0; i < count; i++) {
+    fprintf(f, "%s%u,", (i % 12 == 0) ? "  " : " ", keys.keyFrames[i]);
+    if(i % 12 == 11 || i + 1 == count) fprintf(f, "\n");
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "const int32_t motionKeyValues[MOTION_KEY_COUNT] PROGMEM = {\n");
+  for(size_t i = 0; i < count; i++) {
+    fprintf(f, "%s%ld,", (i % 12 == 0) ? "  " : " ", (long)keys.keyValues[i]);
+    if(i % 12 == 11 || i + 1 == count) fprintf(f, "\n");
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "const KeyframeTrack motionKeyframes = {\n");
+  fprintf(f, "  MOTION_KEY_MOTORS, %u, %luUL,\n", keys.track.frameCount, (unsigned long)keys.track.frameIntervalUs);
+  fprintf(f, "  motionKeyIds, motionKeyChannelStart, motionKeyFrames, motionKeyValues\n};\n\n");
+  fprintf(f, "#endif\n");
+
+  fclose(f);
+  return true;
+}
@@ -0,0 +1,20 @@
+// track_writer.h - PROGMEM 트랙 헤더 생성 헤더 (호스트 도구 공용)
+
+#ifndef TRACK_WRITER_H
+#define TRACK_WRITER_H
+
+#include <stdint.h>
+#include <vector>
+
+struct KeyframeData;
+
+// 상대 위치 트랙 헤더 기록 (offsets[frame * motors + motor])
+// profiles가 비어 있지 않으면 구간별 [가속도, 속도] 배열도 기록 (motion_profiler.h 형식)
+bool writeTrackHeader(const char* path, const char* source, const char* description,
+                      const std::vector<uint8_t>& ids, const std::vector<int32_t>& offsets,
+                      unsigned long intervalUs, const std::vector<uint16_t>& profiles);
+
+// 키프레임 트랙 헤더 기록 (motion_keyframes.h 형식)
+bool writeKeyframeHeader(const char* path, const char* source, int32_t tolerance, const KeyframeData& keys);
+
+#endif
@@ -0,0 +1,171 @@
+// blow_bench.cpp - samsung_03_blow 입김 감지 검증/측정 (WAV 파일을 마이크 입력으로)
+// 스케치의 blow_detector.cpp / control.cpp를 그대로 포함해 가상 시계로 실행
+// analogRead()가 가상 시각의 WAV 샘플을 돌려주고, 감지하면 스케치와 같은 펄스를 재생
+//   1) FFT 정확도: 고정소수점 blowFft와 double DFT(/N) 비교 (최대 오차, LSB)
+//   2) 감지 시각 목록 (합성 신호면 기대 시각과 대조, 어긋나면 종료 코드 1)
+//   3) 창당 분석 비용: 호스트 시간과 연산 수 (MCU 사이클은 스케치 blowReport()가 micros()로 측정)
+//
+// 빌드: g++ -std=c++17 -O2 -I../arduino -o blow_bench blow_bench.cpp mic_signal.cpp
+// 사용: ./blow_bench [FILE.wav] [--write-synth OUT.wav] [--blows S,S,...] [--seed N] [--trace]
+//   FILE 없으면 합성 신호 (20초, 입김 1.8 / 9.8초 = sequence20sec_v2 타이밍, 방해음 포함)
+//   --trace  창마다 대역/전체 에너지, 잡음 바닥 출력
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "mic_signal.h"
+
+#define BLOW_DETECT_MODE
+namespace blow {
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/control.cpp"
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/power_strip.cpp"
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/wipe_engine.cpp"
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/blow_detector.cpp"
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/samsung_03_blow.ino"
+}
+
+#define MATCH_TOLERANCE_S  0.15   // 감지 시각 허용 오차 (입김 시작 뒤)
+
+//================= FFT 정확도 =================
+// 최대 오차 (LSB, 결과 = DFT / N 기준)
+static double fftMaxError(std::mt19937& rng) {
+  const int n = BLOW_FFT_SIZE;
+  double worst = 0;
+  for(int round = 0; round < 200; round++) {
+    int16_t re[n], im[n];
+    double xr[n], xi[n];
+    for(int i = 0; i < n; i++) {
+      int v;
+      if(round % 2) v = (int)(16000 * sin(2 * M_PI * (round % 40 + 1) * i / n + round));   // 사인
+      else v = (int)(rng() % 32768) - 16384;                                                 // 잡음
+      re[i] = (int16_t)v;
+      im[i] = 0;
+      xr[i] = v;
+      xi[i] = 0;
+    }
+    blow::blowFft(re, im);
+    for(int k = 0; k < n; k++) {
+      double sr = 0, si = 0;
+      for(int i = 0; i < n; i++) {
+        sr += xr[i] * cos(2 * M_PI * k * i / n) + xi[i] * sin(2 * M_PI * k * i / n);
+        si += xi[i] * cos(2 * M_PI * k * i / n) - xr[i] * sin(2 * M_PI * k * i / n);
+      }
+      worst = fmax(worst, fmax(fabs(re[k] - sr / n), fabs(im[k] - si / n)));
+    }
+  }
+  return worst;
+}
+
+int main(int argc, char** argv) {
+  const char* wavPath = 0;
+  const char* synthOut = 0;
+  bool trace = false;
+  uint32_t seed = 1;
+  std::vector<double> blows = { 1.8, 9.8 };
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--write-synth") == 0 && i + 1 < argc) synthOut = argv[++i];
+    else if(strcmp(argv[i], "--trace") == 0) trace = true;
+    else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc) seed = strtoul(argv[++i], 0, 10);
+    else if(strcmp(argv[i], "--blows") == 0 && i + 1 < argc) {
+      blows.clear();
+      for(char* p = argv[++i]; *p; ) {
+        blows.push_back(strtod(p, &p));
+        if(*p == ',') p++;
+        else if(*p) break;
+      }
+    }
+    else if(argv[i][0] != '-' && !wavPath) wavPath = argv[i];
+    else {
+      fprintf(stderr, "Usage: %s [FILE.wav] [--write-synth OUT.wav] [--blows S,S,...] [--seed N] [--trace]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  // ===== 입력 신호 =====
+  MicSignal signal;
+  if(wavPath) {
+    if(!readWavFile(wavPath, &signal)) return 1;
+  } else {
+    synthBlowSignal(&signal, 16000, 20.0, blows, seed);
+    if(synthOut && !writeWavFile(synthOut, signal)) return 1;
+  }
+  printf("입력 %s: %.2f s, %u Hz\n", wavPath ? wavPath : "합성 신호", signal.seconds(), signal.rateHz);
+
+  std::mt19937 rng(7);
+  printf("FFT %d점 최대 오차 %.2f LSB (double DFT / N 대비)\n", BLOW_FFT_SIZE, fftMaxError(rng));
+
+  // ===== 스케치 실행 (loop()와 같은 순서, 감지 시각 기록) =====
+  hostSetMicros(0);
+  hostAnalogSource = micAnalogRead;
+  hostAnalogContext = &signal;
+  blow::setup();
+
+  std::vector<double> detections;
+  std::vector<double> analysisNs;
+  uint16_t seenWindows = 0;
+  uint64_t endUs = (uint64_t)(signal.seconds() * 1e6);
+  while(micros() < endUs) {
+    auto start = std::chrono::steady_clock::now();
+    bool onset = blow::blowPoll();
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    if(blow::windowCount != seenWindows) {
+      seenWindows = blow::windowCount;
+      analysisNs.push_back(ns);
+      if(trace) {
+        const blow::BlowWindow& w = blow::blowLastWindow();
+        printf("  %7.3f s  band %9lu  total %9lu  floor %8lu%s\n", micros() / 1e6, (unsigned long)w.bandEnergy,
+               (unsigned long)w.totalEnergy, (unsigned long)w.floorEnergy, w.loud ? "  loud" : "");
+      }
+    }
+    if(onset) {
+      detections.push_back(micros() / 1e6);
+      blow::blowPulse();
+      blow::blowResume();
+    } else {
+      hostAdvanceMicros(10);
+    }
+  }
+  hostAnalogSource = 0;
+
+  // ===== 결과 =====
+  printf("\n감지 %zu회:", detections.size());
+  for(double t : detections) printf(" %.3f", t);
+  printf(" s\n");
+
+  int failures = 0;
+  if(!wavPath) {
+    // 입김마다 시작 뒤 MATCH_TOLERANCE_S 안에 정확히 한 번
+    for(double b : blows) {
+      int hits = 0;
+      for(double t : detections) hits += t >= b && t <= b + MATCH_TOLERANCE_S;
+      printf("  입김 %.2f s: %s\n", b, hits == 1 ? "감지" : hits ? "중복 감지" : "놓침");
+      if(hits != 1) failures++;
+    }
+    int extra = (int)detections.size();
+    for(double t : detections) {
+      for(double b : blows) if(t >= b && t <= b + MATCH_TOLERANCE_S) { extra--; break; }
+    }
+    if(extra) printf("  방해음 오감지 %d회\n", extra);
+    failures += extra;
+  }
+
+  // 창당 분석 비용 (나비 N/2 log2 N개, 나비당 16x16→32 곱 4번)
+  std::sort(analysisNs.begin(), analysisNs.end());
+  int butterflies = BLOW_FFT_SIZE / 2 * BLOW_FFT_BITS;
+  printf("\n창 %zu개 (창 %lu us), 분석 호스트 중앙값 %.0f ns, 최대 %.0f ns\n", analysisNs.size(),
+         (unsigned long)BLOW_FFT_SIZE * BLOW_SAMPLE_US, analysisNs.empty() ? 0 : analysisNs[analysisNs.size() / 2],
+         analysisNs.empty() ? 0 : analysisNs.back());
+  printf("창당 연산: 나비 %d개, 16x16 곱 %d번 (FFT %d + 창 함수 %d + 에너지 %d)\n", butterflies,
+         butterflies * 4 + BLOW_FFT_SIZE + (BLOW_FFT_SIZE / 2 - 1) * 2, butterflies * 4, BLOW_FFT_SIZE,
+         (BLOW_FFT_SIZE / 2 - 1) * 2);
+  printf("MCU 사이클은 스케치 시리얼 출력 (blow windows=... cycles=...)으로 확인\n");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+// clock_bench.cpp - AVR처럼 show() 중 micros()가 멈추는 시계에서 스케치 시간 기준 검증
+// NEO_HOST_AVR_TIMING으로 빌드하면 블로킹 show()마다 micros()는 1024us만 진행하고 실제 시각만 전송 시간만큼 감
+// (실제 AVR: 전송 중 인터럽트 금지로 타이머0 오버플로를 놓침), 스케치 시간은 PowerStrip::nowUs()
+//   1) 고정 간격 시계 (sim_clock.cpp): 매 프레임 전송해도 진행한 시뮬레이션 시간 = 실제 경과 시간
+//   2) 번개 스트로브 (lightning_effect.cpp): 전송 시작의 실제 시각 = 미리 계산한 시각표 (LIGHTNING_LATE_US 이내)
+//   3) 프로파일러 (profiler.cpp, PROFILE_MODE): PROF_SHOW = 전송 시간, PROF_IDLE = delay 시간
+//
+// 빌드: g++ -std=c++17 -O2 -DNEO_HOST_AVR_TIMING -I../arduino -o clock_bench clock_bench.cpp
+// 사용: ./clock_bench [--seconds S]
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#ifndef NEO_HOST_AVR_TIMING
+#error "clock_bench needs -DNEO_HOST_AVR_TIMING"
+#endif
+
+#define PROFILE_MODE
+
+namespace rain {
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/control.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/power_strip.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/sim_clock.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/lightning_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/profiler.cpp"
+}
+
+#define LOOP_DELAY_MS 5   // 스케치 loop() 끝의 delay(5)
+#define LIGHTNING_EVENTS (sizeof(rain::eventUs) / sizeof(rain::eventUs[0]))
+
+// ===== 1) 고정 간격 시계 =====
+// 빗방울 스텝 간격으로 시계를 돌리면서 매 프레임 512픽셀 전송, 진행한 스텝 시간과 실제 경과 시간 비교
+static bool checkSimClock(uint32_t seconds) {
+  rain::SimClock clock;
+  rain::simClockBegin(&clock, rain::strip.wireTimeUs());
+  uint64_t realStart = hostRealMicros();
+  unsigned long microsStart = micros();
+  uint32_t steps = 0;
+  uint32_t frames = 0;
+
+  while(hostRealMicros() - realStart < (uint64_t)seconds * 1000000) {
+    rain::simClockAdvance(&clock);
+    while(rain::simClockStep(&clock)) steps++;
+    rain::strip.show();
+    delay(LOOP_DELAY_MS);
+    frames++;
+  }
+  rain::simClockAdvance(&clock);
+  while(rain::simClockStep(&clock)) steps++;
+
+  double realMs = (hostRealMicros() - realStart) / 1000.0;
+  double simulatedMs = ((double)steps * clock.stepUs + clock.accumulatorUs) / 1000.0;
+  double microsMs = (micros() - microsStart) / 1000.0;
+  bool ok = fabs(simulatedMs - realMs) <= clock.stepUs / 1000.0;
+
+  printf("=== 고정 간격 시계 (스텝 %u us, 프레임 %u개) ===\n", (unsigned)clock.stepUs, frames);
+  printf("실제 경과 %.1f ms, micros() 경과 %.1f ms, 시뮬레이션 진행 %.1f ms -> %s\n",
+         realMs, microsMs, simulatedMs, ok ? "ok" : "FAILED");
+  return ok;
+}
+
+// ===== 2) 번개 스트로브 =====
+// 전송마다 실제 시작 시각 기록 (훅은 실제 시각을 받음)
+static void recordShow(const Adafruit_NeoPixel&, uint64_t timeUs, void* context) {
+  ((std::vector<uint64_t>*)context)->push_back(timeUs);
+}
+
+// 스케치 loop()처럼 update + delay(5)를 반복하며 번개 시퀀스 한 번 실행
+static bool checkLightning() {
+  std::vector<uint64_t> shows;
+  hostShowHook = recordShow;
+  hostShowContext = &shows;
+  rain::initLightningEffect();
+  while(!rain::isLightningComplete()) {
+    rain::updateLightningEffect();
+    delay(LOOP_DELAY_MS);
+  }
+  hostShowHook = 0;
+  hostShowContext = 0;
+
+  printf("=== 번개 스트로브 (이벤트 %u개, 늘린 구간 %u개) ===\n",
+         (unsigned)LIGHTNING_EVENTS, rain::stretchedCount);
+  bool ok = shows.size() == LIGHTNING_EVENTS && rain::lateCount == 0 && rain::missedCount == 0;
+  long worst = 0;
+  for(size_t i = 0; i < shows.size() && i < LIGHTNING_EVENTS; i++) {
+    long error = (long)(shows[i] - shows[0]) - (long)(rain::eventUs[i] - rain::eventUs[0]);
+    printf("이벤트 %zu: 예정 %lu us, 실제 %llu us, 차이 %ld us\n", i, (unsigned long)rain::eventUs[i],
+           (unsigned long long)(shows[i] - shows[0]), error);
+    if(labs(error) > labs(worst)) worst = error;
+  }
+  if(labs(worst) > LIGHTNING_LATE_US) ok = false;
+  printf("전송 %zu번, 지연 %u번, 놓침 %u번, 최대 차이 %ld us -> %s\n", shows.size(),
+         rain::lateCount, rain::missedCount, worst, ok ? "ok" : "FAILED");
+  return ok;
+}
+
+// ===== 3) 프로파일러 =====
+// 스케치 loop()처럼 프레임마다 show + delay(5)를 재고, 구간 평균을 전송 시간 / 대기 시간과 비교
+static bool checkProfiler(uint32_t frames) {
+  rain::profileInit();
+  for(uint32_t i = 0; i < frames; i++) {
+    rain::profileFrameBegin();
+    rain::strip.show();
+    rain::profileBegin(rain::PROF_IDLE);
+    delay(LOOP_DELAY_MS);
+    rain::profileEnd(rain::PROF_IDLE);
+    rain::profileFrameEnd();
+  }
+
+  double cyclesPerUs = PROFILE_CYCLES_PER_US;
+  double showUs = rain::histograms[rain::PROF_SHOW].totalCycles / cyclesPerUs / frames;
+  double idleUs = rain::histograms[rain::PROF_IDLE].totalCycles / cyclesPerUs / frames;
+  double wireUs = rain::strip.wireTimeUs();
+  bool ok = fabs(showUs - wireUs) <= 4 && fabs(idleUs - LOOP_DELAY_MS * 1000.0) <= 4;
+
+  printf("=== 프로파일러 (프레임 %u개) ===\n", frames);
+  printf("show 평균 %.1f us (전송 시간 %.0f us), 대기 평균 %.1f us -> %s\n",
+         showUs, wireUs, idleUs, ok ? "ok" : "FAILED");
+  return ok;
+}
+
+int main(int argc, char** argv) {
+  uint32_t seconds = 3;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+      seconds = (uint32_t)atoi(argv[++i]);
+    } else {
+      fprintf(stderr, "Usage: %s [--seconds S]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  hostSetMicros(0);
+  rain::initNeoPixel();
+
+  bool ok = checkSimClock(seconds);
+  ok = checkLightning() && ok;
+  ok = checkProfiler(100) && ok;
+  return ok ? 0 : 1;
+}
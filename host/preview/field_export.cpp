@@ -0,0 +1,121 @@
+// field_export.cpp - 32x16 매트릭스 전환 필드 PROGMEM 헤더 생성 (samsung_04_rain/transition_fields.h)
+// 필드는 스트립 인덱스 순서(세로 지그재그 배선)로 저장, 값 0~255 = 그 픽셀이 드러나는 순서
+//
+// 빌드: g++ -std=c++17 -O2 -o field_export field_export.cpp
+// 사용: ./field_export <transition_fields.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+#define MATRIX_WIDTH   32
+#define MATRIX_HEIGHT  16
+#define LED_COUNT      (MATRIX_WIDTH * MATRIX_HEIGHT)
+#define FIELD_EDGE     16     // 부드러운 가장자리 폭 = 램프 테이블 크기
+
+// transition_effect.h의 TransitionField 순서와 같아야 함
+static const char* fieldNames[] = { "radial", "diagonal", "column", "noise" };
+#define FIELD_COUNT 4
+
+// samsung_04_rain getPixelIndex의 역변환
+static void pixelXY(int index, int* x, int* y) {
+  *x = index / MATRIX_HEIGHT;
+  int row = index % MATRIX_HEIGHT;
+  *y = (*x % 2 == 0) ? row : MATRIX_HEIGHT - 1 - row;
+}
+
+// 결정적 해시 (디졸브 순서용)
+static uint32_t hash32(uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x7FEB352DUL;
+  x ^= x >> 15;
+  x *= 0x846CA68BUL;
+  x ^= x >> 16;
+  return x;
+}
+
+// 원시 거리 → 0~255 (최댓값 기준 정규화)
+static std::vector<uint8_t> normalize(const std::vector<double>& raw) {
+  double top = *std::max_element(raw.begin(), raw.end());
+  std::vector<uint8_t> out(raw.size());
+  for(size_t i = 0; i < raw.size(); i++) {
+    out[i] = (uint8_t)lround(top > 0 ? raw[i] * 255.0 / top : 0);
+  }
+  return out;
+}
+
+static std::vector<uint8_t> buildField(int field) {
+  std::vector<double> raw(LED_COUNT);
+  for(int i = 0; i < LED_COUNT; i++) {
+    int x, y;
+    pixelXY(i, &x, &y);
+    switch(field) {
+      case 0:   // 가운데에서 바깥으로
+        raw[i] = hypot(x - (MATRIX_WIDTH - 1) / 2.0, y - (MATRIX_HEIGHT - 1) / 2.0);
+        break;
+      case 1:   // 왼쪽 위에서 오른쪽 아래로
+        raw[i] = x + y;
+        break;
+      case 2:   // 왼쪽 열부터
+        raw[i] = x;
+        break;
+      default:  // 무작위 순서 (픽셀마다 다른 순위)
+        raw[i] = 0;
+        break;
+    }
+  }
+  if(field == 3) {
+    std::vector<int> order(LED_COUNT);
+    for(int i = 0; i < LED_COUNT; i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [](int a, int b) { return hash32(a) < hash32(b); });
+    for(int rank = 0; rank < LED_COUNT; rank++) raw[order[rank]] = rank;
+  }
+  return normalize(raw);
+}
+
+int main(int argc, char** argv) {
+  if(argc != 2) {
+    fprintf(stderr, "Usage: %s <transition_fields.h>\n", argv[0]);
+    return 1;
+  }
+  FILE* f = fopen(argv[1], "w");
+  if(!f) {
+    fprintf(stderr, "Failed to write %s\n", argv[1]);
+    return 1;
+  }
+
+  fprintf(f, "// transition_fields.h - PROGMEM 전환 필드 (field_export로 생성, 직접 수정 금지)\r\n");
+  fprintf(f, "// 스트립 인덱스 순서, 값 0~255 = 드러나는 순서 (%dx%d 세로 지그재그)\r\n\r\n", MATRIX_WIDTH, MATRIX_HEIGHT);
+  fprintf(f, "#ifndef TRANSITION_FIELDS_H\r\n#define TRANSITION_FIELDS_H\r\n\r\n");
+  fprintf(f, "#include <Arduino.h>\r\n\r\n");
+  fprintf(f, "#define TRANSITION_FIELD_COUNT %d\r\n", FIELD_COUNT);
+  fprintf(f, "#define TRANSITION_FIELD_PIXELS %d\r\n", LED_COUNT);
+  fprintf(f, "#define TRANSITION_EDGE %d\r\n\r\n", FIELD_EDGE);
+
+  // 가장자리 램프: smoothstep, 인덱스 = (경계 - 필드값)
+  fprintf(f, "// 가장자리 밝기 (0~255, smoothstep)\r\n");
+  fprintf(f, "const uint8_t transitionRamp[TRANSITION_EDGE] PROGMEM = {\r\n  ");
+  for(int k = 0; k < FIELD_EDGE; k++) {
+    double t = (double)k / FIELD_EDGE;
+    fprintf(f, "%s%ld", k ? ", " : "", lround(255.0 * t * t * (3 - 2 * t)));
+  }
+  fprintf(f, "\r\n};\r\n\r\n");
+
+  fprintf(f, "const uint8_t transitionFields[TRANSITION_FIELD_COUNT][TRANSITION_FIELD_PIXELS] PROGMEM = {\r\n");
+  for(int field = 0; field < FIELD_COUNT; field++) {
+    std::vector<uint8_t> values = buildField(field);
+    fprintf(f, "  { // %s\r\n", fieldNames[field]);
+    for(int i = 0; i < LED_COUNT; i++) {
+      fprintf(f, (i % 16 == 0) ? "    " : " ");
+      fprintf(f, "%d,", values[i]);
+      if(i % 16 == 15) fprintf(f, "\r\n");
+    }
+    fprintf(f, "  },\r\n");
+  }
+  fprintf(f, "};\r\n\r\n#endif\r\n");
+
+  fclose(f);
+  return 0;
+}
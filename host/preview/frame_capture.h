@@ -0,0 +1,46 @@
+// frame_capture.h - 시뮬레이션 스트립의 show() 프레임 기록
+
+#ifndef FRAME_CAPTURE_H
+#define FRAME_CAPTURE_H
+
+#include <stdint.h>
+#include <vector>
+
+#include <Adafruit_NeoPixel.h>
+
+// ===== 물리 배치 (samsung_04_rain getPixelIndex와 동일한 세로 지그재그) =====
+#define PREVIEW_MATRIX_WIDTH   32
+#define PREVIEW_MATRIX_HEIGHT  16
+
+// ===== 기록된 프레임 (show() 순서, 프레임 크기 = pixelCount * 3) =====
+struct FrameCapture {
+  uint16_t pixelCount = 0;
+  std::vector<uint64_t> timesUs;       // show() 시작 시각 (가상 시계)
+  std::vector<uint8_t> brightness;     // show() 당시 getBrightness() (255 = 스케일 없음)
+  std::vector<uint8_t> wire;           // GRB 전송 값 (밝기 스케일 적용)
+
+  size_t frameCount() const { return timesUs.size(); }
+  const uint8_t* frame(size_t i) const { return &wire[i * pixelCount * 3]; }
+  uint64_t durationUs() const { return timesUs.empty() ? 0 : timesUs.back(); }
+};
+
+// 현재 스레드의 show()를 capture로 연결 (0이면 해제)
+inline void captureStripFrames(FrameCapture* capture) {
+  hostShowContext = capture;
+  hostShowHook = capture ? [](const Adafruit_NeoPixel& strip, uint64_t timeUs, void* context) {
+    FrameCapture* c = (FrameCapture*)context;
+    c->pixelCount = strip.numPixels();
+    c->timesUs.push_back(timeUs);
+    c->brightness.push_back(strip.getBrightness());
+    c->wire.insert(c->wire.end(), strip.getPixels(), strip.getPixels() + strip.numPixels() * 3);
+  } : (HostShowHook)0;
+}
+
+// 물리 좌표 (LED 인덱스 → 열/행)
+inline void previewPixelXY(int index, int* x, int* y) {
+  *x = index / PREVIEW_MATRIX_HEIGHT;
+  int row = index % PREVIEW_MATRIX_HEIGHT;
+  *y = (*x % 2 == 0) ? row : PREVIEW_MATRIX_HEIGHT - 1 - row;
+}
+
+#endif
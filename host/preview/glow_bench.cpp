@@ -0,0 +1,156 @@
+// glow_bench.cpp - samsung_04_rain 빛 번짐(glow_effect.cpp) 검증/측정
+// 스케치의 glow_effect.cpp / control.cpp를 그대로 포함해 측정용 화면(glowBenchFrame)에 적용
+//   1) 정확도: 같은 축별 번짐을 double로 계산한 결과와 비교 (전송 값 GLOW_TOLERANCE 넘게 다르면 종료 코드 1)
+//   2) 더러운 줄만 처리한 결과 = 번짐 영역 전체 처리 결과 (다르면 종료 코드 1)
+//   3) 반지름 1~4 상자/삼각형의 호스트 시간과 처리한 픽셀 수 (MCU 시간은 스케치 GLOW_BENCH_MODE 출력)
+//
+// 빌드: g++ -std=c++17 -O2 -I../arduino -o glow_bench glow_bench.cpp
+// 사용: ./glow_bench [--repeat N] [--brightness N] [--gain N]
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+namespace rain {
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/control.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/power_strip.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/glow_effect.cpp"
+}
+
+#define GLOW_TOLERANCE 2   // 허용 오차 (전송 값, 축마다 반올림 1)
+
+// 현재 전송 버퍼 복사
+static std::vector<uint8_t> wireFrame() {
+  const uint8_t* p = rain::strip.getPixels();
+  return std::vector<uint8_t>(p, p + LED_COUNT * 3);
+}
+
+// 한 축 번짐을 double로 (줄 밖은 0, 결과는 반올림 후 상한에서 포화)
+static void referenceLine(std::vector<uint8_t>& frame, const std::vector<int>& index, int radius,
+                          rain::GlowKernel kernel, double gain, int cap) {
+  int n = (int)index.size();
+  std::vector<double> weights(2 * radius + 1);
+  double total = 0;
+  for(int k = -radius; k <= radius; k++) {
+    weights[k + radius] = kernel == rain::GLOW_TENT ? radius + 1 - abs(k) : 1;
+    total += weights[k + radius];
+  }
+  for(int c = 0; c < 3; c++) {
+    std::vector<int> source(n);
+    for(int i = 0; i < n; i++) source[i] = frame[index[i] * 3 + c];
+    for(int i = 0; i < n; i++) {
+      double blurred = 0;
+      for(int k = -radius; k <= radius; k++) {
+        if(i + k >= 0 && i + k < n) blurred += weights[k + radius] * source[i + k];
+      }
+      int value = source[i] + (int)lround(blurred / total * gain / 256.0);
+      frame[index[i] * 3 + c] = (uint8_t)(value > cap ? cap : value);
+    }
+  }
+}
+
+// 번짐 영역 전체에 가로 → 세로
+static void referenceGlow(std::vector<uint8_t>& frame, int radius, rain::GlowKernel kernel, double gain, int cap) {
+  for(int y = GLOW_TOP_ROW; y <= GLOW_BOTTOM_ROW; y++) {
+    std::vector<int> index;
+    for(int x = 0; x < MATRIX_WIDTH; x++) index.push_back(rain::getPixelIndex(x, y));
+    referenceLine(frame, index, radius, kernel, gain, cap);
+  }
+  for(int x = 0; x < MATRIX_WIDTH; x++) {
+    std::vector<int> index;
+    for(int y = GLOW_TOP_ROW; y <= GLOW_BOTTOM_ROW; y++) index.push_back(rain::getPixelIndex(x, y));
+    referenceLine(frame, index, radius, kernel, gain, cap);
+  }
+}
+
+static int maxDifference(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+  int worst = 0;
+  for(size_t i = 0; i < a.size(); i++) worst = std::max(worst, abs((int)a[i] - (int)b[i]));
+  return worst;
+}
+
+// glowApply 처리 픽셀 수 (가로: 표시된 행 × 폭, 세로: 넓힌 열 × 영역 높이)
+static int processedPixels(int radius, bool fullFrame) {
+  if(fullFrame) return (GLOW_BOTTOM_ROW - GLOW_TOP_ROW + 1) * MATRIX_WIDTH * 2;
+  rain::glowBenchFrame();
+  int rows = __builtin_popcount(rain::dirtyRows);
+  uint32_t columns = rain::dirtyColumns;
+  for(int k = 1; k <= radius; k++) columns |= (rain::dirtyColumns << k) | (rain::dirtyColumns >> k);
+  return rows * MATRIX_WIDTH + __builtin_popcount(columns) * (GLOW_BOTTOM_ROW - GLOW_TOP_ROW + 1);
+}
+
+static double timeApply(int radius, rain::GlowKernel kernel, uint16_t gain, bool fullFrame, int repeat) {
+  double ns = 0;
+  for(int n = 0; n < repeat; n++) {
+    rain::glowBenchFrame();
+    if(fullFrame) rain::glowMarkAll();
+    auto start = std::chrono::steady_clock::now();
+    rain::glowApply(radius, gain, kernel);
+    ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  }
+  return ns / repeat;
+}
+
+int main(int argc, char** argv) {
+  int repeat = 2000;
+  int brightness = 255;
+  int gain = RAIN_GLOW_GAIN;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) repeat = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--brightness") == 0 && i + 1 < argc) brightness = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--gain") == 0 && i + 1 < argc) gain = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "Usage: %s [--repeat N] [--brightness N] [--gain N]\n", argv[0]);
+      return 1;
+    }
+  }
+  if(repeat < 1) repeat = 1;
+
+  rain::initNeoPixel();
+  rain::strip.setBrightness((uint8_t)brightness);
+  int cap = (255 * ((int)rain::strip.getBrightness() + 1)) >> 8;
+
+  printf("밝기 %d (전송 상한 %d), gain %d, 번짐 영역 %d~%d행\n\n", brightness, cap, gain, GLOW_TOP_ROW, GLOW_BOTTOM_ROW);
+  printf("%-6s %-6s %10s %10s %8s %8s %8s %8s %8s\n", "kernel", "radius", "dirty_ns", "full_ns", "dirty_px", "full_px",
+         "ns/px", "ref_err", "result");
+
+  int failures = 0;
+  for(int k = 0; k < 2; k++) {
+    rain::GlowKernel kernel = k ? rain::GLOW_TENT : rain::GLOW_BOX;
+    for(int radius = 1; radius <= GLOW_MAX_RADIUS; radius++) {
+      // 더러운 줄만
+      rain::glowBenchFrame();
+      std::vector<uint8_t> before = wireFrame();
+      rain::glowApply(radius, gain, kernel);
+      std::vector<uint8_t> dirty = wireFrame();
+
+      // 영역 전체
+      rain::glowBenchFrame();
+      rain::glowMarkAll();
+      rain::glowApply(radius, gain, kernel);
+      std::vector<uint8_t> full = wireFrame();
+
+      std::vector<uint8_t> reference = before;
+      referenceGlow(reference, radius, kernel, gain, cap);
+      int error = maxDifference(full, reference);
+      bool same = dirty == full;
+      bool ok = same && error <= GLOW_TOLERANCE;
+      if(!ok) failures++;
+
+      double fullNs = timeApply(radius, kernel, gain, true, repeat);
+      printf("%-6s %-6d %10.0f %10.0f %8d %8d %8.1f %8d %8s\n", k ? "tent" : "box", radius,
+             timeApply(radius, kernel, gain, false, repeat), fullNs, processedPixels(radius, false),
+             processedPixels(radius, true), fullNs / processedPixels(radius, true), error,
+             ok ? "ok" : same ? "FAIL" : "DIRTY");
+    }
+  }
+
+  printf("\n픽셀당 비용은 반지름과 무관 (줄마다 running sum), 더러운 줄 처리 픽셀은 반지름만큼 넓힌 열 때문에 증가\n");
+  printf("MCU 시간은 스케치 GLOW_BENCH_MODE 시리얼 출력으로 확인\n");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,169 @@
+// led_preview.cpp - LED 시나리오 오프라인 프리뷰 렌더러
+// 모든 시나리오 변형을 시뮬레이션 스트립에서 가상 시계로 실행하고 (작업 훔치기 스레드 풀에서 병렬)
+// 시나리오마다 raw 덤프(mmap), Y4M 영상, PNG 스트립 시트, 프레임 해시 목록을 출력
+//
+// 빌드:
+//   g++ -std=c++17 -O2 -pthread -I../arduino -o led_preview led_preview.cpp preview_output.cpp
+//       work_pool.cpp scenario_breathing.cpp scenario_surprise.cpp scenario_blow.cpp scenario_rain.cpp
+//       scenario_companion.cpp
+// 사용: ./led_preview [--out DIR] [--threads N] [--fps N] [--scale N] [--sheet-ms MS]
+//                     [--wire] [--no-video] [--only NAME] [--seed N] [--compare DIR]
+//   --wire      밝기 스케일된 전송 값 그대로 표시 (기본은 역스케일한 색)
+//   --seed      난수 시나리오(rain) 시드, 펌웨어 로그의 시드를 넣으면 같은 화면 재현
+//   --compare   DIR의 <name>.manifest와 프레임 해시 비교 (다르면 종료 코드 1)
+// 결과 표의 frame_ms는 프레임 간격 중앙값 (전송 시간 15.66 ms면 전송 한계 프레임률)
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <sys/stat.h>
+
+#include "preview_scenarios.h"
+#include "frame_capture.h"
+#include "preview_output.h"
+#include "work_pool.h"
+
+// ===== 시나리오별 결과 (작업마다 서로 다른 필드만 기록) =====
+struct PreviewJob {
+  const PreviewScenario* scenario;
+  FrameCapture capture;
+  uint32_t seed = 0;
+  double runMs = 0;
+  bool rawOk = false;
+  bool videoOk = false;
+  bool sheetOk = false;
+  bool manifestOk = false;
+  int diffs = 0;
+  long firstDiff = -1;
+};
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 연속 show() 시작 간격의 중앙값 (ms)
+static double medianFrameMs(const FrameCapture& capture) {
+  if(capture.frameCount() < 2) return 0;
+  std::vector<uint64_t> intervals;
+  for(size_t i = 1; i < capture.frameCount(); i++) {
+    intervals.push_back(capture.timesUs[i] - capture.timesUs[i - 1]);
+  }
+  std::nth_element(intervals.begin(), intervals.begin() + intervals.size() / 2, intervals.end());
+  return intervals[intervals.size() / 2] / 1000.0;
+}
+
+int main(int argc, char** argv) {
+  std::string outDir = "preview_out";
+  const char* compareDir = 0;
+  const char* only = 0;
+  uint32_t seed = 0;
+  unsigned threadCount = std::thread::hardware_concurrency();
+  bool video = true;
+  PreviewRenderOptions options;
+
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--out") == 0 && i + 1 < argc) outDir = argv[++i];
+    else if(strcmp(argv[i], "--threads") == 0 && i + 1 < argc) threadCount = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--fps") == 0 && i + 1 < argc) options.fps = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--scale") == 0 && i + 1 < argc) options.scale = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--sheet-ms") == 0 && i + 1 < argc) options.sheetIntervalMs = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--only") == 0 && i + 1 < argc) only = argv[++i];
+    else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc) seed = strtoul(argv[++i], 0, 0);
+    else if(strcmp(argv[i], "--compare") == 0 && i + 1 < argc) compareDir = argv[++i];
+    else if(strcmp(argv[i], "--wire") == 0) options.wireLevels = true;
+    else if(strcmp(argv[i], "--no-video") == 0) video = false;
+    else {
+      fprintf(stderr, "Usage: %s [--out DIR] [--threads N] [--fps N] [--scale N] [--sheet-ms MS]\n"
+                      "       [--wire] [--no-video] [--only NAME] [--seed N] [--compare DIR]\n", argv[0]);
+      return 1;
+    }
+  }
+  if(options.fps <= 0 || options.scale <= 0 || options.sheetIntervalMs <= 0) {
+    fprintf(stderr, "fps / scale / sheet-ms는 1 이상\n");
+    return 1;
+  }
+  mkdir(outDir.c_str(), 0755);
+
+  // ===== 시나리오 수집 =====
+  const PreviewScenario* (*lists[])(int*) = {
+    breathingScenarios, surpriseScenarios, blowScenarios, rainScenarios, companionScenarios
+  };
+  std::vector<PreviewJob> jobs;
+  for(auto list : lists) {
+    int count;
+    const PreviewScenario* scenarios = list(&count);
+    for(int i = 0; i < count; i++) {
+      if(only && !strstr(scenarios[i].name, only)) continue;
+      jobs.emplace_back();
+      jobs.back().scenario = &scenarios[i];
+    }
+  }
+  if(jobs.empty()) {
+    fprintf(stderr, "실행할 시나리오 없음\n");
+    return 1;
+  }
+
+  // ===== 실행: 시나리오 작업이 끝나면 출력 작업 4개를 같은 워커 큐에 추가 =====
+  auto wallStart = std::chrono::steady_clock::now();
+  {
+    WorkPool pool(threadCount);
+    for(PreviewJob& job : jobs) {
+      pool.submit([&job, &pool, &options, &outDir, compareDir, video, seed] {
+        auto start = std::chrono::steady_clock::now();
+        hostSetMicros(0);
+        randomSeed(1);
+        captureStripFrames(&job.capture);
+        job.seed = job.scenario->run(seed);
+        captureStripFrames(0);
+        job.runMs = elapsedMs(start);
+
+        std::string base = outDir + "/" + job.scenario->name;
+        pool.submit([&job, base] { job.rawOk = writeRawDump((base + ".raw").c_str(), job.capture); });
+        if(video) {
+          pool.submit([&job, &options, base] {
+            job.videoOk = writeY4M((base + ".y4m").c_str(), job.capture, options);
+          });
+        }
+        pool.submit([&job, &options, base] {
+          job.sheetOk = writeStripSheet((base + ".png").c_str(), job.capture, options);
+        });
+        pool.submit([&job, base, compareDir] {
+          if(compareDir) {
+            std::string ref = std::string(compareDir) + "/" + job.scenario->name + ".manifest";
+            job.diffs = compareHashManifest(ref.c_str(), job.capture, &job.firstDiff);
+          }
+          job.manifestOk = writeHashManifest((base + ".manifest").c_str(), job.scenario->name, job.capture);
+        });
+      });
+    }
+    pool.wait();
+    printf("스레드 %u개, 작업 훔치기 %llu회, 전체 %.1f ms\n\n", pool.size(),
+           (unsigned long long)pool.stealCount(), elapsedMs(wallStart));
+  }
+
+  // ===== 결과 =====
+  int failures = 0;
+  printf("%-24s %-22s %7s %9s %9s %9s %10s  %s\n", "scenario", "sketch", "frames", "length_s", "frame_ms",
+         "run_ms", "seed", "result");
+  for(const PreviewJob& job : jobs) {
+    bool ok = job.rawOk && job.sheetOk && job.manifestOk && (job.videoOk || !video);
+    char result[64];
+    if(!ok) snprintf(result, sizeof(result), "출력 실패");
+    else if(!compareDir) snprintf(result, sizeof(result), "ok");
+    else if(job.diffs < 0) snprintf(result, sizeof(result), "기준 없음");
+    else if(job.diffs == 0) snprintf(result, sizeof(result), "동일");
+    else snprintf(result, sizeof(result), "%d 프레임 다름 (첫 프레임 %ld)", job.diffs, job.firstDiff);
+    if(!ok || job.diffs != 0) failures++;
+
+    char seedText[16] = "-";
+    if(job.seed) snprintf(seedText, sizeof(seedText), "%lu", (unsigned long)job.seed);
+    printf("%-24s %-22s %7zu %9.2f %9.2f %9.1f %10s  %s\n", job.scenario->name, job.scenario->sketch,
+           job.capture.frameCount(), job.capture.durationUs() / 1e6, medianFrameMs(job.capture), job.runMs,
+           seedText, result);
+  }
+  return failures ? 1 : 0;
+}
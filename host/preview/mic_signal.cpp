@@ -0,0 +1,157 @@
+// mic_signal.cpp - 마이크 입력 대체 신호
+
+#include "mic_signal.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+//================= WAV =================
+static uint32_t le32(const uint8_t* p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+static uint16_t le16(const uint8_t* p) { return (uint16_t)(p[0] | p[1] << 8); }
+
+bool readWavFile(const char* path, MicSignal* signal) {
+  FILE* f = fopen(path, "rb");
+  if(!f) {
+    fprintf(stderr, "cannot open %s\n", path);
+    return false;
+  }
+  std::vector<uint8_t> bytes;
+  uint8_t buffer[65536];
+  size_t n;
+  while((n = fread(buffer, 1, sizeof(buffer), f)) > 0) bytes.insert(bytes.end(), buffer, buffer + n);
+  fclose(f);
+
+  if(bytes.size() < 12 || memcmp(&bytes[0], "RIFF", 4) != 0 || memcmp(&bytes[8], "WAVE", 4) != 0) {
+    fprintf(stderr, "%s: not a WAV file\n", path);
+    return false;
+  }
+  uint16_t channels = 0, bits = 0;
+  uint32_t rate = 0;
+  size_t pos = 12;
+  while(pos + 8 <= bytes.size()) {
+    uint32_t size = le32(&bytes[pos + 4]);
+    const uint8_t* body = &bytes[pos + 8];
+    if(pos + 8 + size > bytes.size()) size = (uint32_t)(bytes.size() - pos - 8);
+    if(memcmp(&bytes[pos], "fmt ", 4) == 0 && size >= 16) {
+      if(le16(body) != 1) {
+        fprintf(stderr, "%s: only PCM WAV is supported\n", path);
+        return false;
+      }
+      channels = le16(body + 2);
+      rate = le32(body + 4);
+      bits = le16(body + 14);
+    } else if(memcmp(&bytes[pos], "data", 4) == 0) {
+      if(bits != 16 || channels == 0) {
+        fprintf(stderr, "%s: need 16-bit PCM (got %u bits, %u channels)\n", path, bits, channels);
+        return false;
+      }
+      size_t frames = size / (2 * channels);
+      signal->samples.resize(frames);
+      for(size_t i = 0; i < frames; i++) {
+        int32_t sum = 0;
+        for(uint16_t c = 0; c < channels; c++) sum += (int16_t)le16(body + (i * channels + c) * 2);
+        signal->samples[i] = (int16_t)(sum / channels);
+      }
+      signal->rateHz = rate;
+      return true;
+    }
+    pos += 8 + size + (size & 1);
+  }
+  fprintf(stderr, "%s: no data chunk\n", path);
+  return false;
+}
+
+bool writeWavFile(const char* path, const MicSignal& signal) {
+  FILE* f = fopen(path, "wb");
+  if(!f) {
+    fprintf(stderr, "cannot write %s\n", path);
+    return false;
+  }
+  uint32_t dataBytes = (uint32_t)signal.samples.size() * 2;
+  uint8_t header[44];
+  uint32_t riffSize = 36 + dataBytes;
+  memcpy(header, "RIFF", 4);
+  memcpy(header + 4, &riffSize, 4);
+  memcpy(header + 8, "WAVEfmt ", 8);
+  uint32_t fmtSize = 16, byteRate = signal.rateHz * 2;
+  uint16_t format = 1, channels = 1, blockAlign = 2, bits = 16;
+  memcpy(header + 16, &fmtSize, 4);
+  memcpy(header + 20, &format, 2);
+  memcpy(header + 22, &channels, 2);
+  memcpy(header + 24, &signal.rateHz, 4);
+  memcpy(header + 28, &byteRate, 4);
+  memcpy(header + 32, &blockAlign, 2);
+  memcpy(header + 34, &bits, 2);
+  memcpy(header + 36, "data", 4);
+  memcpy(header + 40, &dataBytes, 4);
+  bool ok = fwrite(header, 1, sizeof(header), f) == sizeof(header) &&
+            fwrite(signal.samples.data(), 2, signal.samples.size(), f) == signal.samples.size();
+  if(fclose(f) != 0) ok = false;
+  if(!ok) fprintf(stderr, "write failed: %s\n", path);
+  return ok;
+}
+
+//================= 합성 신호 =================
+void synthBlowSignal(MicSignal* signal, uint32_t rateHz, double seconds, const std::vector<double>& blowTimes,
+                     uint32_t seed) {
+  size_t count = (size_t)(seconds * rateHz);
+  std::vector<double> out(count, 0.0);
+  uint32_t state = seed ? seed : 1;
+  auto noise = [&state]() {
+    state = state * 1664525u + 1013904223u;
+    return (double)(int32_t)state / 2147483648.0;
+  };
+
+  // 배경: 약한 광대역 잡음
+  for(size_t i = 0; i < count; i++) out[i] = 0.004 * noise();
+
+  // 입김: 1차 저역 통과(150 Hz) 두 번 거친 잡음, 30 ms 상승, 0.6 s 유지, 0.2 s 감쇠
+  double a = exp(-2.0 * M_PI * 150.0 / rateHz);
+  for(double start : blowTimes) {
+    double y1 = 0, y2 = 0;
+    for(size_t i = (size_t)(start * rateHz); i < count && i < (size_t)((start + 0.8) * rateHz); i++) {
+      double t = (double)i / rateHz - start;
+      double env = t < 0.03 ? t / 0.03 : t < 0.6 ? 1.0 : 1.0 - (t - 0.6) / 0.2;
+      y1 = a * y1 + (1 - a) * noise();
+      y2 = a * y2 + (1 - a) * y1;
+      out[i] += 6.0 * env * y2;
+    }
+  }
+
+  // 박수: 20 ms 광대역 (짧아서 연속 창 조건에 걸리지 않아야 함)
+  for(size_t i = (size_t)(3.0 * rateHz); i < count && i < (size_t)(3.02 * rateHz); i++) out[i] += 0.5 * noise();
+
+  // 말소리 비슷한 화음: 130 Hz 배음, 포먼트 가중
+  static const double formants[3] = { 600, 1100, 2500 };
+  for(size_t i = (size_t)(5.0 * rateHz); i < count && i < (size_t)(6.0 * rateHz); i++) {
+    double t = (double)i / rateHz;
+    double v = 0;
+    for(int k = 1; k * 130.0 < rateHz / 2; k++) {
+      double f = k * 130.0, gain = 0;
+      for(double formant : formants) gain += exp(-pow((f - formant) / 150.0, 2));
+      v += (0.02 + gain) * sin(2 * M_PI * f * t);
+    }
+    out[i] += 0.12 * v;
+  }
+
+  // 휘파람: 2 kHz
+  for(size_t i = (size_t)(15.0 * rateHz); i < count && i < (size_t)(16.0 * rateHz); i++) {
+    out[i] += 0.3 * sin(2 * M_PI * 2000.0 * i / rateHz);
+  }
+
+  signal->rateHz = rateHz;
+  signal->samples.resize(count);
+  for(size_t i = 0; i < count; i++) {
+    double v = out[i] * 32767;
+    signal->samples[i] = (int16_t)(v > 32767 ? 32767 : v < -32768 ? -32768 : v);
+  }
+}
+
+//================= analogRead() 소스 =================
+int micAnalogRead(uint8_t, uint64_t timeUs, void* context) {
+  const MicSignal* signal = (const MicSignal*)context;
+  size_t i = (size_t)(timeUs * signal->rateHz / 1000000);
+  if(i >= signal->samples.size()) return 512;
+  return 512 + signal->samples[i] / 64;
+}
@@ -0,0 +1,30 @@
+// mic_signal.h - 마이크 입력 대체 신호 (WAV 파일 / 합성 입김 신호)
+// analogRead()에 연결하면 가상 시각의 샘플을 10비트 ADC 값(512 중심)으로 돌려줌
+
+#ifndef MIC_SIGNAL_H
+#define MIC_SIGNAL_H
+
+#include <stdint.h>
+#include <vector>
+
+struct MicSignal {
+  std::vector<int16_t> samples;   // 모노 16비트
+  uint32_t rateHz = 0;
+
+  double seconds() const { return rateHz ? (double)samples.size() / rateHz : 0; }
+};
+
+// PCM 16비트 WAV (여러 채널은 평균), 실패 시 stderr 출력 후 false
+bool readWavFile(const char* path, MicSignal* signal);
+bool writeWavFile(const char* path, const MicSignal& signal);
+
+// 시험 신호: 배경 잡음 + 입김(저역 난류 잡음, blowTimes마다 0.8초) + 방해음
+// 방해음: 3초 박수(20 ms 광대역), 5초 말소리 비슷한 화음(기본 130 Hz, 포먼트 600/1100/2500 Hz 1초),
+//         15초 휘파람(2 kHz 1초)
+void synthBlowSignal(MicSignal* signal, uint32_t rateHz, double seconds, const std::vector<double>& blowTimes,
+                     uint32_t seed);
+
+// analogRead() 소스 (context = const MicSignal*)
+int micAnalogRead(uint8_t pin, uint64_t timeUs, void* context);
+
+#endif
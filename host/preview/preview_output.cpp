@@ -0,0 +1,326 @@
+// preview_output.cpp - 프리뷰 결과 파일 출력
+
+#include "preview_output.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+//================= 해시 =================
+uint64_t previewFrameHash(const FrameCapture& capture, size_t frame) {
+  const uint8_t* p = capture.frame(frame);
+  uint64_t hash = 1469598103934665603ULL;
+  for(size_t i = 0; i < (size_t)capture.pixelCount * 3; i++) {
+    hash ^= p[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+//================= raw 덤프 (mmap) =================
+static void putLE(uint8_t* p, uint64_t value, int bytes) {
+  for(int i = 0; i < bytes; i++) p[i] = (uint8_t)(value >> (8 * i));
+}
+
+bool writeRawDump(const char* path, const FrameCapture& capture) {
+  size_t frameBytes = (size_t)capture.pixelCount * 3;
+  size_t total = RAW_DUMP_HEADER_SIZE + capture.frameCount() * (RAW_FRAME_HEADER_SIZE + frameBytes);
+
+  int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if(fd < 0 || ftruncate(fd, (off_t)total) != 0) {
+    fprintf(stderr, "raw 덤프 생성 실패: %s\n", path);
+    if(fd >= 0) close(fd);
+    return false;
+  }
+  uint8_t* map = (uint8_t*)mmap(0, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if(map == MAP_FAILED) {
+    fprintf(stderr, "raw 덤프 mmap 실패: %s\n", path);
+    return false;
+  }
+
+  memcpy(map, RAW_DUMP_MAGIC, 8);
+  putLE(map + 8, capture.pixelCount, 4);
+  putLE(map + 12, capture.frameCount(), 4);
+
+  uint8_t* p = map + RAW_DUMP_HEADER_SIZE;
+  for(size_t i = 0; i < capture.frameCount(); i++) {
+    putLE(p, capture.timesUs[i], 8);
+    p[8] = capture.brightness[i];
+    memset(p + 9, 0, RAW_FRAME_HEADER_SIZE - 9);
+    memcpy(p + RAW_FRAME_HEADER_SIZE, capture.frame(i), frameBytes);
+    p += RAW_FRAME_HEADER_SIZE + frameBytes;
+  }
+
+  munmap(map, total);
+  return true;
+}
+
+//================= 프레임 렌더링 (물리 배치 RGB 이미지) =================
+static int imageWidth(const PreviewRenderOptions& options) { return PREVIEW_MATRIX_WIDTH * options.scale; }
+static int imageHeight(const PreviewRenderOptions& options) { return PREVIEW_MATRIX_HEIGHT * options.scale; }
+
+// 전송 값 → 표시 색 (Adafruit getPixelColor와 같은 역스케일)
+static uint8_t displayLevel(uint8_t wire, uint8_t brightness, bool wireLevels) {
+  if(wireLevels || brightness == 255) return wire;
+  uint16_t v = ((uint16_t)wire << 8) / (brightness + 1);
+  return v > 255 ? 255 : (uint8_t)v;
+}
+
+// rgb는 stride 바이트 간격의 이미지, (originX, originY)에 그림
+static void renderFrame(const FrameCapture& capture, size_t frame, const PreviewRenderOptions& options,
+                        uint8_t* rgb, int stride, int originX, int originY) {
+  const uint8_t* p = capture.frame(frame);
+  uint8_t brightness = capture.brightness[frame];
+  int s = options.scale;
+  int dot = s >= 3 ? s - 1 : s;
+
+  for(int i = 0; i < capture.pixelCount; i++) {
+    int x, y;
+    previewPixelXY(i, &x, &y);
+    if(y >= PREVIEW_MATRIX_HEIGHT || x >= PREVIEW_MATRIX_WIDTH) continue;
+    uint8_t r = displayLevel(p[i * 3 + 1], brightness, options.wireLevels);
+    uint8_t g = displayLevel(p[i * 3 + 0], brightness, options.wireLevels);
+    uint8_t b = displayLevel(p[i * 3 + 2], brightness, options.wireLevels);
+
+    for(int dy = 0; dy < s; dy++) {
+      uint8_t* row = rgb + (size_t)(originY + y * s + dy) * stride + (originX + x * s) * 3;
+      for(int dx = 0; dx < s; dx++) {
+        bool lit = dx < dot && dy < dot;
+        row[dx * 3 + 0] = lit ? r : 0;
+        row[dx * 3 + 1] = lit ? g : 0;
+        row[dx * 3 + 2] = lit ? b : 0;
+      }
+    }
+  }
+}
+
+// time 시각에 보이는 프레임 (그 시각 이전 마지막 show)
+static size_t frameAt(const FrameCapture& capture, uint64_t timeUs, size_t hint) {
+  while(hint + 1 < capture.frameCount() && capture.timesUs[hint + 1] <= timeUs) hint++;
+  return hint;
+}
+
+//================= Y4M 영상 (C420jpeg, BT.601 풀레인지) =================
+bool writeY4M(const char* path, const FrameCapture& capture, const PreviewRenderOptions& options) {
+  if(capture.frameCount() == 0) return false;
+  FILE* f = fopen(path, "wb");
+  if(!f) {
+    fprintf(stderr, "Y4M 생성 실패: %s\n", path);
+    return false;
+  }
+
+  int w = imageWidth(options);
+  int h = imageHeight(options);
+  fprintf(f, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", w, h, options.fps);
+
+  std::vector<uint8_t> rgb((size_t)w * h * 3);
+  std::vector<uint8_t> yPlane((size_t)w * h);
+  std::vector<uint8_t> cbPlane((size_t)(w / 2) * (h / 2));
+  std::vector<uint8_t> crPlane(cbPlane.size());
+
+  uint64_t endUs = capture.durationUs() + 1000000ULL / options.fps;
+  size_t frame = 0;
+  for(uint32_t k = 0; (uint64_t)k * 1000000ULL / options.fps < endUs; k++) {
+    frame = frameAt(capture, (uint64_t)k * 1000000ULL / options.fps, frame);
+    renderFrame(capture, frame, options, rgb.data(), w * 3, 0, 0);
+
+    for(int i = 0; i < w * h; i++) {
+      int r = rgb[i * 3], g = rgb[i * 3 + 1], b = rgb[i * 3 + 2];
+      yPlane[i] = (uint8_t)((77 * r + 150 * g + 29 * b + 128) >> 8);
+    }
+    for(int y = 0; y < h / 2; y++) {
+      for(int x = 0; x < w / 2; x++) {
+        int r = 0, g = 0, b = 0;
+        for(int j = 0; j < 4; j++) {
+          const uint8_t* p = &rgb[((size_t)(y * 2 + j / 2) * w + x * 2 + j % 2) * 3];
+          r += p[0];
+          g += p[1];
+          b += p[2];
+        }
+        // 2x2 평균 후 변환 (합계 그대로 쓰고 >> 10 으로 평균과 스케일을 함께 처리)
+        cbPlane[y * (w / 2) + x] = (uint8_t)(((-43 * r - 85 * g + 128 * b + 512) >> 10) + 128);
+        crPlane[y * (w / 2) + x] = (uint8_t)(((128 * r - 107 * g - 21 * b + 512) >> 10) + 128);
+      }
+    }
+
+    fputs("FRAME\n", f);
+    fwrite(yPlane.data(), 1, yPlane.size(), f);
+    fwrite(cbPlane.data(), 1, cbPlane.size(), f);
+    fwrite(crPlane.data(), 1, crPlane.size(), f);
+  }
+
+  bool ok = ferror(f) == 0;
+  fclose(f);
+  if(!ok) fprintf(stderr, "Y4M 쓰기 실패: %s\n", path);
+  return ok;
+}
+
+//================= PNG (무압축 deflate 블록) =================
+static uint32_t crcTable[256];
+
+static void initCrcTable() {
+  if(crcTable[1]) return;
+  for(uint32_t n = 0; n < 256; n++) {
+    uint32_t c = n;
+    for(int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320UL ^ (c >> 1) : c >> 1;
+    crcTable[n] = c;
+  }
+}
+
+static void putBE32(std::vector<uint8_t>& out, uint32_t v) {
+  out.push_back(v >> 24);
+  out.push_back(v >> 16);
+  out.push_back(v >> 8);
+  out.push_back(v);
+}
+
+static void writeChunk(FILE* f, const char* type, const std::vector<uint8_t>& data) {
+  std::vector<uint8_t> chunk;
+  putBE32(chunk, (uint32_t)data.size());
+  chunk.insert(chunk.end(), type, type + 4);
+  chunk.insert(chunk.end(), data.begin(), data.end());
+  uint32_t crc = 0xFFFFFFFFUL;
+  for(size_t i = 4; i < chunk.size(); i++) crc = crcTable[(crc ^ chunk[i]) & 0xFF] ^ (crc >> 8);
+  putBE32(chunk, crc ^ 0xFFFFFFFFUL);
+  fwrite(chunk.data(), 1, chunk.size(), f);
+}
+
+static bool writePng(const char* path, const uint8_t* rgb, int w, int h) {
+  FILE* f = fopen(path, "wb");
+  if(!f) {
+    fprintf(stderr, "PNG 생성 실패: %s\n", path);
+    return false;
+  }
+  initCrcTable();
+
+  static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+  fwrite(signature, 1, 8, f);
+
+  std::vector<uint8_t> ihdr;
+  putBE32(ihdr, w);
+  putBE32(ihdr, h);
+  ihdr.push_back(8);   // 비트 깊이
+  ihdr.push_back(2);   // RGB
+  ihdr.push_back(0);
+  ihdr.push_back(0);
+  ihdr.push_back(0);
+  writeChunk(f, "IHDR", ihdr);
+
+  // 행마다 필터 바이트 0
+  std::vector<uint8_t> raw;
+  raw.reserve((size_t)h * (w * 3 + 1));
+  for(int y = 0; y < h; y++) {
+    raw.push_back(0);
+    raw.insert(raw.end(), rgb + (size_t)y * w * 3, rgb + (size_t)(y + 1) * w * 3);
+  }
+
+  // zlib: 무압축 블록 (최대 65535바이트) + Adler-32
+  std::vector<uint8_t> z;
+  z.push_back(0x78);
+  z.push_back(0x01);
+  size_t pos = 0;
+  do {
+    size_t n = raw.size() - pos < 65535 ? raw.size() - pos : 65535;
+    z.push_back(pos + n == raw.size() ? 1 : 0);
+    z.push_back(n & 0xFF);
+    z.push_back(n >> 8);
+    z.push_back(~n & 0xFF);
+    z.push_back((~n >> 8) & 0xFF);
+    z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + n);
+    pos += n;
+  } while(pos < raw.size());
+  uint32_t a = 1, b = 0;
+  for(uint8_t v : raw) {
+    a = (a + v) % 65521;
+    b = (b + a) % 65521;
+  }
+  putBE32(z, (b << 16) | a);
+  writeChunk(f, "IDAT", z);
+  writeChunk(f, "IEND", std::vector<uint8_t>());
+
+  bool ok = ferror(f) == 0;
+  fclose(f);
+  if(!ok) fprintf(stderr, "PNG 쓰기 실패: %s\n", path);
+  return ok;
+}
+
+//================= 스트립 시트 (sheetIntervalMs 간격 칸을 격자로 배치) =================
+#define SHEET_GAP 2
+
+bool writeStripSheet(const char* path, const FrameCapture& capture, const PreviewRenderOptions& options) {
+  if(capture.frameCount() == 0) return false;
+  uint64_t intervalUs = (uint64_t)options.sheetIntervalMs * 1000;
+  int cells = (int)(capture.durationUs() / intervalUs) + 1;
+  int columns = cells < options.sheetColumns ? cells : options.sheetColumns;
+  int rows = (cells + columns - 1) / columns;
+
+  int cellW = imageWidth(options);
+  int cellH = imageHeight(options);
+  int w = columns * (cellW + SHEET_GAP) + SHEET_GAP;
+  int h = rows * (cellH + SHEET_GAP) + SHEET_GAP;
+  std::vector<uint8_t> rgb((size_t)w * h * 3, 48);   // 칸 사이 회색
+
+  size_t frame = 0;
+  for(int c = 0; c < cells; c++) {
+    frame = frameAt(capture, (uint64_t)c * intervalUs, frame);
+    renderFrame(capture, frame, options, rgb.data(), w * 3,
+                SHEET_GAP + (c % columns) * (cellW + SHEET_GAP),
+                SHEET_GAP + (c / columns) * (cellH + SHEET_GAP));
+  }
+  return writePng(path, rgb.data(), w, h);
+}
+
+//================= 해시 목록 =================
+// 형식: "# name frames pixels" 다음 줄마다 "index time_us hash"
+bool writeHashManifest(const char* path, const char* name, const FrameCapture& capture) {
+  FILE* f = fopen(path, "w");
+  if(!f) {
+    fprintf(stderr, "manifest 생성 실패: %s\n", path);
+    return false;
+  }
+  fprintf(f, "# %s %zu %u\n", name, capture.frameCount(), capture.pixelCount);
+  for(size_t i = 0; i < capture.frameCount(); i++) {
+    fprintf(f, "%zu %llu %016llx\n", i, (unsigned long long)capture.timesUs[i],
+            (unsigned long long)previewFrameHash(capture, i));
+  }
+  bool ok = ferror(f) == 0;
+  fclose(f);
+  return ok;
+}
+
+// 시각과 해시가 모두 같아야 같은 프레임, 프레임 수 차이도 다른 프레임으로 셈
+int compareHashManifest(const char* path, const FrameCapture& capture, long* firstDiff) {
+  FILE* f = fopen(path, "r");
+  if(!f) return -1;
+
+  char line[128];
+  if(!fgets(line, sizeof(line), f)) {
+    fclose(f);
+    return -1;
+  }
+
+  int diffs = 0;
+  size_t count = 0;
+  *firstDiff = -1;
+  unsigned long long index, timeUs, hash;
+  while(fscanf(f, "%llu %llu %llx", &index, &timeUs, &hash) == 3) {
+    bool same = index < capture.frameCount() &&
+                capture.timesUs[index] == timeUs &&
+                previewFrameHash(capture, index) == hash;
+    if(!same) {
+      if(*firstDiff < 0) *firstDiff = (long)index;
+      diffs++;
+    }
+    count++;
+  }
+  fclose(f);
+
+  if(count < capture.frameCount()) {
+    if(*firstDiff < 0) *firstDiff = (long)count;
+    diffs += (int)(capture.frameCount() - count);
+  }
+  return diffs;
+}
@@ -0,0 +1,39 @@
+// preview_output.h - 프리뷰 결과 파일 출력 (raw 덤프, Y4M 영상, PNG 스트립 시트, 해시 목록)
+
+#ifndef PREVIEW_OUTPUT_H
+#define PREVIEW_OUTPUT_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "frame_capture.h"
+
+// ===== raw 덤프 형식 (리틀 엔디언) =====
+// 헤더 16바이트: "LEDRAW01", pixelCount(u32), frameCount(u32)
+// 프레임마다: timeUs(u64), brightness(u8), 예약 7바이트, GRB 전송 값 pixelCount*3
+#define RAW_DUMP_MAGIC        "LEDRAW01"
+#define RAW_DUMP_HEADER_SIZE  16
+#define RAW_FRAME_HEADER_SIZE 16
+
+// ===== 렌더 옵션 =====
+struct PreviewRenderOptions {
+  int scale = 4;             // LED 하나당 픽셀 수 (3 이상이면 1픽셀 간격)
+  int fps = 30;              // Y4M 프레임레이트 (show 시각 기준 샘플링)
+  int sheetIntervalMs = 500; // 스트립 시트 칸 간격
+  int sheetColumns = 6;
+  bool wireLevels = false;   // true면 밝기 스케일된 전송 값 그대로, false면 역스케일한 색
+};
+
+// 프레임 하나의 FNV-1a 64비트 해시 (전송 값 기준)
+uint64_t previewFrameHash(const FrameCapture& capture, size_t frame);
+
+// 파일 출력 (실패 시 stderr 출력 후 false)
+bool writeRawDump(const char* path, const FrameCapture& capture);
+bool writeY4M(const char* path, const FrameCapture& capture, const PreviewRenderOptions& options);
+bool writeStripSheet(const char* path, const FrameCapture& capture, const PreviewRenderOptions& options);
+bool writeHashManifest(const char* path, const char* name, const FrameCapture& capture);
+
+// 기준 manifest와 비교: 다른 프레임 수 반환 (파일 없음 -1), firstDiff에 첫 번째 다른 프레임
+int compareHashManifest(const char* path, const FrameCapture& capture, long* firstDiff);
+
+#endif
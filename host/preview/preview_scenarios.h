@@ -0,0 +1,25 @@
+// preview_scenarios.h - 프리뷰 렌더러가 실행하는 LED 시나리오 목록
+
+#ifndef PREVIEW_SCENARIOS_H
+#define PREVIEW_SCENARIOS_H
+
+#include <stdint.h>
+
+// ===== 시나리오 =====
+// run()은 가상 시계 0에서 시작해 시퀀스 끝까지 실행 (한 스레드 안에서만 호출)
+// seed: 난수를 쓰는 시나리오의 재현용 시드 (0 = 스케치 기본), 반환값은 실제 사용한 시드 (난수 없으면 0)
+struct PreviewScenario {
+  const char* name;      // 출력 파일 이름
+  const char* sketch;    // 원본 스케치 폴더
+  uint32_t (*run)(uint32_t seed);
+};
+
+// ===== 스케치별 목록 (scenario_*.cpp) =====
+// 변형마다 별도 네임스페이스에 스케치 소스를 포함하므로 strip과 정적 변수가 서로 독립
+const PreviewScenario* breathingScenarios(int* count);
+const PreviewScenario* surpriseScenarios(int* count);
+const PreviewScenario* blowScenarios(int* count);
+const PreviewScenario* rainScenarios(int* count);
+const PreviewScenario* companionScenarios(int* count);
+
+#endif
@@ -0,0 +1,114 @@
+// profile_report.cpp - 펌웨어 프로파일 덤프(profiler.cpp 바이너리 레코드) 해석
+// 시리얼 캡처 파일에서 'P' 'F' 레코드를 찾아 체크섬 확인 후 항목별 표와 히스토그램 출력
+//
+// 빌드: g++ -std=c++17 -O2 -o profile_report profile_report.cpp
+// 사용: ./profile_report <capture.bin>     (예: 'P' 전송 후 시리얼 포트를 파일로 저장)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// 헤더: 'P' 'F' version metrics buckets shift frames(4) cyclesPerUs stackUsed(2) stackFree(2)
+#define PROFILE_HEADER_SIZE 15
+
+static const char* metricNames[] = {
+  "render", "show", "idle", "cloud", "rain", "lightning", "fade_to_rain", "glow"
+};
+
+static uint32_t readLE(const uint8_t* p, int bytes) {
+  uint32_t v = 0;
+  for(int i = 0; i < bytes; i++) v |= (uint32_t)p[i] << (8 * i);
+  return v;
+}
+
+// 버킷 누적 비율이 fraction에 도달하는 버킷 상한 (사이클)
+static uint64_t bucketPercentile(const uint8_t* buckets, int count, int shift, double fraction) {
+  uint32_t total = 0;
+  for(int b = 0; b < count; b++) total += readLE(buckets + b * 2, 2);
+  uint32_t seen = 0;
+  for(int b = 0; b < count; b++) {
+    seen += readLE(buckets + b * 2, 2);
+    if(total && seen >= fraction * total) return 1ULL << (shift + b);
+  }
+  return 1ULL << (shift + count - 1);
+}
+
+// 레코드 하나 출력, 레코드 길이 반환 (형식 오류 0)
+static size_t reportRecord(const uint8_t* p, size_t available) {
+  if(available < PROFILE_HEADER_SIZE || p[2] != 1) return 0;
+  int metrics = p[3];
+  int buckets = p[4];
+  int shift = p[5];
+  size_t length = PROFILE_HEADER_SIZE + (size_t)metrics * (8 + buckets * 2) + 1;
+  if(length > available) return 0;
+
+  uint8_t sum = 0;
+  for(size_t i = 0; i + 1 < length; i++) sum += p[i];
+  if(sum != p[length - 1]) {
+    fprintf(stderr, "체크섬 불일치 (0x%02X != 0x%02X)\n", sum, p[length - 1]);
+    return 0;
+  }
+
+  uint32_t frames = readLE(p + 6, 4);
+  int cyclesPerUs = p[10] ? p[10] : 1;
+  printf("frames %u, 스택 최대 사용 %u B, 최소 여유 %u B\n\n", frames, readLE(p + 11, 2), readLE(p + 13, 2));
+  printf("%-13s %8s %10s %10s %10s %10s   histogram (<2^%d 사이클부터 ×2)\n",
+         "metric", "samples", "avg_us", "p50_us", "p95_us", "max_us", shift);
+
+  const uint8_t* m = p + PROFILE_HEADER_SIZE;
+  for(int k = 0; k < metrics; k++, m += 8 + buckets * 2) {
+    uint32_t maxCycles = readLE(m, 4);
+    uint32_t totalCycles = readLE(m + 4, 4);
+    uint32_t samples = 0;
+    for(int b = 0; b < buckets; b++) samples += readLE(m + 8 + b * 2, 2);
+
+    const char* name = k < (int)(sizeof(metricNames) / sizeof(metricNames[0])) ? metricNames[k] : "?";
+    if(samples == 0) {
+      printf("%-13s %8u %10s %10s %10s %10s\n", name, samples, "-", "-", "-", "-");
+      continue;
+    }
+    printf("%-13s %8u %10.1f %10llu %10llu %10.1f   ", name, samples,
+           (double)totalCycles / samples / cyclesPerUs,
+           (unsigned long long)(bucketPercentile(m + 8, buckets, shift, 0.5) / cyclesPerUs),
+           (unsigned long long)(bucketPercentile(m + 8, buckets, shift, 0.95) / cyclesPerUs),
+           (double)maxCycles / cyclesPerUs);
+    for(int b = 0; b < buckets; b++) printf("%s%u", b ? " " : "", readLE(m + 8 + b * 2, 2));
+    printf("\n");
+  }
+  return length;
+}
+
+int main(int argc, char** argv) {
+  if(argc != 2) {
+    fprintf(stderr, "Usage: %s <capture.bin>\n", argv[0]);
+    return 1;
+  }
+  FILE* f = fopen(argv[1], "rb");
+  if(!f) {
+    fprintf(stderr, "파일 열기 실패: %s\n", argv[1]);
+    return 1;
+  }
+  std::vector<uint8_t> data;
+  uint8_t chunk[4096];
+  size_t n;
+  while((n = fread(chunk, 1, sizeof(chunk), f)) > 0) data.insert(data.end(), chunk, chunk + n);
+  fclose(f);
+
+  // 디버그 텍스트가 섞여 있을 수 있으므로 헤더를 찾아가며 해석
+  int records = 0;
+  for(size_t i = 0; i + 1 < data.size(); i++) {
+    if(data[i] != 'P' || data[i + 1] != 'F') continue;
+    size_t length = reportRecord(&data[i], data.size() - i);
+    if(length) {
+      records++;
+      i += length - 1;
+      printf("\n");
+    }
+  }
+  if(records == 0) {
+    fprintf(stderr, "프로파일 레코드 없음\n");
+    return 1;
+  }
+  return 0;
+}
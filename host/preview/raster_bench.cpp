@@ -0,0 +1,136 @@
+// raster_bench.cpp - samsung_05_companion 도형 래스터라이저 검증/측정
+// 스케치의 shape_raster.cpp / companion_face.cpp / text_scroller.cpp / raster_bench.cpp를 그대로 포함해 같은 항목을 그림
+//   1) 채우기 도형의 덮임 합(밝기 255에서 채널 값 합)과 해석적 면적 비교 (MAX_AREA_ERROR 넘으면 종료 코드 1)
+//   2) 항목별 호스트 그리기 시간, 칠해진 픽셀 수 (경계 픽셀 = 0과 255 사이)
+//   3) 글자 스크롤 한 프레임 비용 (짧은/긴 메시지가 비슷해야 함, 메시지 설정은 따로)
+//   4) 표정 항목의 호스트 시간과 30fps 그리기 예산 (MCU 시간은 스케치 RASTER_BENCH_MODE 출력으로 확인)
+//
+// 빌드: g++ -std=c++17 -O2 -I../arduino -o raster_bench raster_bench.cpp
+// 사용: ./raster_bench [--repeat N] [--dump NAME]
+//   --dump  항목 하나를 그린 결과를 채널 값 격자로 출력
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+namespace companion {
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/control.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/power_strip.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/shape_raster.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/companion_face.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/text_scroller.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/raster_bench.cpp"
+}
+
+#define MAX_AREA_ERROR 0.03   // 면적 허용 오차 (비율)
+
+// 화면 전체의 빨강 채널 합 (1/256 픽셀 단위로 환산), 켜진 픽셀 / 경계 픽셀 수
+static void measureCoverage(uint32_t* area, int* lit, int* edge) {
+  uint64_t sum = 0;
+  *lit = 0;
+  *edge = 0;
+  for(int y = 0; y < MATRIX_HEIGHT; y++) {
+    for(int x = 0; x < MATRIX_WIDTH; x++) {
+      uint8_t r = (uint8_t)(companion::getPixel(x, y) >> 16);
+      sum += r;
+      if(r) (*lit)++;
+      if(r && r < 255) (*edge)++;
+    }
+  }
+  *area = (uint32_t)((sum * 256 + 127) / 255);
+}
+
+static void dumpCase(uint8_t index) {
+  companion::clearMatrix();
+  companion::rasterBenchPrepare(index);
+  companion::rasterBenchDraw(index);
+  printf("%s\n", companion::rasterBenchName(index));
+  for(int y = 0; y < MATRIX_HEIGHT; y++) {
+    for(int x = 0; x < MATRIX_WIDTH; x++) {
+      uint32_t c = companion::getPixel(x, y);
+      uint8_t v = max(max((uint8_t)(c >> 16), (uint8_t)(c >> 8)), (uint8_t)c);
+      printf(v ? "%4u" : "   .", v);
+    }
+    printf("\n");
+  }
+}
+
+int main(int argc, char** argv) {
+  int repeat = 2000;
+  const char* dumpName = 0;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) repeat = atoi(argv[++i]);
+    else if(strcmp(argv[i], "--dump") == 0 && i + 1 < argc) dumpName = argv[++i];
+    else {
+      fprintf(stderr, "Usage: %s [--repeat N] [--dump NAME]\n", argv[0]);
+      return 1;
+    }
+  }
+  if(repeat < 1) repeat = 1;
+
+  companion::initNeoPixel();
+  companion::strip.setBrightness(255);   // 역스케일 손실 없이 덮임 값을 읽음
+
+  uint8_t count = companion::rasterBenchCount();
+  if(dumpName) {
+    for(uint8_t i = 0; i < count; i++) {
+      if(strcmp(companion::rasterBenchName(i), dumpName) == 0) {
+        dumpCase(i);
+        return 0;
+      }
+    }
+    fprintf(stderr, "unknown case: %s\n", dumpName);
+    return 1;
+  }
+
+  printf("%-18s %10s %6s %6s %10s %10s %7s\n", "shape", "host_ns", "lit", "edge", "area", "expected", "error");
+  int failures = 0;
+  double worstFaceNs = 0;
+  double textFrameNs[2] = { 0, 0 };   // 짧은 / 긴 메시지
+  uint16_t textColumns[2] = { 0, 0 };
+  for(uint8_t i = 0; i < count; i++) {
+    // 면적은 빈 화면에 한 번 그린 결과로 (같은 도형을 겹쳐 그리면 덮임이 누적됨)
+    companion::clearMatrix();
+    companion::rasterBenchPrepare(i);
+    companion::rasterBenchDraw(i);
+    uint32_t area;
+    int lit, edge;
+    measureCoverage(&area, &lit, &edge);
+
+    auto start = std::chrono::steady_clock::now();
+    for(int n = 0; n < repeat; n++) {
+      companion::rasterBenchDraw(i);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / repeat;
+    if(companion::rasterBenchIsFace(i) && ns > worstFaceNs) worstFaceNs = ns;
+    if(i == companion::BENCH_TEXT_SHORT || i == companion::BENCH_TEXT_LONG) {
+      int slot = i == companion::BENCH_TEXT_LONG;
+      textFrameNs[slot] = ns;
+      textColumns[slot] = companion::textColumnCount();
+    }
+
+    uint32_t expected = companion::rasterBenchArea(i);
+    printf("%-18s %10.0f %6d %6d %10.2f", companion::rasterBenchName(i), ns, lit, edge, area / 256.0);
+    if(expected) {
+      double error = ((double)area - expected) / expected;
+      bool ok = fabs(error) <= MAX_AREA_ERROR;
+      printf(" %10.2f %+6.2f%%%s\n", expected / 256.0, error * 100, ok ? "" : "  FAIL");
+      if(!ok) failures++;
+    } else {
+      printf(" %10s %7s\n", "-", "-");
+    }
+  }
+
+  printf("\n글자 스크롤 프레임: %u열 메시지 %.0f ns, %u열 메시지 %.0f ns (비율 %.2f)\n", textColumns[0],
+         textFrameNs[0], textColumns[1], textFrameNs[1], textFrameNs[0] > 0 ? textFrameNs[1] / textFrameNs[0] : 0);
+
+  uint32_t wireUs = companion::strip.wireTimeUs();
+  uint32_t drawBudget = FACE_FRAME_BUDGET_US - wireUs;
+  printf("표정 최대 호스트 %.1f us, 30fps 그리기 예산 %lu us (프레임 %lu - 전송 %lu)\n", worstFaceNs / 1000,
+         (unsigned long)drawBudget, (unsigned long)FACE_FRAME_BUDGET_US, (unsigned long)wireUs);
+  printf("MCU 시간은 스케치 RASTER_BENCH_MODE 시리얼 출력 (face worst ... us)으로 확인\n");
+  return failures ? 1 : 0;
+}
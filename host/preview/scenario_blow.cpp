@@ -0,0 +1,64 @@
+// scenario_blow.cpp - samsung_03_blow 스케치 프리뷰 변형
+// 같은 control.cpp를 변형마다 다시 포함 (헤더 가드를 풀어 선언도 다시 들어가게 함)
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "preview_scenarios.h"
+
+namespace blow_27 {
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/control.cpp"
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/power_strip.cpp"
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/wipe_engine.cpp"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+#undef WIPE_ENGINE_H
+
+namespace blow_20 {
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/control.cpp"
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/power_strip.cpp"
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/wipe_engine.cpp"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+#undef WIPE_ENGINE_H
+
+namespace blow_20_v2 {
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/control.cpp"
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/power_strip.cpp"
+#include "../../Scenario_led/samsung_03_blow/samsung_03_blow/wipe_engine.cpp"
+}
+
+static uint32_t runBlow27(uint32_t) {
+  blow_27::initNeoPixel();
+  blow_27::sequence27sec();
+  blow_27::turnOffAllLED();
+  return 0;
+}
+
+static uint32_t runBlow20(uint32_t) {
+  blow_20::initNeoPixel();
+  blow_20::sequence20sec();
+  blow_20::turnOffAllLED();
+  return 0;
+}
+
+static uint32_t runBlow20v2(uint32_t) {
+  blow_20_v2::initNeoPixel();
+  blow_20_v2::sequence20sec_v2();
+  blow_20_v2::turnOffAllLED();
+  return 0;
+}
+
+static const PreviewScenario scenarios[] = {
+  { "blow_27sec",     "samsung_03_blow", runBlow27 },
+  { "blow_20sec",     "samsung_03_blow", runBlow20 },
+  { "blow_20sec_v2",  "samsung_03_blow", runBlow20v2 },
+};
+
+const PreviewScenario* blowScenarios(int* count) {
+  *count = sizeof(scenarios) / sizeof(scenarios[0]);
+  return scenarios;
+}
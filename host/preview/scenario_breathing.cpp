@@ -0,0 +1,46 @@
+// scenario_breathing.cpp - samsung_01_breathing 스케치 프리뷰 변형
+// 팔레트 변형은 같은 시퀀스를 PALETTE_MODE로 다시 포함 (기본 변형과 프레임 해시가 같아야 함)
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "preview_scenarios.h"
+
+namespace breathing_27 {
+#include "../../Scenario_led/samsung_01_breathing/samsung_01_breathing/control.cpp"
+#include "../../Scenario_led/samsung_01_breathing/samsung_01_breathing/power_strip.cpp"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+
+#define PALETTE_MODE
+namespace breathing_27_palette {
+#include "../../Scenario_led/samsung_01_breathing/samsung_01_breathing/control.cpp"
+#include "../../Scenario_led/samsung_01_breathing/samsung_01_breathing/power_strip.cpp"
+#include "../../Scenario_led/samsung_01_breathing/samsung_01_breathing/palette_strip.cpp"
+}
+#undef PALETTE_MODE
+
+static uint32_t runBreathing27(uint32_t) {
+  breathing_27::initNeoPixel();
+  breathing_27::sequence27sec();
+  breathing_27::turnOffAllLED();
+  return 0;
+}
+
+static uint32_t runBreathing27Palette(uint32_t) {
+  breathing_27_palette::initNeoPixel();
+  breathing_27_palette::sequence27sec();
+  breathing_27_palette::turnOffAllLED();
+  return 0;
+}
+
+static const PreviewScenario scenarios[] = {
+  { "breathing_27sec",         "samsung_01_breathing", runBreathing27 },
+  { "breathing_27sec_palette", "samsung_01_breathing", runBreathing27Palette },
+};
+
+const PreviewScenario* breathingScenarios(int* count) {
+  *count = sizeof(scenarios) / sizeof(scenarios[0]);
+  return scenarios;
+}
@@ -0,0 +1,33 @@
+// scenario_companion.cpp - samsung_05_companion 스케치 프리뷰 (setup/loop 그대로 실행)
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "preview_scenarios.h"
+
+namespace companion {
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/control.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/power_strip.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/shape_raster.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/companion_face.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/text_scroller.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/raster_bench.cpp"
+#include "../../Scenario_led/samsung_05_companion/samsung_05_companion/samsung_05_companion.ino"
+}
+
+// 시퀀스가 끝나면 loop()가 delay 없이 바로 반환하므로 상태로 종료 판단
+static uint32_t runCompanion(uint32_t) {
+  companion::setup();
+  while(!companion::sequenceComplete) {
+    companion::loop();
+  }
+  return 0;
+}
+
+static const PreviewScenario scenarios[] = {
+  { "companion_face",  "samsung_05_companion", runCompanion },
+};
+
+const PreviewScenario* companionScenarios(int* count) {
+  *count = sizeof(scenarios) / sizeof(scenarios[0]);
+  return scenarios;
+}
@@ -0,0 +1,216 @@
+// scenario_rain.cpp - samsung_04_rain 스케치 프리뷰 (setup/loop 그대로 실행)
+// rain_polled_lightning: 번개를 예전처럼 loop()마다 확인 (LIGHTNING_STROBE_MODE 0, 스트로브와 비교용)
+// rain_30fps: 30fps로만 그림 (RENDER_FRAME_US), 빗방울/구름 위치는 같은 시각의 rain과 같아야 함
+// rain_glow: 빗방울 빛 번짐 켬 (RAIN_GLOW_RADIUS 2, 스케치 기본은 끔, 번짐 비교용)
+// rain_uniform_fade: 비 페이드인을 예전처럼 화면 전체가 같이 밝아지게 (FADE_TO_RAIN_FIELD -1, 필드 전환과 비교용)
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "preview_scenarios.h"
+
+namespace rain {
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/control.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/power_strip.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/rain_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/background_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/cloud_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/lightning_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/fade_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/transition_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/fast_random.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/sim_clock.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/glow_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/profiler.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/samsung_04_rain.ino"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+#undef RAIN_EFFECT_H
+#undef BACKGROUND_EFFECT_H
+#undef CLOUD_EFFECT_H
+#undef LIGHTNING_EFFECT_H
+#undef FADE_EFFECT_H
+#undef TRANSITION_EFFECT_H
+#undef TRANSITION_FIELDS_H
+#undef FAST_RANDOM_H
+#undef PROFILER_H
+#undef SIM_CLOCK_H
+#undef GLOW_EFFECT_H
+#undef LIGHTNING_STROBE_MODE
+#define LIGHTNING_STROBE_MODE 0
+
+namespace rain_polled {
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/control.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/power_strip.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/rain_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/background_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/cloud_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/lightning_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/fade_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/transition_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/fast_random.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/sim_clock.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/glow_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/profiler.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/samsung_04_rain.ino"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+#undef RAIN_EFFECT_H
+#undef BACKGROUND_EFFECT_H
+#undef CLOUD_EFFECT_H
+#undef LIGHTNING_EFFECT_H
+#undef FADE_EFFECT_H
+#undef TRANSITION_EFFECT_H
+#undef TRANSITION_FIELDS_H
+#undef FAST_RANDOM_H
+#undef PROFILER_H
+#undef SIM_CLOCK_H
+#undef GLOW_EFFECT_H
+#undef LIGHTNING_STROBE_MODE
+#undef RENDER_FRAME_US
+#define RENDER_FRAME_US 33333
+
+namespace rain_30fps {
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/control.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/power_strip.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/rain_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/background_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/cloud_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/lightning_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/fade_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/transition_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/fast_random.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/sim_clock.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/glow_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/profiler.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/samsung_04_rain.ino"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+#undef RAIN_EFFECT_H
+#undef BACKGROUND_EFFECT_H
+#undef CLOUD_EFFECT_H
+#undef LIGHTNING_EFFECT_H
+#undef FADE_EFFECT_H
+#undef TRANSITION_EFFECT_H
+#undef TRANSITION_FIELDS_H
+#undef FAST_RANDOM_H
+#undef PROFILER_H
+#undef SIM_CLOCK_H
+#undef GLOW_EFFECT_H
+#undef RENDER_FRAME_US
+#undef RAIN_GLOW_RADIUS
+#define RAIN_GLOW_RADIUS 2
+
+namespace rain_glow {
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/control.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/power_strip.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/rain_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/background_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/cloud_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/lightning_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/fade_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/transition_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/fast_random.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/sim_clock.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/glow_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/profiler.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/samsung_04_rain.ino"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+#undef RAIN_EFFECT_H
+#undef BACKGROUND_EFFECT_H
+#undef CLOUD_EFFECT_H
+#undef LIGHTNING_EFFECT_H
+#undef FADE_EFFECT_H
+#undef TRANSITION_EFFECT_H
+#undef TRANSITION_FIELDS_H
+#undef FAST_RANDOM_H
+#undef PROFILER_H
+#undef SIM_CLOCK_H
+#undef GLOW_EFFECT_H
+#undef RAIN_GLOW_RADIUS
+#undef FADE_TO_RAIN_FIELD
+#define FADE_TO_RAIN_FIELD -1
+
+namespace rain_uniform {
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/control.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/power_strip.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/rain_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/background_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/cloud_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/lightning_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/fade_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/transition_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/fast_random.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/sim_clock.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/glow_effect.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/profiler.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/samsung_04_rain.ino"
+}
+
+// 17초에 MODE_COMPLETE가 되면 loop()가 delay 없이 바로 반환하므로 상태로 종료 판단
+// seed가 0이 아니면 setup()의 시드 대신 사용 (setup 이후 첫 난수는 initRainEffect에서 사용)
+static uint32_t runRain(uint32_t seed) {
+  rain::setup();
+  if(seed) rain::fastRandomSeed(seed);
+  while(rain::currentMode != rain::MODE_COMPLETE) {
+    rain::loop();
+  }
+  return rain::fastRandomSeedValue();
+}
+
+static uint32_t runRainPolled(uint32_t seed) {
+  rain_polled::setup();
+  if(seed) rain_polled::fastRandomSeed(seed);
+  while(rain_polled::currentMode != rain_polled::MODE_COMPLETE) {
+    rain_polled::loop();
+  }
+  return rain_polled::fastRandomSeedValue();
+}
+
+static uint32_t runRain30fps(uint32_t seed) {
+  rain_30fps::setup();
+  if(seed) rain_30fps::fastRandomSeed(seed);
+  while(rain_30fps::currentMode != rain_30fps::MODE_COMPLETE) {
+    rain_30fps::loop();
+  }
+  return rain_30fps::fastRandomSeedValue();
+}
+
+static uint32_t runRainGlow(uint32_t seed) {
+  rain_glow::setup();
+  if(seed) rain_glow::fastRandomSeed(seed);
+  while(rain_glow::currentMode != rain_glow::MODE_COMPLETE) {
+    rain_glow::loop();
+  }
+  return rain_glow::fastRandomSeedValue();
+}
+
+static uint32_t runRainUniform(uint32_t seed) {
+  rain_uniform::setup();
+  if(seed) rain_uniform::fastRandomSeed(seed);
+  while(rain_uniform::currentMode != rain_uniform::MODE_COMPLETE) {
+    rain_uniform::loop();
+  }
+  return rain_uniform::fastRandomSeedValue();
+}
+
+static const PreviewScenario scenarios[] = {
+  { "rain",                   "samsung_04_rain", runRain },
+  { "rain_polled_lightning",  "samsung_04_rain", runRainPolled },
+  { "rain_30fps",             "samsung_04_rain", runRain30fps },
+  { "rain_glow",              "samsung_04_rain", runRainGlow },
+  { "rain_uniform_fade",      "samsung_04_rain", runRainUniform },
+};
+
+const PreviewScenario* rainScenarios(int* count) {
+  *count = sizeof(scenarios) / sizeof(scenarios[0]);
+  return scenarios;
+}
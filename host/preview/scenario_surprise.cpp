@@ -0,0 +1,121 @@
+// scenario_surprise.cpp - samsung_02_surprise2 스케치 프리뷰 변형
+// 같은 control.cpp를 변형마다 다시 포함 (헤더 가드를 풀어 선언도 다시 들어가게 함)
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "preview_scenarios.h"
+
+namespace surprise_27 {
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/control.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/power_strip.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/wipe_engine.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/trigger_input.cpp"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+#undef WIPE_ENGINE_H
+#undef TRIGGER_INPUT_H
+
+namespace surprise_20 {
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/control.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/power_strip.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/wipe_engine.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/trigger_input.cpp"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+#undef WIPE_ENGINE_H
+#undef TRIGGER_INPUT_H
+
+namespace surprise_15 {
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/control.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/power_strip.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/wipe_engine.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/trigger_input.cpp"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+#undef WIPE_ENGINE_H
+#undef TRIGGER_INPUT_H
+
+namespace surprise_tracking {
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/control.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/power_strip.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/wipe_engine.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/trigger_input.cpp"
+}
+#undef CONTROL_H
+#undef CONFIG_H
+#undef POWER_STRIP_H
+#undef WIPE_ENGINE_H
+#undef TRIGGER_INPUT_H
+
+namespace surprise_reactive {
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/control.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/power_strip.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/wipe_engine.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/trigger_input.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/samsung_02_surprise2.ino"
+}
+
+static uint32_t runSurprise27(uint32_t) {
+  surprise_27::initNeoPixel();
+  surprise_27::sequence27sec();
+  surprise_27::turnOffAllLED();
+  return 0;
+}
+
+static uint32_t runSurprise20(uint32_t) {
+  surprise_20::initNeoPixel();
+  surprise_20::sequence20sec();
+  surprise_20::turnOffAllLED();
+  return 0;
+}
+
+static uint32_t runSurprise15(uint32_t) {
+  surprise_15::initNeoPixel();
+  surprise_15::sequence15sec();
+  surprise_15::turnOffAllLED();
+  return 0;
+}
+
+// 스케치의 loop()와 동일 (시퀀스 끝 상태 유지)
+static uint32_t runSurpriseTracking(uint32_t) {
+  surprise_tracking::initNeoPixel();
+  surprise_tracking::sequenceWithTracking();
+  return 0;
+}
+
+// 스케치 setup()/loop() 그대로, 시리얼 트리거를 정해진 시각에 넣음
+// 5.3초 놀람(시퀀스 중단) → 9초 30% → 11.5초 놀람 → 14초 놀람 도중 14.5초 끄기
+static uint32_t runSurpriseReactive(uint32_t) {
+  hostSerialRx.clear();
+  hostSerialTimed.clear();
+  hostSerialSchedule(5300000, "!s");
+  hostSerialSchedule(9000000, "!c");
+  hostSerialSchedule(11500000, "!s");
+  hostSerialSchedule(14000000, "!s");
+  hostSerialSchedule(14500000, "!o");
+  surprise_reactive::setup();
+  while(micros() < 16000000UL) {
+    surprise_reactive::loop();
+  }
+  hostSerialTimed.clear();
+  return 0;
+}
+
+static const PreviewScenario scenarios[] = {
+  { "surprise_27sec",     "samsung_02_surprise2", runSurprise27 },
+  { "surprise_20sec",     "samsung_02_surprise2", runSurprise20 },
+  { "surprise_15sec",     "samsung_02_surprise2", runSurprise15 },
+  { "surprise_tracking",  "samsung_02_surprise2", runSurpriseTracking },
+  { "surprise_reactive",  "samsung_02_surprise2", runSurpriseReactive },
+};
+
+const PreviewScenario* surpriseScenarios(int* count) {
+  *count = sizeof(scenarios) / sizeof(scenarios[0]);
+  return scenarios;
+}
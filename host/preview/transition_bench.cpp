@@ -0,0 +1,143 @@
+// transition_bench.cpp - samsung_04_rain 거리 필드 전환(transition_effect.cpp) 검증/측정
+// 스케치의 transition_effect.cpp / control.cpp를 그대로 포함해 흰 화면에 마스크 적용
+//   1) 필드 순서: 원형/대각선/열 필드 값이 스케치 getPixelIndex 좌표의 거리 순서와 같은지 (뒤집힌 쌍이 있으면 종료 코드 1)
+//   2) 마스크: 경계 0은 전부 꺼짐, 끝 경계는 전부 그대로, 픽셀마다 경계가 갈수록 밝아지기만 함,
+//      드러내기 + 감추기 = 원래 밝기 (어긋나면 종료 코드 1)
+//   3) 프레임당 호스트 시간: 필드 마스크 vs 예전 float 전체 페이드 (FADE_TO_RAIN_FIELD -1 경로)
+//
+// 빌드: g++ -std=c++17 -O2 -I../arduino -o transition_bench transition_bench.cpp
+// 사용: ./transition_bench [--repeat N]
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+namespace rain {
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/control.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/power_strip.cpp"
+#include "../../Scenario_led/samsung_04_rain/samsung_04_rain/transition_effect.cpp"
+}
+
+#define FRONT_MAX (255 + TRANSITION_EDGE)
+#define COMPLEMENT_TOLERANCE 2   // 드러내기 + 감추기 허용 오차 (두 번 내림)
+
+static const char* fieldNames[] = { "radial", "diagonal", "column", "noise" };
+
+// 필드 생성(field_export.cpp)과 같은 거리, 좌표는 스케치 배선 기준
+static double fieldDistance(int field, int x, int y) {
+  switch(field) {
+    case rain::FIELD_RADIAL:   return hypot(x - (MATRIX_WIDTH - 1) / 2.0, y - (MATRIX_HEIGHT - 1) / 2.0);
+    case rain::FIELD_DIAGONAL: return x + y;
+    default:                   return x;
+  }
+}
+
+// 거리가 더 먼 픽셀이 먼저 드러나는 쌍의 수
+static int countInversions(int field) {
+  std::vector<double> distance(LED_COUNT);
+  std::vector<uint8_t> value(LED_COUNT);
+  for(int x = 0; x < MATRIX_WIDTH; x++) {
+    for(int y = 0; y < MATRIX_HEIGHT; y++) {
+      int i = rain::getPixelIndex(x, y);
+      distance[i] = fieldDistance(field, x, y);
+      value[i] = pgm_read_byte(&rain::transitionFields[field][i]);
+    }
+  }
+  int inversions = 0;
+  for(int a = 0; a < LED_COUNT; a++) {
+    for(int b = 0; b < LED_COUNT; b++) {
+      if(distance[a] < distance[b] && value[a] > value[b]) inversions++;
+    }
+  }
+  return inversions;
+}
+
+// 흰 화면에 마스크 적용 후 픽셀별 밝기 (R 채널)
+static void maskedLevels(int field, uint16_t front, bool reveal, std::vector<uint8_t>& out) {
+  rain::strip.fill(rain::strip.Color(255, 255, 255));
+  rain::applyTransitionMask((rain::TransitionField)field, front, reveal);
+  out.resize(LED_COUNT);
+  for(int i = 0; i < LED_COUNT; i++) out[i] = (uint8_t)(rain::strip.getPixelColor(i) >> 16);
+}
+
+// 경계를 0부터 끝까지 움직이며 마스크 성질 확인, 어긋난 픽셀 수
+static int checkMask(int field) {
+  std::vector<uint8_t> previous(LED_COUNT, 0), shown, hidden;
+  int failures = 0;
+  for(uint16_t front = 0; front <= FRONT_MAX; front++) {
+    maskedLevels(field, front, true, shown);
+    maskedLevels(field, front, false, hidden);
+    for(int i = 0; i < LED_COUNT; i++) {
+      bool ok = shown[i] >= previous[i];
+      if(front == 0) ok = ok && shown[i] == 0;
+      if(front == FRONT_MAX) ok = ok && shown[i] == 255 && hidden[i] == 0;
+      ok = ok && abs((int)shown[i] + hidden[i] - 255) <= COMPLEMENT_TOLERANCE;
+      if(!ok) failures++;
+    }
+    previous = shown;
+  }
+  return failures;
+}
+
+// 예전 전체 페이드 (fade_effect.cpp FADE_TO_RAIN_FIELD -1의 곱셈 루프)
+static void uniformFade(float progress) {
+  for(int i = 0; i < LED_COUNT; i++) {
+    uint32_t c = rain::strip.getPixelColor(i);
+    uint8_t r = ((c >> 16) & 0xFF) * progress;
+    uint8_t g = ((c >>  8) & 0xFF) * progress;
+    uint8_t b = ((c >>  0) & 0xFF) * progress;
+    rain::strip.setPixelColor(i, rain::strip.Color(r, g, b));
+  }
+}
+
+// 중간 경계(절반 진행) 한 프레임 평균 시간 (화면 다시 채우는 시간은 뺌)
+static double frameNs(int field, int repeat) {
+  double ns = 0;
+  for(int k = 0; k < repeat; k++) {
+    rain::strip.fill(rain::strip.Color(200, 180, 255));
+    auto start = std::chrono::steady_clock::now();
+    if(field < 0) uniformFade(0.5f);
+    else rain::applyTransitionMask((rain::TransitionField)field, FRONT_MAX / 2, true);
+    ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  }
+  return ns / repeat;
+}
+
+int main(int argc, char** argv) {
+  int repeat = 2000;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) repeat = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "Usage: %s [--repeat N]\n", argv[0]);
+      return 1;
+    }
+  }
+  if(repeat < 1) repeat = 1;
+
+  rain::initNeoPixel();
+  rain::strip.setBrightness(255);   // 전송 값 = 저장 값 (밝기 반올림 없이 마스크만 비교)
+
+  int failures = 0;
+  printf("=== 필드 순서 / 마스크 (경계 0~%d) ===\n", FRONT_MAX);
+  for(int field = 0; field < TRANSITION_FIELD_COUNT; field++) {
+    int inversions = field == rain::FIELD_NOISE ? 0 : countInversions(field);
+    int bad = checkMask(field);
+    printf("%-9s 뒤집힌 쌍 %d, 어긋난 픽셀 %d -> %s\n", fieldNames[field], inversions, bad,
+           inversions == 0 && bad == 0 ? "ok" : "FAILED");
+    if(inversions || bad) failures++;
+  }
+
+  printf("\n=== 프레임당 호스트 시간 (%d픽셀, %d회 평균) ===\n", LED_COUNT, repeat);
+  double uniform = frameNs(-1, repeat);
+  printf("%-9s %8.0f ns (float 곱셈)\n", "uniform", uniform);
+  for(int field = 0; field < TRANSITION_FIELD_COUNT; field++) {
+    double ns = frameNs(field, repeat);
+    printf("%-9s %8.0f ns (%.2fx)\n", fieldNames[field], ns, ns > 0 ? uniform / ns : 0);
+  }
+  return failures ? 1 : 0;
+}
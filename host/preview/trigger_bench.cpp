@@ -0,0 +1,122 @@
+// trigger_bench.cpp - samsung_02_surprise2 반응 트리거 지연 측정 (시리얼 트리거 대체 입력)
+// 스케치 setup()/loop()를 가상 시계로 실행하면서 무작위 시각에 트리거를 넣고
+// 끝에 "!?"를 보내 스케치가 기록한 지연 히스토그램을 그대로 출력
+// 스케치는 트리거를 읽은 시각부터 재므로, 바이트 도착 시각부터 잰 전체 지연도 따로 출력
+// (show() 중 도착한 트리거는 전송이 끝나야 읽힘)
+// 스케치가 기록한 최대 지연이 같은 프레임에서 벤치가 잰 읽기 → 도착 지연과 다르면 종료 코드 1
+//
+// 빌드: g++ -std=c++17 -O2 -I../arduino -o trigger_bench trigger_bench.cpp
+//   -DNEO_HOST_AVR_TIMING을 더하면 AVR처럼 블로킹 show() 중 micros()가 멈춤 (스케치 시간 기준 검증)
+// 사용: ./trigger_bench [--count N] [--seed N] [--gap-ms MS]
+//   --count   트리거 수 (기본 200)
+//   --seed    트리거 시각/코드 난수 시드 (기본 1)
+//   --gap-ms  트리거 사이 최대 간격 (기본 3000, 실제 간격은 100 ~ gap-ms 균등)
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace surprise {
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/control.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/power_strip.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/wipe_engine.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/trigger_input.cpp"
+#include "../../Scenario_led/samsung_02_surprise2/samsung_02_surprise2/samsung_02_surprise2.ino"
+}
+
+// ===== 도착 → 첫 프레임 도착 지연 (show 훅에서 측정) =====
+// 스케치가 새 트리거의 첫 반응 프레임을 보내면 measureUs(트리거 읽은 시각)가 바뀜
+struct BenchLatency {
+  std::vector<uint64_t> arrivalsUs;    // 트리거 도착 시각 (시각 순)
+  std::vector<uint32_t> latenciesUs;
+  uint32_t readMaxUs = 0;              // 읽은 시각 → 첫 프레임 도착 최대 (스케치 기록과 같아야 함)
+  unsigned long servedUs = (unsigned long)-1;
+};
+
+static void benchShowHook(const Adafruit_NeoPixel& strip, uint64_t timeUs, void* context) {
+  BenchLatency* bench = (BenchLatency*)context;
+  if(surprise::measuring || surprise::measureUs == bench->servedUs) return;
+  bench->servedUs = surprise::measureUs;
+
+  // 읽은 시각 이전에 도착한 마지막 트리거
+  auto next = std::upper_bound(bench->arrivalsUs.begin(), bench->arrivalsUs.end(), (uint64_t)surprise::measureUs);
+  if(next == bench->arrivalsUs.begin()) return;
+  bench->latenciesUs.push_back((uint32_t)(timeUs + strip.wireTimeUs() - *(next - 1)));
+  uint32_t readUs = (uint32_t)(timeUs + strip.wireTimeUs() - surprise::measureUs);
+  if(readUs > bench->readMaxUs) bench->readMaxUs = readUs;
+}
+
+int main(int argc, char** argv) {
+  int count = 200;
+  unsigned long seed = 1;
+  long gapMs = 3000;
+  for(int i = 1; i < argc; i++) {
+    if(!strcmp(argv[i], "--count") && i + 1 < argc) count = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "--seed") && i + 1 < argc) seed = strtoul(argv[++i], 0, 10);
+    else if(!strcmp(argv[i], "--gap-ms") && i + 1 < argc) gapMs = atol(argv[++i]);
+    else {
+      fprintf(stderr, "Usage: %s [--count N] [--seed N] [--gap-ms MS]\n", argv[0]);
+      return 1;
+    }
+  }
+  if(count < 1 || gapMs < 100) {
+    fprintf(stderr, "count must be >= 1 and gap-ms >= 100\n");
+    return 1;
+  }
+
+  // 트리거 일정 (스케치 난수와 별도 수열을 쓰도록 시드 후 바로 생성)
+  static const char codes[] = { TRIGGER_SURPRISE, TRIGGER_CALM, TRIGGER_SURPRISE, TRIGGER_OFF };
+  randomSeed(seed);
+  BenchLatency bench;
+  uint64_t atUs = 0;
+  for(int i = 0; i < count; i++) {
+    atUs += (uint64_t)random(100, gapMs + 1) * 1000 + random(1000);
+    char message[3] = { TRIGGER_SYNC, codes[random(4)], 0 };
+    hostSerialSchedule(atUs, message);
+    bench.arrivalsUs.push_back(atUs);
+  }
+  uint64_t endUs = atUs + 3000000;
+  hostSerialSchedule(endUs, std::string(1, TRIGGER_SYNC) + TRIGGER_REPORT);
+
+  std::string report;
+  hostSerialTx = &report;
+  hostShowHook = benchShowHook;
+  hostShowContext = &bench;
+  surprise::setup();
+  while(hostRealMicros() <= endUs + 100000) {
+    surprise::loop();
+  }
+  hostShowHook = 0;
+  hostSerialTx = 0;
+
+  printf("%d triggers over %.1f s (virtual)\n\n", count, endUs / 1e6);
+  printf("[sketch] read -> first photon\n");
+  fwrite(report.data(), 1, report.size(), stdout);
+
+  // 스케치 기록이 실제 시각과 맞는지 (AVR 타이밍에서는 show() 중 멈춘 micros()를 보충해야 같음)
+  bool clockOk = surprise::latencyMaxUs == bench.readMaxUs;
+  printf("\n[check] sketch max_us=%lu, bench read -> photon max_us=%u -> %s\n",
+         (unsigned long)surprise::latencyMaxUs, bench.readMaxUs, clockOk ? "ok" : "MISMATCH");
+
+  // 같은 칸 폭으로 도착 기준 히스토그램
+  std::vector<uint32_t>& lat = bench.latenciesUs;
+  if(lat.empty()) return clockOk ? 0 : 1;
+  std::sort(lat.begin(), lat.end());
+  uint32_t targetUs = surprise::strip.wireTimeUs() * TRIGGER_TARGET_FRAMES;
+  size_t within = std::upper_bound(lat.begin(), lat.end(), targetUs) - lat.begin();
+  printf("\n[bench] arrival -> first photon\n");
+  printf("n=%zu p50_us=%u p99_us=%u max_us=%u target_us=%u within=%zu\n", lat.size(), lat[lat.size() / 2],
+         lat[lat.size() * 99 / 100], lat.back(), targetUs, within);
+  size_t i = 0;
+  for(uint32_t bucket = 1; i < lat.size(); bucket++) {
+    size_t n = 0;
+    while(i < lat.size() && lat[i] < bucket * (uint32_t)TRIGGER_HIST_BUCKET_US) { i++; n++; }
+    if(n) printf("  <%u us: %zu\n", bucket * TRIGGER_HIST_BUCKET_US, n);
+  }
+  return (within == lat.size() && clockOk) ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+// work_pool.cpp - 작업 훔치기 스레드 풀
+
+#include "work_pool.h"
+
+// 현재 스레드가 속한 풀과 워커 번호 (풀 밖 스레드는 0)
+static thread_local WorkPool* currentPool = 0;
+static thread_local unsigned currentWorker = 0;
+
+WorkPool::WorkPool(unsigned threadCount) {
+  if(threadCount == 0) threadCount = 1;
+  for(unsigned i = 0; i < threadCount; i++) queues.emplace_back(new Queue);
+  for(unsigned i = 0; i < threadCount; i++) threads.emplace_back(&WorkPool::workerLoop, this, i);
+}
+
+WorkPool::~WorkPool() {
+  {
+    std::lock_guard<std::mutex> guard(sleepLock);
+    stopping = true;
+  }
+  wake.notify_all();
+  for(std::thread& t : threads) t.join();
+}
+
+void WorkPool::submit(Task task) {
+  unsigned index = currentPool == this ? currentWorker
+                                       : nextQueue.fetch_add(1) % (unsigned)queues.size();
+  pending++;
+  {
+    std::lock_guard<std::mutex> guard(queues[index]->lock);
+    queues[index]->tasks.push_back(std::move(task));
+  }
+  {
+    // 잠든 워커가 queued 확인과 wait 사이에 알림을 놓치지 않도록 sleepLock 안에서 증가
+    std::lock_guard<std::mutex> guard(sleepLock);
+    queued++;
+  }
+  wake.notify_one();
+}
+
+void WorkPool::wait() {
+  std::unique_lock<std::mutex> guard(sleepLock);
+  idle.wait(guard, [this] { return pending.load() == 0; });
+}
+
+bool WorkPool::takeTask(unsigned index, Task& task) {
+  // 자기 큐: 뒤에서 (최근 작업)
+  {
+    Queue& own = *queues[index];
+    std::lock_guard<std::mutex> guard(own.lock);
+    if(!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      queued--;
+      return true;
+    }
+  }
+  // 다른 큐: 앞에서 (오래된 작업)
+  for(unsigned k = 1; k < queues.size(); k++) {
+    Queue& victim = *queues[(index + k) % queues.size()];
+    std::lock_guard<std::mutex> guard(victim.lock);
+    if(!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      queued--;
+      steals++;
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkPool::workerLoop(unsigned index) {
+  currentPool = this;
+  currentWorker = index;
+
+  while(true) {
+    Task task;
+    if(takeTask(index, task)) {
+      task();
+      if(--pending == 0) {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        idle.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> guard(sleepLock);
+    wake.wait(guard, [this] { return stopping || queued.load() > 0; });
+    if(stopping && queued.load() == 0) return;
+  }
+}
@@ -0,0 +1,54 @@
+// work_pool.h - 작업 훔치기(work-stealing) 스레드 풀 (호스트 도구)
+// 워커마다 자기 큐를 가지고 뒤에서 꺼내며(LIFO), 비면 다른 워커 큐 앞에서 훔침(FIFO)
+// 작업 안에서 submit()하면 자기 큐에 들어가므로 후속 작업이 같은 워커에서 캐시를 재사용
+
+#ifndef WORK_POOL_H
+#define WORK_POOL_H
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkPool {
+ public:
+  typedef std::function<void()> Task;
+
+  explicit WorkPool(unsigned threadCount);
+  ~WorkPool();
+
+  void submit(Task task);
+  void wait();     // 제출된 작업(작업 안에서 추가된 것 포함)이 모두 끝날 때까지 대기
+
+  unsigned size() const { return (unsigned)threads.size(); }
+  uint64_t stealCount() const { return steals.load(); }
+
+ private:
+  struct Queue {
+    std::mutex lock;
+    std::deque<Task> tasks;
+  };
+
+  void workerLoop(unsigned index);
+  bool takeTask(unsigned index, Task& task);
+
+  std::vector<std::unique_ptr<Queue>> queues;
+  std::vector<std::thread> threads;
+
+  std::mutex sleepLock;
+  std::condition_variable wake;
+  std::condition_variable idle;
+  bool stopping = false;
+
+  std::atomic<int> queued{0};       // 큐에 들어 있는 작업 수
+  std::atomic<int> pending{0};      // 아직 끝나지 않은 작업 수
+  std::atomic<unsigned> nextQueue{0};
+  std::atomic<uint64_t> steals{0};
+};
+
+#endif